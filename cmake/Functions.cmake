@@ -142,6 +142,24 @@ macro(dune_probe_functions)
     "unistd.h"
     DUNE_SYS_HAS_CLOSE)
 
+  dune_test_function(fsync
+    "int"
+    "int"
+    "unistd.h"
+    DUNE_SYS_HAS_FSYNC)
+
+  dune_test_function(sendmmsg
+    "int"
+    "int;mmsghdr*;unsigned;int"
+    "sys/socket.h"
+    DUNE_SYS_HAS_SENDMMSG)
+
+  dune_test_function(recvmmsg
+    "int"
+    "int;mmsghdr*;unsigned;int;timespec*"
+    "sys/socket.h;time.h"
+    DUNE_SYS_HAS_RECVMMSG)
+
   dune_test_function(closesocket
     "int"
     "SOCKET"
@@ -111,6 +111,7 @@ macro(dune_probe_headers)
   dune_test_header(linux/rtc.h)
   dune_test_header(linux/input.h)
   dune_test_header(linux/spi/spidev.h)
+  dune_test_header(linux/futex.h)
   dune_test_header(netdb.h)
   dune_test_header(pthread.h)
   dune_test_header(signal.h)
@@ -143,6 +144,7 @@ macro(dune_probe_headers)
   dune_test_header(linux/videodev2.h)
   dune_test_header(sched.h)
   dune_test_header(poll.h)
+  dune_test_header(sys/epoll.h)
   dune_test_header(ifaddrs.h)
   dune_test_header(semaphore.h)
   dune_test_header(libintl.h)
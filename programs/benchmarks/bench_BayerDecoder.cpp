@@ -0,0 +1,112 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using namespace DUNE;
+using namespace DUNE::Media;
+
+//! Frame width (5 MP).
+static const int c_width = 2592;
+//! Frame height (5 MP).
+static const int c_height = 1944;
+
+//! Decode a frame a number of times and print the throughput.
+static void
+benchmark(const char* name, BayerDecoder::Method method, bool accelerate, bool yuv,
+          const std::vector<uint8_t>& bayer, unsigned count)
+{
+  BayerDecoder decoder(BayerDecoder::TILE_GBRG, method);
+  decoder.setAcceleration(accelerate);
+  std::vector<uint8_t> output(c_width * c_height * 3);
+
+  double start = Time::Clock::get();
+  for (unsigned i = 0; i < count; ++i)
+  {
+    if (yuv)
+      decoder.decodeToYUV420(&bayer[0], &output[0], c_width, c_height);
+    else
+      decoder.decodeToRGB24(&bayer[0], &output[0], c_width, c_height);
+  }
+  double elapsed = Time::Clock::get() - start;
+
+  std::printf("%-10s %-8s %-8s %10.2f %10.1f\n", name,
+              yuv ? "YUV420" : "RGB24", accelerate ? "vector" : "scalar",
+              elapsed * 1000.0 / count,
+              (double)c_width * c_height * count / elapsed / 1e6);
+}
+
+int
+main(int argc, char** argv)
+{
+  unsigned count = 10;
+  if (argc > 1)
+    count = std::atoi(argv[1]);
+
+  // Synthetic mosaic with smooth gradients and some noise.
+  std::vector<uint8_t> bayer(c_width * c_height);
+  for (int y = 0; y < c_height; ++y)
+  {
+    for (int x = 0; x < c_width; ++x)
+      bayer[y * c_width + x] = (uint8_t)((x + y) / 20 + ((x * 7 + y * 13) % 17));
+  }
+
+  std::printf("frame: %dx%d, %u iterations, acceleration %s\n", c_width, c_height, count,
+              BayerDecoder::isAccelerationAvailable() ? "available" : "not available");
+  std::printf("%-10s %-8s %-8s %10s %10s\n", "method", "output", "path", "ms/frame", "MPixel/s");
+
+  BayerDecoder::Method methods[] =
+  {
+    BayerDecoder::METHOD_BILINEAR,
+    BayerDecoder::METHOD_HQLINEAR
+  };
+
+  const char* names[] =
+  {
+    "bilinear",
+    "hqlinear"
+  };
+
+  for (unsigned i = 0; i < sizeof(methods) / sizeof(methods[0]); ++i)
+  {
+    benchmark(names[i], methods[i], false, false, bayer, count);
+    benchmark(names[i], methods[i], true, false, bayer, count);
+    benchmark(names[i], methods[i], false, true, bayer, count);
+    benchmark(names[i], methods[i], true, true, bayer, count);
+  }
+
+  return 0;
+}
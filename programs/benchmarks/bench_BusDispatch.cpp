@@ -0,0 +1,281 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using namespace DUNE;
+
+//! Minimal bus subscriber. In legacy mode every delivery is copied
+//! into the recipient queue, reproducing the clone-per-subscriber
+//! behaviour; otherwise the shared message is queued by reference.
+class Sink: public Tasks::AbstractTask
+{
+public:
+  Sink(Tasks::Context& ctx, bool shared):
+    m_recipient(this, ctx),
+    m_shared(shared),
+    m_count(0)
+  {
+    m_recipient.bind(IMC::EstimatedState::getIdStatic(),
+                     new Tasks::Consumer<Sink, IMC::EstimatedState>(*this, &Sink::consume));
+  }
+
+  ~Sink(void)
+  {
+    m_recipient.unbindAll();
+  }
+
+  void
+  receive(const IMC::Message* msg)
+  {
+    m_recipient.put(msg);
+  }
+
+  void
+  receive(IMC::SharedMessage* msg)
+  {
+    if (m_shared)
+      m_recipient.put(msg);
+    else
+      m_recipient.put(msg->get());
+  }
+
+  void
+  consume(const IMC::EstimatedState* msg)
+  {
+    (void)msg;
+    ++m_count;
+  }
+
+  void
+  drain(void)
+  {
+    m_recipient.runCallBacks();
+  }
+
+  unsigned
+  getCount(void) const
+  {
+    return m_count;
+  }
+
+  const char*
+  getName(void) const
+  {
+    return "Sink";
+  }
+
+  void inf(const char*, ...) { }
+  void war(const char*, ...) { }
+  void err(const char*, ...) { }
+  void cri(const char*, ...) { }
+  void debug(const char*, ...) { }
+  void trace(const char*, ...) { }
+  void spew(const char*, ...) { }
+
+protected:
+  void
+  run(void)
+  { }
+
+private:
+  Tasks::Recipient m_recipient;
+  bool m_shared;
+  unsigned m_count;
+};
+
+//! Subscriber that discards deliveries, so that concurrent
+//! dispatches measure the bus alone.
+class NullSink: public Tasks::AbstractTask
+{
+public:
+  NullSink(Tasks::Context& ctx):
+    m_ctx(ctx)
+  {
+    m_ctx.mbus.registerRecipient(this, IMC::EstimatedState::getIdStatic());
+  }
+
+  ~NullSink(void)
+  {
+    m_ctx.mbus.unregisterRecipient(this, IMC::EstimatedState::getIdStatic());
+  }
+
+  void
+  receive(const IMC::Message* msg)
+  {
+    (void)msg;
+  }
+
+  void
+  receive(IMC::SharedMessage* msg)
+  {
+    (void)msg;
+  }
+
+  const char*
+  getName(void) const
+  {
+    return "NullSink";
+  }
+
+  void inf(const char*, ...) { }
+  void war(const char*, ...) { }
+  void err(const char*, ...) { }
+  void cri(const char*, ...) { }
+  void debug(const char*, ...) { }
+  void trace(const char*, ...) { }
+  void spew(const char*, ...) { }
+
+protected:
+  void
+  run(void)
+  { }
+
+private:
+  Tasks::Context& m_ctx;
+};
+
+//! Thread dispatching a fixed number of messages.
+class Dispatcher: public Concurrency::Thread
+{
+public:
+  Dispatcher(IMC::Bus& bus, unsigned messages):
+    m_bus(bus),
+    m_messages(messages)
+  { }
+
+protected:
+  void
+  run(void)
+  {
+    IMC::EstimatedState msg;
+    for (unsigned i = 0; i < m_messages; ++i)
+      m_bus.dispatch(&msg);
+  }
+
+private:
+  IMC::Bus& m_bus;
+  unsigned m_messages;
+};
+
+//! Measure aggregate dispatch rate of concurrent dispatchers.
+static double
+benchmarkThreads(unsigned threads, unsigned messages)
+{
+  Tasks::Context ctx;
+  NullSink sink(ctx);
+
+  std::vector<Dispatcher*> dispatchers;
+  for (unsigned i = 0; i < threads; ++i)
+    dispatchers.push_back(new Dispatcher(ctx.mbus, messages));
+
+  double start = Time::Clock::get();
+  for (unsigned i = 0; i < threads; ++i)
+    dispatchers[i]->start();
+
+  for (unsigned i = 0; i < threads; ++i)
+  {
+    dispatchers[i]->join();
+    delete dispatchers[i];
+  }
+  double elapsed = Time::Clock::get() - start;
+
+  return (double)threads * messages / elapsed;
+}
+
+static double
+benchmark(unsigned subscribers, unsigned messages, bool shared)
+{
+  Tasks::Context ctx;
+  std::vector<Sink*> sinks;
+  for (unsigned i = 0; i < subscribers; ++i)
+    sinks.push_back(new Sink(ctx, shared));
+
+  IMC::EstimatedState msg;
+  const unsigned batch = 100;
+
+  double start = Time::Clock::get();
+  for (unsigned i = 0; i < messages; i += batch)
+  {
+    for (unsigned j = 0; j < batch && i + j < messages; ++j)
+      ctx.mbus.dispatch(&msg);
+
+    for (unsigned j = 0; j < sinks.size(); ++j)
+      sinks[j]->drain();
+  }
+  double elapsed = Time::Clock::get() - start;
+
+  for (unsigned i = 0; i < sinks.size(); ++i)
+  {
+    if (sinks[i]->getCount() != messages)
+      std::fprintf(stderr, "ERROR: subscriber %u received %u of %u messages\n",
+                   i, sinks[i]->getCount(), messages);
+    delete sinks[i];
+  }
+
+  return messages / elapsed;
+}
+
+int
+main(int argc, char** argv)
+{
+  unsigned messages = 100000;
+  if (argc > 1)
+    messages = std::atoi(argv[1]);
+
+  static const unsigned c_subscribers[] = {1, 2, 5, 10, 15, 20, 40};
+  static const unsigned c_count = sizeof(c_subscribers) / sizeof(c_subscribers[0]);
+
+  std::printf("%-12s %16s %16s %8s\n", "subscribers", "clone (msg/s)", "shared (msg/s)", "speedup");
+  for (unsigned i = 0; i < c_count; ++i)
+  {
+    double before = benchmark(c_subscribers[i], messages, false);
+    double after = benchmark(c_subscribers[i], messages, true);
+    std::printf("%-12u %16.0f %16.0f %7.2fx\n", c_subscribers[i], before, after, after / before);
+  }
+
+  static const unsigned c_threads[] = {1, 2, 4, 8, 16, 32, 64};
+  static const unsigned c_thread_count = sizeof(c_threads) / sizeof(c_threads[0]);
+
+  std::printf("\n%-12s %16s\n", "threads", "dispatch (msg/s)");
+  for (unsigned i = 0; i < c_thread_count; ++i)
+  {
+    double rate = benchmarkThreads(c_threads[i], messages);
+    std::printf("%-12u %16.0f\n", c_threads[i], rate);
+  }
+
+  return 0;
+}
@@ -0,0 +1,140 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Cache snapshot journal.
+#include <Transports/Cache/Snapshot.hpp>
+
+using namespace DUNE;
+using FileSystem::Path;
+
+//! Benchmark result.
+struct Result
+{
+  //! Bytes written to disk.
+  uint64_t bytes;
+  //! Time spent (s).
+  double time;
+};
+
+//! Create the message stored at a given iteration.
+static void
+createMessage(IMC::EntityInfo& info, unsigned i, unsigned entities)
+{
+  info.id = i % entities;
+  info.label = Utils::String::str("Entity %u", info.id);
+  info.component = Utils::String::str("Component %u", i);
+}
+
+//! Store messages rewriting the whole snapshot after each one, as
+//! the cache task used to.
+static Result
+benchmarkRewrite(const Path& file, unsigned messages, unsigned entities)
+{
+  std::map<unsigned, std::vector<uint8_t> > live;
+  IMC::EntityInfo info;
+  Result r;
+  r.bytes = 0;
+
+  double start = Time::Clock::get();
+  for (unsigned i = 0; i < messages; ++i)
+  {
+    createMessage(info, i, entities);
+    std::vector<uint8_t>& pkt = live[info.id];
+    pkt.resize(info.getSerializationSize());
+    IMC::Packet::serialize(&info, &pkt[0], pkt.size());
+
+    std::ofstream ofs(file.c_str(), std::ios::binary | std::ios::trunc);
+    std::map<unsigned, std::vector<uint8_t> >::iterator itr = live.begin();
+    for (; itr != live.end(); ++itr)
+    {
+      ofs.write((const char*)&itr->second[0], itr->second.size());
+      r.bytes += itr->second.size();
+    }
+  }
+
+  r.time = Time::Clock::get() - start;
+  return r;
+}
+
+//! Store messages in the append-only journal.
+static Result
+benchmarkJournal(const Path& file, unsigned messages, unsigned entities)
+{
+  Transports::Cache::Snapshot snapshot(file);
+  snapshot.clear();
+  IMC::EntityInfo info;
+
+  double start = Time::Clock::get();
+  for (unsigned i = 0; i < messages; ++i)
+  {
+    createMessage(info, i, entities);
+    snapshot.store(&info);
+  }
+
+  Result r;
+  r.time = Time::Clock::get() - start;
+  r.bytes = snapshot.getBytesWritten();
+  return r;
+}
+
+int
+main(int argc, char** argv)
+{
+  unsigned messages = 10000;
+  unsigned entities = 256;
+  if (argc > 1)
+    messages = std::atoi(argv[1]);
+  if (argc > 2)
+    entities = std::atoi(argv[2]);
+
+  Path file = Path::current() / "bench_CacheSnapshot.lsf";
+
+  Result rewrite = benchmarkRewrite(file, messages, entities);
+  Result journal = benchmarkJournal(file, messages, entities);
+  file.remove();
+
+  std::printf("%u messages, %u cached\n", messages, entities);
+  std::printf("%-16s %16s %12s %10s\n", "method", "bytes written", "time (s)", "speedup");
+  std::printf("%-16s %16llu %12.3f %9.2fx\n", "full rewrite",
+              (unsigned long long)rewrite.bytes, rewrite.time, 1.0);
+  std::printf("%-16s %16llu %12.3f %9.2fx\n", "journal",
+              (unsigned long long)journal.bytes, journal.time, rewrite.time / journal.time);
+
+  return 0;
+}
@@ -0,0 +1,159 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using namespace DUNE;
+
+//! Size of writes and reads, in bytes.
+static const unsigned c_io_size = 4096;
+
+//! Produce a synthetic navigation log.
+static std::string
+createLog(unsigned count)
+{
+  std::ostringstream os;
+  IMC::EstimatedState state;
+  IMC::Rpm rpm;
+  IMC::Depth depth;
+  IMC::EulerAngles euler;
+
+  for (unsigned i = 0; i < count; ++i)
+  {
+    double t = 1.5e9 + i * 0.01;
+    state.x = std::sin(i * 0.001) * 100;
+    state.y = std::cos(i * 0.001) * 100;
+    state.z = 2.0 + 0.1 * std::sin(i * 0.01);
+    state.psi = i * 0.0001;
+    state.setTimeStamp(t);
+    IMC::Packet::serialize(&state, os);
+
+    rpm.value = 1000 + (i % 7);
+    rpm.setTimeStamp(t);
+    IMC::Packet::serialize(&rpm, os);
+
+    depth.value = state.z;
+    depth.setTimeStamp(t);
+    IMC::Packet::serialize(&depth, os);
+
+    euler.phi = 0.01 * std::sin(i * 0.1);
+    euler.psi = state.psi;
+    euler.setTimeStamp(t);
+    IMC::Packet::serialize(&euler, os);
+  }
+
+  return os.str();
+}
+
+//! Compress and decompress data through the stream filters used
+//! by the logging tasks.
+static void
+benchmark(Compression::Methods method, const std::string& data)
+{
+  std::ostringstream os;
+
+  double start = Time::Clock::get();
+  {
+    Compression::FilterOutput fos(os, method);
+    for (size_t i = 0; i < data.size(); i += c_io_size)
+      fos.write(data.data() + i, std::min((size_t)c_io_size, data.size() - i));
+  }
+  double com_time = Time::Clock::get() - start;
+
+  std::string cdata = os.str();
+  std::istringstream is(cdata);
+  std::vector<char> bfr(c_io_size);
+  size_t size = 0;
+
+  start = Time::Clock::get();
+  {
+    Compression::FilterInput fis(is, method);
+    while (fis.read(&bfr[0], bfr.size()) || fis.gcount() > 0)
+      size += fis.gcount();
+  }
+  double dec_time = Time::Clock::get() - start;
+
+  double mib = data.size() / (1024.0 * 1024.0);
+  std::printf("%-8s %10.2f %12.1f %12.1f %s\n",
+              Compression::Factory::method(method).c_str(),
+              (double)data.size() / cdata.size(),
+              mib / com_time, mib / dec_time,
+              size == data.size() ? "" : "(size mismatch)");
+}
+
+int
+main(int argc, char** argv)
+{
+  std::string data;
+
+  if (argc > 1)
+  {
+    // Use an existing (uncompressed) LSF log.
+    std::ifstream ifs(argv[1], std::ios::binary);
+    if (!ifs)
+    {
+      std::fprintf(stderr, "ERROR: unable to open '%s'\n", argv[1]);
+      return 1;
+    }
+
+    data.assign((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+  }
+  else
+  {
+    data = createLog(200000);
+  }
+
+  std::printf("input: %.1f MiB\n", data.size() / (1024.0 * 1024.0));
+  std::printf("%-8s %10s %12s %12s\n", "method", "ratio", "comp MiB/s", "dec MiB/s");
+
+  Compression::Methods methods[] =
+  {
+    Compression::METHOD_LZ4,
+    Compression::METHOD_ZLIB,
+    Compression::METHOD_GZIP,
+    Compression::METHOD_BZIP2
+  };
+
+  for (unsigned i = 0; i < sizeof(methods) / sizeof(methods[0]); ++i)
+    benchmark(methods[i], data);
+
+  return 0;
+}
@@ -0,0 +1,132 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: José Braga                                                       *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using namespace DUNE;
+
+//! Number of filter cycles per configuration.
+static unsigned s_iterations = 100000;
+//! Sink for results, prevents the compiler from eliding work.
+static volatile double s_sink = 0;
+//! Configure a filter with a chain of integrators and direct
+//! observations of the first states. Remaining outputs are inactive,
+//! like LBL outputs without a range.
+template <typename F, typename A>
+static void
+setup(F& kal, A& a, unsigned states, unsigned active)
+{
+  a.identity();
+  for (unsigned i = 0; i + 1 < states; ++i)
+    a(i, i + 1) = 0.01;
+
+  kal.setTransitions(a);
+  kal.setCovariance(1.0);
+  kal.setProcessNoise(1e-4);
+  kal.setMeasurementNoise(0.1);
+
+  for (unsigned i = 0; i < active; ++i)
+    kal.setObservation(i, i % states, 1.0);
+}
+
+//! Run predict+update cycles.
+//! @param[in] kal filter.
+//! @param[in] outputs number of outputs.
+//! @return time per cycle in nanoseconds.
+template <typename F>
+static double
+run(F& kal, unsigned outputs)
+{
+  double start = Time::Clock::get();
+
+  for (unsigned n = 0; n < s_iterations; ++n)
+  {
+    kal.predict();
+
+    for (unsigned i = 0; i < outputs; ++i)
+      kal.setInnovation(i, 0.001 * ((n + i) % 7));
+
+    kal.update(0);
+  }
+
+  double elapsed = Time::Clock::get() - start;
+  s_sink += kal.getState(0);
+
+  return elapsed * 1e9 / s_iterations;
+}
+
+template <unsigned N, unsigned M>
+static void
+benchmark(const char* name, unsigned active)
+{
+  Navigation::KalmanFilter dkal;
+  dkal.reset(N, M);
+  Math::Matrix da(N);
+  setup(dkal, da, N, active);
+
+  Navigation::KalmanFilter skal;
+  skal.reset(N, M);
+  skal.setCorrectionMethod(Navigation::KalmanFilter::CM_SEQUENTIAL);
+  Math::Matrix sa(N);
+  setup(skal, sa, N, active);
+
+  Navigation::FixedKalmanFilter<N, M> fkal;
+  Math::FixedMatrix<N, N> fa;
+  setup(fkal, fa, N, active);
+
+  double dt = run(dkal, active);
+  double st = run(skal, active);
+  double ft = run(fkal, active);
+
+  std::printf("%-28s %3u %3u %3u %12.1f %12.1f %12.1f\n", name, N, M, active, dt, st, ft);
+}
+
+int
+main(int argc, char** argv)
+{
+  if (argc > 1)
+    s_iterations = std::atoi(argv[1]);
+
+  std::printf("%-28s %3s %3s %3s %12s %12s %12s\n", "configuration", "N", "M", "on",
+              "batch (ns)", "seq (ns)", "fixed (ns)");
+
+  // Navigation.AUV.Navigation without and with four LBL beacons.
+  benchmark<9, 6>("AUV navigation", 6);
+  benchmark<9, 10>("AUV navigation + 4 LBL", 6);
+  benchmark<9, 10>("AUV navigation + 4 LBL", 10);
+  // Navigation.General.LBL with four beacons.
+  benchmark<8, 4>("LBL tracker", 4);
+
+  return 0;
+}
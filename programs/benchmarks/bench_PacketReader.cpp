@@ -0,0 +1,130 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using namespace DUNE;
+
+//! Produce a log with a mix of messages typical of a vehicle log.
+static std::string
+createLog(unsigned count)
+{
+  std::ostringstream os;
+  IMC::EstimatedState state;
+  IMC::Rpm rpm;
+  IMC::Depth depth;
+  IMC::LogBookEntry lbe;
+  lbe.text = "mission started";
+
+  for (unsigned i = 0; i < count; ++i)
+  {
+    switch (i % 4)
+    {
+      case 0:
+        IMC::Packet::serialize(&state, os);
+        break;
+      case 1:
+        IMC::Packet::serialize(&rpm, os);
+        break;
+      case 2:
+        IMC::Packet::serialize(&depth, os);
+        break;
+      default:
+        IMC::Packet::serialize(&lbe, os);
+        break;
+    }
+  }
+
+  return os.str();
+}
+
+//! Read the log with one allocation and two stream reads per message.
+static double
+benchmarkPacket(const std::string& log)
+{
+  std::istringstream is(log);
+  unsigned count = 0;
+
+  double start = Time::Clock::get();
+  IMC::Message* msg = NULL;
+  while ((msg = IMC::Packet::deserialize(is)) != NULL)
+  {
+    ++count;
+    delete msg;
+  }
+
+  return count / (Time::Clock::get() - start);
+}
+
+//! Read the log with a packet reader, optionally accepting only
+//! EstimatedState messages. Throughput is given in packets read
+//! from the log, whether decoded or skipped.
+static double
+benchmarkReader(const std::string& log, unsigned messages, bool filter)
+{
+  std::istringstream is(log);
+  IMC::PacketReader reader(is);
+  if (filter)
+    reader.accept(DUNE_IMC_ESTIMATEDSTATE);
+
+  double start = Time::Clock::get();
+  while (reader.next() != NULL)
+  { }
+
+  return messages / (Time::Clock::get() - start);
+}
+
+int
+main(int argc, char** argv)
+{
+  unsigned messages = 1000000;
+  if (argc > 1)
+    messages = std::atoi(argv[1]);
+
+  std::string log = createLog(messages);
+
+  double packet = benchmarkPacket(log);
+  double reader = benchmarkReader(log, messages, false);
+  double filtered = benchmarkReader(log, messages, true);
+
+  std::printf("%-32s %14s %8s\n", "method", "packets/s", "speedup");
+  std::printf("%-32s %14.0f %7.2fx\n", "Packet::deserialize", packet, 1.0);
+  std::printf("%-32s %14.0f %7.2fx\n", "PacketReader::next", reader, reader / packet);
+  std::printf("%-32s %14.0f %7.2fx\n", "PacketReader::next (filtered)", filtered, filtered / packet);
+
+  return 0;
+}
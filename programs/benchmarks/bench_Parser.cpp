@@ -0,0 +1,139 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using namespace DUNE;
+
+//! Produce a stream with a sonar ping every few navigation messages,
+//! typical of a TCP link to a vehicle carrying sidescan data.
+static std::string
+createStream(unsigned count)
+{
+  std::ostringstream os;
+  IMC::EstimatedState state;
+  IMC::Rpm rpm;
+  IMC::SonarData sonar;
+  sonar.data.resize(4000, 'x');
+
+  for (unsigned i = 0; i < count; ++i)
+  {
+    switch (i % 4)
+    {
+      case 0:
+        IMC::Packet::serialize(&sonar, os);
+        break;
+      case 1:
+        IMC::Packet::serialize(&rpm, os);
+        break;
+      default:
+        IMC::Packet::serialize(&state, os);
+        break;
+    }
+  }
+
+  return os.str();
+}
+
+//! Feed the stream one byte at a time.
+static double
+benchmarkByte(const std::string& stream, unsigned block)
+{
+  const uint8_t* data = (const uint8_t*)stream.data();
+  IMC::Parser parser;
+  unsigned count = 0;
+
+  double start = Time::Clock::get();
+  for (size_t pos = 0; pos < stream.size(); pos += block)
+  {
+    size_t n = std::min((size_t)block, stream.size() - pos);
+    for (size_t i = 0; i < n; ++i)
+    {
+      IMC::Message* m = parser.parse(data[pos + i]);
+      if (m)
+      {
+        ++count;
+        delete m;
+      }
+    }
+  }
+
+  return stream.size() / (Time::Clock::get() - start) / (1 << 20);
+}
+
+//! Feed the stream in blocks.
+static double
+benchmarkBlock(const std::string& stream, unsigned block)
+{
+  const uint8_t* data = (const uint8_t*)stream.data();
+  IMC::Parser parser;
+  std::vector<IMC::Message*> msgs;
+
+  double start = Time::Clock::get();
+  for (size_t pos = 0; pos < stream.size(); pos += block)
+  {
+    size_t n = std::min((size_t)block, stream.size() - pos);
+    parser.parse(data + pos, n, msgs);
+
+    for (size_t i = 0; i < msgs.size(); ++i)
+      delete msgs[i];
+    msgs.clear();
+  }
+
+  return stream.size() / (Time::Clock::get() - start) / (1 << 20);
+}
+
+int
+main(int argc, char** argv)
+{
+  unsigned messages = 100000;
+  if (argc > 1)
+    messages = std::atoi(argv[1]);
+
+  std::string stream = createStream(messages);
+  unsigned blocks[] = {1460, 4096, 65536};
+
+  std::printf("%-8s %16s %16s %8s\n", "block", "byte (MiB/s)", "block (MiB/s)", "speedup");
+  for (unsigned i = 0; i < sizeof(blocks) / sizeof(blocks[0]); ++i)
+  {
+    double byte = benchmarkByte(stream, blocks[i]);
+    double block = benchmarkBlock(stream, blocks[i]);
+    std::printf("%-8u %16.1f %16.1f %7.2fx\n", blocks[i], byte, block, block / byte);
+  }
+
+  return 0;
+}
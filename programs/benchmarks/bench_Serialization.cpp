@@ -0,0 +1,90 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using namespace DUNE;
+
+//! Serialization buffer.
+static uint8_t s_bfr[DUNE_IMC_CONST_MAX_SIZE];
+//! Number of iterations per message.
+static unsigned s_iterations = 100000;
+//! Sink for results, prevents the compiler from eliding work.
+static volatile unsigned s_sink = 0;
+
+//! Measure the cost of (de)serializing the payload of a
+//! default-constructed message.
+template <typename M>
+static void
+benchmark(const char* abbrev)
+{
+  M msg;
+  uint16_t size = msg.getPayloadSerializationSize();
+
+  double start = Time::Clock::get();
+  for (unsigned i = 0; i < s_iterations; ++i)
+    s_sink += (unsigned)(msg.serializeFields(s_bfr) - s_bfr);
+  double ser = Time::Clock::get() - start;
+
+  start = Time::Clock::get();
+  for (unsigned i = 0; i < s_iterations; ++i)
+    s_sink += msg.deserializeFields(s_bfr, size);
+  double des = Time::Clock::get() - start;
+
+  start = Time::Clock::get();
+  for (unsigned i = 0; i < s_iterations; ++i)
+    s_sink += msg.reverseDeserializeFields(s_bfr, size);
+  double rev = Time::Clock::get() - start;
+
+  std::printf("%-32s %6u %12.1f %12.1f %12.1f\n", abbrev, size,
+              ser * 1e9 / s_iterations,
+              des * 1e9 / s_iterations,
+              rev * 1e9 / s_iterations);
+}
+
+int
+main(int argc, char** argv)
+{
+  if (argc > 1)
+    s_iterations = std::atoi(argv[1]);
+
+  std::printf("%-32s %6s %12s %12s %12s\n", "message", "bytes",
+              "ser (ns)", "deser (ns)", "rdeser (ns)");
+
+#define MESSAGE(id, abbrev) benchmark<IMC::abbrev>(#abbrev);
+#include <DUNE/IMC/Factory.def>
+
+  return 0;
+}
@@ -0,0 +1,185 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using namespace DUNE;
+using Network::Address;
+using Network::UDPSocket;
+
+//! Number of datagrams sent before receiving them.
+static const unsigned c_burst = 64;
+//! Maximum number of datagrams per batched system call.
+static const unsigned c_batch_max = 64;
+//! First port to try to bind.
+static const uint16_t c_port = 16002;
+//! Number of ports to try.
+static const uint16_t c_port_retries = 100;
+//! Receive buffer size.
+static const unsigned c_bfr_size = 65535;
+
+//! Benchmark result.
+struct Result
+{
+  //! Messages per second.
+  double rate;
+  //! System calls per message.
+  double syscalls;
+};
+
+//! Number of system calls used to transfer a number of datagrams
+//! with one batched call.
+static unsigned
+getBatchCalls(unsigned count)
+{
+#if defined(DUNE_SYS_HAS_SENDMMSG)
+  return (count + c_batch_max - 1) / c_batch_max;
+#else
+  return count;
+#endif
+}
+
+//! Send bursts of datagrams over the loopback interface and receive
+//! them, one datagram or one batch per call.
+static Result
+benchmark(unsigned messages, bool batch)
+{
+  UDPSocket rx;
+  uint16_t port = c_port;
+  while (true)
+  {
+    try
+    {
+      rx.bind(port, Address::Loopback, false);
+      break;
+    }
+    catch (std::runtime_error& e)
+    {
+      if (++port == c_port + c_port_retries)
+        throw;
+    }
+  }
+
+  UDPSocket tx;
+
+  IMC::EstimatedState state;
+  state.setSource(0x2001);
+  uint8_t pkt[c_bfr_size];
+  uint16_t pkt_size = IMC::Packet::serialize(&state, pkt, sizeof(pkt));
+
+  std::vector<uint8_t> bfr(c_bfr_size * c_burst);
+  std::vector<UDPSocket::Datagram> out(c_burst);
+  std::vector<UDPSocket::Datagram> in(c_burst);
+  for (unsigned i = 0; i < c_burst; ++i)
+  {
+    out[i].data = pkt;
+    out[i].size = pkt_size;
+    out[i].addr = Address(Address::Loopback);
+    out[i].port = port;
+  }
+
+  unsigned received = 0;
+  unsigned calls = 0;
+
+  double start = Time::Clock::get();
+  while (received < messages)
+  {
+    if (batch)
+    {
+      tx.write(&out[0], c_burst);
+      calls += getBatchCalls(c_burst);
+    }
+    else
+    {
+      for (unsigned i = 0; i < c_burst; ++i)
+        tx.write(pkt, pkt_size, Address::Loopback, port);
+      calls += c_burst;
+    }
+
+    unsigned pending = c_burst;
+    while (pending > 0 && IO::Poll::poll(rx, 1.0))
+    {
+      size_t n = 1;
+
+      if (batch)
+      {
+        for (unsigned i = 0; i < pending; ++i)
+        {
+          in[i].data = &bfr[i * c_bfr_size];
+          in[i].size = c_bfr_size;
+        }
+
+        n = rx.read(&in[0], pending);
+      }
+      else
+      {
+        rx.read(&bfr[0], c_bfr_size);
+      }
+
+      ++calls;
+      pending -= n;
+      received += n;
+    }
+
+    if (pending > 0)
+    {
+      std::fprintf(stderr, "lost %u datagrams\n", pending);
+      break;
+    }
+  }
+
+  Result r;
+  r.rate = received / (Time::Clock::get() - start);
+  r.syscalls = calls / (double)received;
+  return r;
+}
+
+int
+main(int argc, char** argv)
+{
+  unsigned messages = 1000000;
+  if (argc > 1)
+    messages = std::atoi(argv[1]);
+
+  Result single = benchmark(messages, false);
+  Result batch = benchmark(messages, true);
+
+  std::printf("%-24s %14s %14s %8s\n", "method", "messages/s", "syscalls/msg", "speedup");
+  std::printf("%-24s %14.0f %14.3f %7.2fx\n", "sendto/recvfrom", single.rate, single.syscalls, 1.0);
+  std::printf("%-24s %14.0f %14.3f %7.2fx\n", "sendmmsg/recvmmsg", batch.rate, batch.syscalls, batch.rate / single.rate);
+
+  return 0;
+}
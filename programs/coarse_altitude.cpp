@@ -102,7 +102,12 @@ main(int32_t argc, char** argv)
 
   try
   {
-    while ((msg = IMC::Packet::deserialize(*is)) != 0)
+    IMC::PacketReader reader(*is);
+    reader.accept(DUNE_IMC_ESTIMATEDSTATE);
+    reader.accept(DUNE_IMC_DESIREDZ);
+    reader.accept(DUNE_IMC_LOGGINGCONTROL);
+
+    while ((msg = reader.next()) != 0)
     {
       if (msg->getId() == DUNE_IMC_ESTIMATEDSTATE)
       {
@@ -160,8 +165,6 @@ main(int32_t argc, char** argv)
         lsf.write(buffer.getBufferSigned(), buffer.getSize());
         buffer.resetBuffer();
       }
-
-      delete msg;
     }
   }
   catch (std::runtime_error& e)
@@ -66,7 +66,12 @@ main(int32_t argc, char** argv)
 
   try
   {
-    while ((msg = IMC::Packet::deserialize(*is)) != 0)
+    IMC::PacketReader reader(*is);
+    reader.accept(DUNE_IMC_EULERANGLES);
+    reader.accept(DUNE_IMC_MAGNETICFIELD);
+    reader.accept(DUNE_IMC_ENTITYINFO);
+
+    while ((msg = reader.next()) != 0)
     {
       if (msg->getId() == DUNE_IMC_EULERANGLES)
       {
@@ -101,8 +106,6 @@ main(int32_t argc, char** argv)
         if (!std::strcmp(ei->label.c_str(), "Compass Calibration Maneuver"))
           ccal_eid = ei->id;
       }
-
-      delete msg;
     }
   }
   catch (std::runtime_error& e)
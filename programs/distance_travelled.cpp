@@ -117,7 +117,9 @@ main(int32_t argc, char** argv)
 
     try
     {
-      while ((msg = IMC::Packet::deserialize(*is)) != 0)
+      IMC::PacketReader reader(*is);
+
+      while ((msg = reader.next()) != 0)
       {
         if (msg->getId() == DUNE_IMC_ANNOUNCE)
         {
@@ -184,13 +186,10 @@ main(int32_t argc, char** argv)
         {
           // since it has simulated state let us ignore this log
           ignore = true;
-          delete msg;
           std::cerr << "this is a simulated log";
           break;
         }
 
-        delete msg;
-
         // ignore idles
         // either has the string _idle or has only the time.
         if (log_name.find("_idle") != std::string::npos ||
@@ -129,7 +129,9 @@ main(int32_t argc, char** argv)
 
     try
     {
-      while ((msg = DUNE::IMC::Packet::deserialize(*is)) != 0)
+      DUNE::IMC::PacketReader reader(*is);
+
+      while ((msg = reader.next()) != 0)
       {
 
         if (msg->getId() == DUNE_IMC_LOGGINGCONTROL)
@@ -204,12 +206,9 @@ main(int32_t argc, char** argv)
         {
           // since it has simulated state let us ignore this log
           ignore = true;
-          delete msg;
           std::cerr << "this is a simulated log";
           break;
         }
-
-        delete msg;
       }
     }
     catch (std::runtime_error& e)
@@ -58,8 +58,6 @@ main(int32_t argc, char** argv)
   ByteBuffer buffer;
   std::ofstream lsf("FilteredData.lsf", std::ios::binary);
 
-  IMC::Message* msg;
-
   uint32_t accum = 0;
 
   bool done_first = false;
@@ -85,32 +83,36 @@ main(int32_t argc, char** argv)
 
     uint32_t i = 0;
 
+    IMC::PacketReader reader(*is);
+    IMC::Header hdr;
+    const uint8_t* data = NULL;
+    unsigned size = 0;
+
     try
     {
-      while ((msg = IMC::Packet::deserialize(*is)) != 0)
+      // Packets are copied verbatim, without being deserialized.
+      while (reader.nextPacket(hdr, data, size))
       {
         if (!done_first)
         {
           // place an empty estimatedstate message in the log
           IMC::EstimatedState state;
-          state.setTimeStamp(msg->getTimeStamp());
+          state.setTimeStamp(hdr.timestamp);
           IMC::Packet::serialize(&state, buffer);
           lsf.write(buffer.getBufferSigned(), buffer.getSize());
           done_first = true;
         }
 
         std::set<uint32_t>::const_iterator it;
-        it = ids.find(msg->getId());
+        it = ids.find(hdr.mgid);
 
         if (it != ids.end())
         {
-          IMC::Packet::serialize(msg, buffer);
-          lsf.write(buffer.getBufferSigned(), buffer.getSize());
+          IMC::PacketReader::validate(hdr, data);
+          lsf.write((const char*)data, size);
 
           ++i;
         }
-
-        delete msg;
       }
     }
     catch (std::runtime_error& e)
@@ -239,7 +239,9 @@ main(int32_t argc, char** argv)
 
   try
   {
-    while ((msg = DUNE::IMC::Packet::deserialize(*is)) != 0)
+    DUNE::IMC::PacketReader reader(*is);
+
+    while ((msg = reader.next()) != 0)
     {
       bool log_it = false;
 
@@ -296,7 +298,6 @@ main(int32_t argc, char** argv)
 
         IMC::Packet::serialize(msg, buffer);
         lsf.write(buffer.getBufferSigned(), buffer.getSize());
-        delete msg;
         continue;
       }
 
@@ -370,8 +371,6 @@ main(int32_t argc, char** argv)
         std::cerr << (float)is->tellg() / file_length * 100.0 << "%" << std::endl;
         prog_timer.reset();
       }
-
-      delete msg;
     }
   }
   catch (std::runtime_error& e)
@@ -143,7 +143,11 @@ class Message:
 
         # serializeFields()
         f = Function('serializeFields', 'uint8_t*', [Var('bfr__', 'uint8_t*')], const = True)
-        if self.has_fields():
+        if self.is_fixed_layout():
+            for field, offset in self.get_field_offsets():
+                f.add_body('IMC::store(%s, bfr__ + %d);' % (get_name(field), offset))
+            f.add_body('return bfr__ + %d;' % self.get_fixed_size())
+        elif self.has_fields():
             f.add_body('uint8_t* ptr__ = bfr__;')
             for field in node.findall('field'):
                 if field.get('type').startswith('message'):
@@ -157,7 +161,12 @@ class Message:
 
         # deserializeFields()
         f = Function('deserializeFields', 'uint16_t', [Var('bfr__', 'const uint8_t*'), Var('size__', 'uint16_t')])
-        if self.has_fields():
+        if self.is_fixed_layout():
+            f.add_body('if (size__ < %d) throw BufferTooShort();' % self.get_fixed_size())
+            for field, offset in self.get_field_offsets():
+                f.add_body('IMC::load(%s, bfr__ + %d);' % (get_name(field), offset))
+            f.add_body('return %d;' % self.get_fixed_size())
+        elif self.has_fields():
             f.add_body('const uint8_t* start__ = bfr__;')
             for field in node.findall('field'):
                 if field.get('type').startswith('message'):
@@ -172,7 +181,15 @@ class Message:
 
         # reverseDeserializeFields()
         f = Function('reverseDeserializeFields', 'uint16_t', [Var('bfr__', 'const uint8_t*'), Var('size__', 'uint16_t')])
-        if self.has_fields():
+        if self.is_fixed_layout():
+            f.add_body('if (size__ < %d) throw BufferTooShort();' % self.get_fixed_size())
+            for field, offset in self.get_field_offsets():
+                if consts['sizes'][field.get('type')] == 1:
+                    f.add_body('IMC::load(%s, bfr__ + %d);' % (get_name(field), offset))
+                else:
+                    f.add_body('IMC::reverseLoad(%s, bfr__ + %d);' % (get_name(field), offset))
+            f.add_body('return %d;' % self.get_fixed_size())
+        elif self.has_fields():
             f.add_body('const uint8_t* start__ = bfr__;')
             for field in node.findall('field'):
                 if consts['sizes'][field.get('type')] == 1:
@@ -339,6 +356,25 @@ class Message:
             size += self._consts['sizes'][field.get('type')]
         return size;
 
+    # Messages with fields of fixed size only are (de)serialized
+    # with a single bounds check and constant field offsets.
+    def is_fixed_layout(self):
+        if not self.has_fields():
+            return False
+        for field in self._node.findall('field'):
+            if not is_fixed(field):
+                return False
+        return True
+
+    # Retrieve a list of (field, offset) pairs.
+    def get_field_offsets(self):
+        offsets = []
+        offset = 0
+        for field in self._node.findall('field'):
+            offsets.append((field, offset))
+            offset += self._consts['sizes'][field.get('type')]
+        return offsets
+
     def get_variable_size(self):
         size = []
         for field in self._node.findall('field'):
@@ -67,7 +67,11 @@ main(int32_t argc, char** argv)
 
   try
   {
-    while ((msg = IMC::Packet::deserialize(*is)) != 0)
+    IMC::PacketReader reader(*is);
+    reader.accept(DUNE_IMC_LOGBOOKENTRY);
+    reader.accept(DUNE_IMC_ENTITYINFO);
+
+    while ((msg = reader.next()) != 0)
     {
       if (msg->getId() == DUNE_IMC_LOGBOOKENTRY)
       {
@@ -92,8 +96,6 @@ main(int32_t argc, char** argv)
         if (!std::strcmp(ei->label.c_str(), "Photo Trigger"))
           phototrigger_eid = ei->id;
       }
-
-      delete msg;
     }
 
     logfile.close();
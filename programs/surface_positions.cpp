@@ -75,7 +75,10 @@ main(int32_t argc, char** argv)
 
   try
   {
-    while ((msg = IMC::Packet::deserialize(*is)) != 0)
+    IMC::PacketReader reader(*is);
+    reader.accept(DUNE_IMC_GPSFIX);
+
+    while ((msg = reader.next()) != 0)
     {
       if (msg->getId() == DUNE_IMC_GPSFIX)
       {
@@ -93,8 +96,6 @@ main(int32_t argc, char** argv)
           ++i;
         }
       }
-
-      delete msg;
     }
   }
   catch (std::runtime_error& e)
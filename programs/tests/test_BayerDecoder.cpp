@@ -0,0 +1,156 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+using namespace DUNE::Media;
+
+//! Image sizes, including widths that are not multiples of the
+//! vector length.
+static const int c_sizes[][2] =
+{
+  {64, 48},
+  {70, 34},
+  {38, 20},
+  {6, 6}
+};
+
+//! Tile formats.
+static const BayerDecoder::Tile c_tiles[] =
+{
+  BayerDecoder::TILE_GBRG,
+  BayerDecoder::TILE_GRBG,
+  BayerDecoder::TILE_RGGB,
+  BayerDecoder::TILE_BGGR
+};
+
+//! Decoding methods.
+static const BayerDecoder::Method c_methods[] =
+{
+  BayerDecoder::METHOD_NEAREST,
+  BayerDecoder::METHOD_BILINEAR,
+  BayerDecoder::METHOD_HQLINEAR
+};
+
+//! Compare vectorized and reference output.
+static bool
+compare(BayerDecoder::Tile tile, BayerDecoder::Method method,
+        const std::vector<uint8_t>& bayer, int width, int height, bool yuv)
+{
+  BayerDecoder reference(tile, method);
+  reference.setAcceleration(false);
+  BayerDecoder vector(tile, method);
+
+  std::vector<uint8_t> rgb(width * height * 3);
+  std::vector<uint8_t> a(yuv ? width * height * 3 / 2 : rgb.size(), 0x55);
+  std::vector<uint8_t> b(a.size(), 0xaa);
+
+  reference.decodeToRGB24(&bayer[0], &rgb[0], width, height);
+  if (yuv)
+  {
+    BayerDecoder::convertToYUV420(&rgb[0], &a[0], width, height);
+    vector.decodeToYUV420(&bayer[0], &b[0], width, height);
+  }
+  else
+  {
+    a = rgb;
+    vector.decodeToRGB24(&bayer[0], &b[0], width, height);
+  }
+
+  return a == b;
+}
+
+int
+main(void)
+{
+  Test test("Media::BayerDecoder");
+  Math::Random::Generator* prng = Math::Random::Factory::create(Math::Random::Factory::c_default, 1);
+
+  test.boolean("isAccelerationAvailable()", BayerDecoder::isAccelerationAvailable()
+#if defined(__SSE2__)
+               == true
+#else
+               == false
+#endif
+               );
+
+  {
+    // Gray images have neutral chroma.
+    std::vector<uint8_t> rgb(8 * 4 * 3, 200);
+    std::vector<uint8_t> yuv(8 * 4 * 3 / 2);
+    BayerDecoder::convertToYUV420(&rgb[0], &yuv[0], 8, 4);
+    test.boolean("convertToYUV420() gray",
+                 yuv[0] == 200 && yuv[31] == 200 && yuv[32] == 128 && yuv[47] == 128);
+  }
+
+  for (unsigned s = 0; s < sizeof(c_sizes) / sizeof(c_sizes[0]); ++s)
+  {
+    int width = c_sizes[s][0];
+    int height = c_sizes[s][1];
+
+    // Random data exercises clipping, a ramp exercises smooth areas.
+    std::vector<uint8_t> noise(width * height);
+    std::vector<uint8_t> ramp(width * height);
+    for (int i = 0; i < width * height; ++i)
+    {
+      noise[i] = (uint8_t)(prng->random() & 0xff);
+      ramp[i] = (uint8_t)((i % width) * 255 / width);
+    }
+
+    bool rgb_ok = true;
+    bool yuv_ok = true;
+    for (unsigned t = 0; t < sizeof(c_tiles) / sizeof(c_tiles[0]); ++t)
+    {
+      for (unsigned m = 0; m < sizeof(c_methods) / sizeof(c_methods[0]); ++m)
+      {
+        rgb_ok = rgb_ok && compare(c_tiles[t], c_methods[m], noise, width, height, false);
+        rgb_ok = rgb_ok && compare(c_tiles[t], c_methods[m], ramp, width, height, false);
+        yuv_ok = yuv_ok && compare(c_tiles[t], c_methods[m], noise, width, height, true);
+        yuv_ok = yuv_ok && compare(c_tiles[t], c_methods[m], ramp, width, height, true);
+      }
+    }
+
+    test.boolean(Utils::String::str("decodeToRGB24() %dx%d", width, height).c_str(), rgb_ok);
+    test.boolean(Utils::String::str("decodeToYUV420() %dx%d", width, height).c_str(), yuv_ok);
+  }
+
+  delete prng;
+
+  return test.getReturnValue();
+}
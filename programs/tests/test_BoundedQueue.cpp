@@ -0,0 +1,131 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE::Concurrency;
+
+//! Number of values pushed by each producer.
+static const unsigned c_values = 100000;
+
+class Producer: public Thread
+{
+public:
+  Producer(BoundedQueue<unsigned>& queue, unsigned id):
+    m_queue(queue),
+    m_id(id)
+  { }
+
+  void
+  run(void)
+  {
+    for (unsigned i = 0; i < c_values; ++i)
+    {
+      while (!m_queue.push(m_id * c_values + i))
+        m_queue.waitForSpace(0.1);
+    }
+  }
+
+private:
+  BoundedQueue<unsigned>& m_queue;
+  unsigned m_id;
+};
+
+int
+main(void)
+{
+  Test test("Concurrency::BoundedQueue");
+
+  {
+    BoundedQueue<unsigned> queue(5);
+    test.boolean("capacity()", queue.capacity() == 8);
+    test.boolean("empty()", queue.empty());
+
+    unsigned pushed = 0;
+    while (queue.push(pushed))
+      ++pushed;
+    test.boolean("push() until full", pushed == 8 && queue.size() == 8);
+
+    unsigned v = 0;
+    bool ordered = true;
+    for (unsigned i = 0; i < 8; ++i)
+      ordered = ordered && queue.pop(v) && v == i;
+    test.boolean("pop() order", ordered);
+    test.boolean("pop() empty", !queue.pop(v) && queue.empty());
+    test.boolean("waitForItems() timeout", !queue.waitForItems(0.01));
+  }
+
+  {
+    const unsigned producers = 4;
+    BoundedQueue<unsigned> queue(64);
+    std::vector<Producer*> threads;
+
+    for (unsigned i = 0; i < producers; ++i)
+    {
+      threads.push_back(new Producer(queue, i));
+      threads.back()->start();
+    }
+
+    // Values of each producer must arrive in order.
+    std::vector<unsigned> next(producers, 0);
+    unsigned received = 0;
+    bool ordered = true;
+
+    while (received < producers * c_values && queue.waitForItems(5.0))
+    {
+      unsigned v = 0;
+      while (queue.pop(v))
+      {
+        unsigned id = v / c_values;
+        ordered = ordered && (v % c_values == next[id]);
+        ++next[id];
+        ++received;
+      }
+    }
+
+    for (unsigned i = 0; i < producers; ++i)
+    {
+      threads[i]->stopAndJoin();
+      delete threads[i];
+    }
+
+    test.boolean("multiple producers (count)", received == producers * c_values);
+    test.boolean("multiple producers (order)", ordered);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,223 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+//! Number of EstimatedState messages, one per second.
+static const unsigned c_count = 3600;
+
+//! Count messages and check timestamps are consecutive.
+static unsigned
+readAll(std::istream& is, double first, bool& valid)
+{
+  IMC::PacketReader reader(is);
+  unsigned count = 0;
+  valid = true;
+
+  IMC::Message* msg = NULL;
+  while ((msg = reader.next()) != NULL)
+  {
+    if (msg->getId() == DUNE_IMC_ESTIMATEDSTATE)
+    {
+      valid = valid && (msg->getTimeStamp() == first + count);
+      ++count;
+    }
+  }
+
+  return count;
+}
+
+int
+main(void)
+{
+  Test test("IMC::ChunkedLog");
+
+  FileSystem::Path file = FileSystem::Path::current() / "test_ChunkedLog.lsfc";
+
+  {
+    IMC::ChunkedLogOutput os(file.c_str(), 16 * 1024, 60.0);
+
+    for (unsigned i = 0; i < c_count; ++i)
+    {
+      IMC::EstimatedState state;
+      state.x = i;
+      state.setTimeStamp(i);
+
+      // Split packets across writes.
+      std::ostringstream packet;
+      IMC::Packet::serialize(&state, packet);
+      std::string data = packet.str();
+      os.write(data.data(), 7);
+      os.write(data.data() + 7, data.size() - 7);
+
+      if (i % 600 == 0)
+      {
+        IMC::LogBookEntry lbe;
+        lbe.text = "checkpoint";
+        lbe.setTimeStamp(i);
+        IMC::Packet::serialize(&lbe, os);
+      }
+    }
+  }
+
+  test.boolean("isChunked()", IMC::ChunkedLogReader::isChunked(file.c_str()));
+
+  {
+    IMC::ChunkedLogInput is(file.c_str());
+    const std::vector<IMC::ChunkedLog::Chunk>& index = is.getReader().getIndex();
+
+    bool spans = true;
+    for (unsigned i = 0; i < index.size(); ++i)
+      spans = spans && (index[i].time_max - index[i].time_min < 60.0);
+
+    test.boolean("index: chunk time span", !index.empty() && spans);
+    test.boolean("index: message ids", index[0].contains(DUNE_IMC_ESTIMATEDSTATE)
+                 && index[0].contains(DUNE_IMC_LOGBOOKENTRY)
+                 && !index[1].contains(DUNE_IMC_LOGBOOKENTRY));
+
+    bool valid = false;
+    test.boolean("read all", readAll(is, 0, valid) == c_count && valid);
+  }
+
+  {
+    IMC::ChunkedLogInput is(file.c_str());
+    is.seek(1800.5);
+
+    unsigned chunk = is.getReader().findChunk(1800.5);
+    double first = is.getReader().getIndex()[chunk].time_min;
+
+    bool valid = false;
+    unsigned count = readAll(is, first, valid);
+    test.boolean("seek()", first <= 1800 && count == c_count - first && valid);
+  }
+
+  {
+    // Drop the index, as if the log was not closed.
+    std::ifstream ifs(file.c_str(), std::ios::binary);
+    std::string data((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    ifs.close();
+
+    IMC::ChunkedLogInput full(file.c_str());
+    const std::vector<IMC::ChunkedLog::Chunk> index = full.getReader().getIndex();
+    uint64_t end = index.back().offset + IMC::ChunkedLog::c_chunk_header_size + index.back().compressed_size;
+
+    FileSystem::Path truncated = FileSystem::Path::current() / "test_ChunkedLog_truncated.lsfc";
+    std::ofstream ofs(truncated.c_str(), std::ios::binary);
+    ofs.write(data.data(), end);
+    ofs.close();
+
+    IMC::ChunkedLogInput is(truncated.c_str());
+    const std::vector<IMC::ChunkedLog::Chunk>& rebuilt = is.getReader().getIndex();
+
+    bool same = rebuilt.size() == index.size();
+    for (unsigned i = 0; same && i < index.size(); ++i)
+    {
+      same = rebuilt[i].offset == index[i].offset
+      && rebuilt[i].time_min == index[i].time_min
+      && rebuilt[i].time_max == index[i].time_max
+      && rebuilt[i].count == index[i].count
+      && rebuilt[i].ids == index[i].ids;
+    }
+
+    test.boolean("rebuild index", same);
+
+    bool valid = false;
+    test.boolean("read all without index", readAll(is, 0, valid) == c_count && valid);
+
+    // Corrupt the uncompressed size of the last chunk.
+    uint32_t bogus = 0xffffffff;
+    std::memcpy(&data[index.back().offset + 4], &bogus, sizeof(bogus));
+    ofs.open(truncated.c_str(), std::ios::binary);
+    ofs.write(data.data(), end);
+    ofs.close();
+
+    IMC::ChunkedLogInput corrupted(truncated.c_str());
+    test.boolean("rebuild index: reject invalid chunk size",
+                 corrupted.getReader().getIndex().size() == index.size() - 1);
+
+    truncated.remove();
+  }
+
+  {
+    // The first chunk ends with a late packet with an old timestamp,
+    // e.g. from another system. Flushing does not end chunks.
+    IMC::EstimatedState state;
+    IMC::ChunkedLogOutput os(file.c_str(), 101 * state.getSerializationSize(), 1000.0);
+
+    for (unsigned i = 0; i < 100; ++i)
+    {
+      state.setTimeStamp(i);
+      IMC::Packet::serialize(&state, os);
+
+      if (i % 10 == 0)
+        os.flush();
+    }
+
+    state.setTimeStamp(0);
+    IMC::Packet::serialize(&state, os);
+
+    for (unsigned i = 100; i < 150; ++i)
+    {
+      state.setTimeStamp(i);
+      IMC::Packet::serialize(&state, os);
+    }
+  }
+
+  {
+    IMC::ChunkedLogInput is(file.c_str());
+    const IMC::ChunkedLogReader& reader = is.getReader();
+
+    test.boolean("index: out of order timestamps",
+                 reader.getIndex().size() == 2
+                 && reader.getIndex()[0].time_min == 0
+                 && reader.getIndex()[0].time_max == 99);
+    test.boolean("findChunk(): out of order timestamps",
+                 reader.findChunk(50) == 0 && reader.findChunk(120) == 1
+                 && reader.findChunk(200) == 2);
+  }
+
+  file.remove();
+
+  return test.getReturnValue();
+}
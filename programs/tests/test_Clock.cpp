@@ -24,61 +24,46 @@
 // https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
 // http://ec.europa.eu/idabc/eupl.html.                                     *
 //***************************************************************************
-// Author: Eduardo Marques                                                  *
+// Author: Ricardo Martins                                                  *
 //***************************************************************************
 
-#ifndef SIMULATORS_ENVIRONMENT_POINT_HPP_INCLUDED_
-#define SIMULATORS_ENVIRONMENT_POINT_HPP_INCLUDED_
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
 
-// ISO C++ 98 headers.
-#include <iomanip>
-#include <cmath>
+// Local headers.
+#include "Test.hpp"
 
-// DUNE headers.
-#include <DUNE/Config.hpp>
+using namespace DUNE::Time;
 
-namespace Simulators
+int
+main(void)
 {
-  namespace Environment
-  {
-    //! Directions for search/insertion
-    enum
-    {
-      DIR_NW, DIR_NE, DIR_SW, DIR_SE
-    };
+  Test test("Time::Clock");
 
-    //! Point structure.
-    struct Point
-    {
-      double x, y;
+  double mono = Clock::get();
+  double epoch = Clock::getSinceEpoch();
 
-      Point(double x_, double y_):
-        x(x_), y(y_) { }
+  Clock::setVirtual(epoch);
+  Clock::setVirtual(epoch + 3600.0);
+  double mono_advance = Clock::get() - mono;
+  double epoch_advance = Clock::getSinceEpoch() - epoch;
+  test.boolean("setVirtual(): clocks agree",
+               Clock::isVirtual() && mono_advance >= 3600.0 && mono_advance < 3601.0
+               && epoch_advance >= 3600.0 && epoch_advance < 3601.0);
 
-      double
-      distance(const Point& other) const
-      {
-        double dx = x - other.x;
-        double dy = y - other.y;
-        return std::sqrt(dx * dx + dy * dy);
-      }
+  Clock::setVirtual(epoch + 60.0);
+  test.boolean("setVirtual(): never goes backwards", Clock::getSinceEpoch() - epoch >= 3600.0);
 
-      template <typename T>
-      int
-      direction(const T& other) const
-      {
-        double dx = other.x - x;
-        double dy = other.y - y;
+  double before = Clock::get();
+  Delay::wait(0.1);
+  test.boolean("setVirtual(): runs at host rate", Clock::get() - before >= 0.09);
 
-        int dir = dx >= 0 ? DIR_NW : DIR_SW;
+  Clock::clearVirtual();
+  uint64_t now = Clock::getNsec();
+  uint64_t diff = Clock::getHostNsec() - now;
+  test.boolean("clearVirtual(): host clocks",
+               !Clock::isVirtual() && diff < 1000000
+               && Clock::getSinceEpoch() - epoch < 60.0);
 
-        if (dy > 0)
-          dir++;      // other is East of this
-
-        return dir;
-      }
-    };
-  }
+  return test.getReturnValue();
 }
-
-#endif
@@ -0,0 +1,202 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: José Braga                                                       *
+//***************************************************************************
+// Test program for DUNE::Math::FixedMatrix and                             *
+// DUNE::Navigation::FixedKalmanFilter.                                     *
+//***************************************************************************
+#include <cmath>
+#include "Test.hpp"
+#include <DUNE/Math/FixedMatrix.hpp>
+#include <DUNE/Math/Matrix.hpp>
+#include <DUNE/Navigation/FixedKalmanFilter.hpp>
+#include <DUNE/Navigation/KalmanFilter.hpp>
+
+using namespace DUNE;
+using namespace DUNE::Math;
+
+//! Number of filter states.
+static const unsigned c_states = 9;
+//! Number of filter outputs.
+static const unsigned c_outputs = 6;
+
+template <unsigned R, unsigned C>
+static bool
+equal(const FixedMatrix<R, C>& a, const Matrix& b, double tol = 1e-9)
+{
+  if ((unsigned)b.rows() != R || (unsigned)b.columns() != C)
+    return false;
+
+  for (unsigned i = 0; i < R; ++i)
+    for (unsigned j = 0; j < C; ++j)
+      if (std::fabs(a(i, j) - b(i, j)) > tol)
+        return false;
+
+  return true;
+}
+
+template <unsigned R, unsigned C>
+static void
+fillPattern(FixedMatrix<R, C>& a, Matrix& b, double seed)
+{
+  b.resizeAndFill(R, C, 0.0);
+  for (unsigned i = 0; i < R; ++i)
+  {
+    for (unsigned j = 0; j < C; ++j)
+    {
+      a(i, j) = std::sin(seed + i * 1.7 + j * 0.3) + (i == j ? 4.0 : 0.0);
+      b(i, j) = a(i, j);
+    }
+  }
+}
+
+int
+main(int argc, char** argv)
+{
+  (void)argc;
+  (void)argv;
+
+  Test test("DUNE::Math::FixedMatrix");
+
+  FixedMatrix<4, 4> fa;
+  FixedMatrix<4, 3> fb;
+  FixedMatrix<4, 4> fc;
+  Matrix ma;
+  Matrix mb;
+  Matrix mc;
+  fillPattern(fa, ma, 0.1);
+  fillPattern(fb, mb, 0.7);
+  fillPattern(fc, mc, 1.3);
+
+  {
+    FixedMatrix<4, 4> r = fa + fc;
+    test.boolean("sum", equal(r, ma + mc));
+  }
+
+  {
+    FixedMatrix<4, 4> r = fa - 2.0 * fc;
+    test.boolean("difference and scaling", equal(r, ma - 2.0 * mc));
+  }
+
+  {
+    FixedMatrix<4, 3> r = fa * fb;
+    test.boolean("product", equal(r, ma * mb));
+  }
+
+  {
+    FixedMatrix<4, 4> r = fa * fc * transpose(fa) + fc;
+    test.boolean("chained product", equal(r, ma * mc * transpose(ma) + mc));
+  }
+
+  {
+    FixedMatrix<3, 3> r = transpose(fb) * fb;
+    test.boolean("transposed product", equal(r, transpose(mb) * mb));
+  }
+
+  {
+    FixedMatrix<4, 4> r = fa;
+    r = 0.5 * (r + transpose(r));
+    test.boolean("aliased assignment", equal(r, 0.5 * (ma + transpose(ma))));
+  }
+
+  {
+    FixedMatrix<4, 4> r = inverse(fa);
+    test.boolean("inverse", equal(r, inverse(ma)));
+
+    FixedMatrix<4, 4> id;
+    id.identity();
+    test.boolean("inverse product", equal(FixedMatrix<4, 4>(fa * r), id.toMatrix()));
+  }
+
+  {
+    bool thrown = false;
+    try
+    {
+      inverse(FixedMatrix<3, 3>(1.0));
+    }
+    catch (Matrix::Error&)
+    {
+      thrown = true;
+    }
+    test.boolean("singular inverse", thrown);
+  }
+
+  {
+    Navigation::KalmanFilter kal;
+    Navigation::FixedKalmanFilter<c_states, c_outputs> fkal;
+
+    kal.reset(c_states, c_outputs);
+
+    Matrix a(c_states);
+    FixedMatrix<c_states, c_states> fa2;
+    fa2.identity();
+    for (unsigned i = 0; i + 1 < c_states; ++i)
+    {
+      a(i, i + 1) = 0.1;
+      fa2(i, i + 1) = 0.1;
+    }
+
+    kal.setTransitions(a);
+    fkal.setTransitions(fa2);
+    kal.setCovariance(1.0);
+    fkal.setCovariance(1.0);
+    kal.setProcessNoise(1e-3);
+    fkal.setProcessNoise(1e-3);
+    kal.setMeasurementNoise(0.1);
+    fkal.setMeasurementNoise(0.1);
+
+    for (unsigned i = 0; i < c_outputs; ++i)
+    {
+      kal.setObservation(i, i, 1.0);
+      fkal.setObservation(i, i, 1.0);
+    }
+
+    bool same = true;
+    for (unsigned step = 0; step < 100; ++step)
+    {
+      kal.predict();
+      fkal.predict();
+
+      for (unsigned i = 0; i < c_outputs; ++i)
+      {
+        double y = std::sin(step * 0.1 + i);
+        kal.setInnovation(i, y - kal.getState(i));
+        fkal.setInnovation(i, y - fkal.getState(i));
+      }
+
+      kal.update(0);
+      fkal.update(0);
+
+      same = same && equal(fkal.getState(), kal.getState(), 1e-6);
+      same = same && equal(fkal.getCovariance(), kal.getCovariance(), 1e-6);
+    }
+
+    test.boolean("Kalman filter equivalence", same);
+  }
+
+  return test.getReturnValue();
+}
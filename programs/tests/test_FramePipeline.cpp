@@ -0,0 +1,185 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE::Media;
+using namespace DUNE::Concurrency;
+
+//! Number of frames pushed through the pipeline.
+static const unsigned c_frames = 2000;
+
+//! Fills the raw buffer with the sequence number.
+class Fill: public FramePipeline::Stage
+{
+public:
+  bool
+  process(FramePipeline::Frame& frame, unsigned worker)
+  {
+    (void)worker;
+    frame.raw.assign(64, (uint8_t)frame.sequence);
+    return true;
+  }
+};
+
+//! Copies raw data to the encoded buffer, discards odd frames.
+class Encode: public FramePipeline::Stage
+{
+public:
+  bool
+  process(FramePipeline::Frame& frame, unsigned worker)
+  {
+    (void)worker;
+    if (frame.sequence % 2)
+      return false;
+
+    frame.encoded = frame.raw;
+    return true;
+  }
+};
+
+//! Records frames that reach the end of the pipeline.
+class Sink: public FramePipeline::Stage
+{
+public:
+  Sink(std::vector<unsigned>& sequences, bool& valid):
+    m_sequences(sequences),
+    m_valid(valid)
+  { }
+
+  bool
+  process(FramePipeline::Frame& frame, unsigned worker)
+  {
+    (void)worker;
+    bool ok = frame.encoded.size() == 64
+      && frame.encoded[63] == (uint8_t)frame.sequence;
+
+    ScopedMutex l(m_lock);
+    m_valid = m_valid && ok;
+    m_sequences.push_back(frame.sequence);
+    return true;
+  }
+
+private:
+  std::vector<unsigned>& m_sequences;
+  bool& m_valid;
+  Mutex m_lock;
+};
+
+int
+main(void)
+{
+  Test test("Media::FramePipeline");
+
+  {
+    FramePipeline pipeline(3, 2);
+    FramePipeline::Frame* frames[4];
+    for (unsigned i = 0; i < 4; ++i)
+      frames[i] = pipeline.acquire();
+
+    test.boolean("acquire() pool", frames[2] != NULL && frames[3] == NULL);
+    test.boolean("acquire() timeout", pipeline.acquire(0.01) == NULL);
+
+    for (unsigned i = 0; i < 3; ++i)
+      pipeline.release(frames[i]);
+    test.boolean("flush() idle", pipeline.flush(0.0));
+  }
+
+  {
+    FramePipeline pipeline(1, 1);
+    pipeline.addStage("Fill", new Fill);
+    FramePipeline::Frame* frame = pipeline.acquire();
+    bool failed = pipeline.acquire() == NULL;
+
+    std::vector<FramePipeline::Statistics> stats;
+    pipeline.getStatistics(stats);
+    test.boolean("acquire() drops", failed && stats[0].drops == 1);
+    pipeline.release(frame);
+  }
+
+  {
+    std::vector<unsigned> sequences;
+    bool valid = true;
+
+    FramePipeline pipeline(8, 4);
+    pipeline.addStage("Fill", new Fill);
+    pipeline.addStage("Encode", new Encode, 3);
+    pipeline.addStage("Sink", new Sink(sequences, valid));
+    pipeline.start();
+
+    unsigned accepted = 0;
+    unsigned accepted_even = 0;
+    for (unsigned i = 0; i < c_frames; ++i)
+    {
+      FramePipeline::Frame* frame = pipeline.acquire(-1.0);
+      frame->sequence = i;
+      if (pipeline.submit(frame))
+      {
+        ++accepted;
+        if (i % 2 == 0)
+          ++accepted_even;
+      }
+    }
+
+    test.boolean("flush()", pipeline.flush(5.0));
+    pipeline.stop();
+
+    std::vector<FramePipeline::Statistics> stats;
+    pipeline.getStatistics(stats);
+
+    test.boolean("statistics stages", stats.size() == 3 && stats[1].workers == 3);
+    test.boolean("statistics input",
+                 stats[0].frames == accepted
+                 && stats[0].frames + stats[0].drops == c_frames);
+    test.boolean("statistics chain",
+                 stats[1].frames == accepted
+                 && stats[2].frames == accepted_even);
+    test.boolean("discarded frames", sequences.size() == accepted_even);
+    test.boolean("frame contents", valid);
+
+    bool even = true;
+    for (unsigned i = 0; i < sequences.size(); ++i)
+      even = even && (sequences[i] % 2 == 0);
+    test.boolean("stage result", even);
+
+    pipeline.resetStatistics();
+    pipeline.getStatistics(stats);
+    test.boolean("resetStatistics()", stats[0].frames == 0 && stats[0].drops == 0);
+  }
+
+  return test.getReturnValue();
+}
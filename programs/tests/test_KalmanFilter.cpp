@@ -0,0 +1,182 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: José Braga                                                       *
+//***************************************************************************
+// Test program for DUNE::Navigation::KalmanFilter class.                   *
+//***************************************************************************
+#include <cmath>
+#include "Test.hpp"
+#include <DUNE/Math/Matrix.hpp>
+#include <DUNE/Navigation/KalmanFilter.hpp>
+
+using namespace DUNE;
+using DUNE::Navigation::KalmanFilter;
+
+//! Number of filter states.
+static const unsigned c_states = 9;
+//! Number of filter outputs, the last two are never active.
+static const unsigned c_outputs = 8;
+
+static void
+setup(KalmanFilter& kal, KalmanFilter::CorrectionMethod method, KalmanFilter::CovarianceForm form)
+{
+  kal.reset(c_states, c_outputs);
+  kal.setCorrectionMethod(method);
+  kal.setCovarianceForm(form);
+
+  Math::Matrix a(c_states);
+  for (unsigned i = 0; i + 1 < c_states; ++i)
+    a(i, i + 1) = 0.1;
+
+  kal.setTransitions(a);
+  kal.setCovariance(1.0);
+  kal.setProcessNoise(1e-3);
+
+  for (unsigned i = 0; i < c_outputs; ++i)
+    kal.setMeasurementNoise(i, 0.1 + 0.01 * i);
+}
+
+static void
+observe(KalmanFilter& kal, unsigned step)
+{
+  kal.resetOutputs();
+
+  for (unsigned i = 0; i < c_outputs - 2; ++i)
+  {
+    kal.setObservation(i, i, 1.0);
+    kal.setObservation(i, (i + 3) % c_states, 0.5);
+    double y = std::sin(step * 0.1 + i);
+    kal.setInnovation(i, y - kal.getState(i) - 0.5 * kal.getState((i + 3) % c_states));
+  }
+
+  // Inactive outputs may hold stale innovations.
+  kal.setInnovation(c_outputs - 1, 100.0);
+}
+
+static bool
+equal(const Math::Matrix& a, const Math::Matrix& b, double tol)
+{
+  if (a.rows() != b.rows() || a.columns() != b.columns())
+    return false;
+
+  for (int i = 0; i < a.rows(); ++i)
+    for (int j = 0; j < a.columns(); ++j)
+      if (std::fabs(a(i, j) - b(i, j)) > tol)
+        return false;
+
+  return true;
+}
+
+static bool
+symmetric(const Math::Matrix& a)
+{
+  for (int i = 0; i < a.rows(); ++i)
+    for (int j = 0; j < i; ++j)
+      if (a(i, j) != a(j, i))
+        return false;
+
+  return true;
+}
+
+int
+main(int argc, char** argv)
+{
+  (void)argc;
+  (void)argv;
+
+  Test test("DUNE::Navigation::KalmanFilter");
+
+  KalmanFilter ref;
+  KalmanFilter seq;
+  KalmanFilter jos;
+  KalmanFilter sjos;
+  setup(ref, KalmanFilter::CM_BATCH, KalmanFilter::CF_STANDARD);
+  setup(seq, KalmanFilter::CM_SEQUENTIAL, KalmanFilter::CF_STANDARD);
+  setup(jos, KalmanFilter::CM_BATCH, KalmanFilter::CF_JOSEPH);
+  setup(sjos, KalmanFilter::CM_SEQUENTIAL, KalmanFilter::CF_JOSEPH);
+
+  bool seq_ok = true;
+  bool jos_ok = true;
+  bool sjos_ok = true;
+  bool sym_ok = true;
+
+  for (unsigned step = 0; step < 200; ++step)
+  {
+    KalmanFilter* filters[] = {&ref, &seq, &jos, &sjos};
+    for (unsigned f = 0; f < 4; ++f)
+    {
+      filters[f]->predict();
+      observe(*filters[f], step);
+      filters[f]->update(0);
+    }
+
+    seq_ok = seq_ok && equal(seq.getState(), ref.getState(), 1e-9);
+    seq_ok = seq_ok && equal(seq.getCovariance(), ref.getCovariance(), 1e-9);
+    jos_ok = jos_ok && equal(jos.getState(), ref.getState(), 1e-9);
+    jos_ok = jos_ok && equal(jos.getCovariance(), ref.getCovariance(), 1e-9);
+    sjos_ok = sjos_ok && equal(sjos.getState(), ref.getState(), 1e-9);
+    sjos_ok = sjos_ok && equal(sjos.getCovariance(), ref.getCovariance(), 1e-9);
+    sym_ok = sym_ok && symmetric(sjos.getCovariance());
+  }
+
+  test.boolean("sequential update", seq_ok);
+  test.boolean("Joseph form update", jos_ok);
+  test.boolean("sequential Joseph form update", sjos_ok);
+  test.boolean("sequential Joseph form symmetry", sym_ok);
+
+  // Innovation gating must take the same decision in both methods,
+  // as long as inactive outputs hold no innovation.
+  {
+    KalmanFilter* filters[] = {&ref, &seq};
+    int rv[2];
+    Math::Matrix x[2];
+    for (unsigned f = 0; f < 2; ++f)
+    {
+      filters[f]->predict();
+      observe(*filters[f], 0);
+      for (unsigned i = 0; i < c_outputs; ++i)
+        filters[f]->setInnovation(i, 0.0);
+      filters[f]->setInnovation(0, 2.0);
+      x[f] = filters[f]->getState();
+      rv[f] = filters[f]->update(3.0);
+    }
+
+    test.boolean("rejected innovation", rv[0] == -1 && rv[1] == -1);
+    test.boolean("rejected innovation keeps state", equal(seq.getState(), x[1], 0.0));
+
+    for (unsigned f = 0; f < 2; ++f)
+    {
+      filters[f]->setInnovation(0, 0.1);
+      rv[f] = filters[f]->update(3.0);
+    }
+
+    test.boolean("accepted innovation", rv[0] == 0 && rv[1] == 0);
+    test.boolean("accepted innovation state", equal(seq.getState(), ref.getState(), 1e-9));
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,298 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+//! Simulated time, in milliseconds, and name of a participant run.
+typedef std::pair<uint64_t, std::string> Event;
+
+//! Runs of all participants.
+static std::vector<Event> s_events;
+//! Lock protecting s_events.
+static Concurrency::Mutex s_lock;
+//! Number of threads that joined the scheduler.
+static Concurrency::AtomicCounter s_joined;
+//! Simulated time when the scheduler was enabled (ns).
+static uint64_t s_start = 0;
+
+//! Participant running at a fixed period.
+class Ticker: public Concurrency::Thread
+{
+public:
+  Ticker(const std::string& name, unsigned period, unsigned count):
+    m_name(name),
+    m_period(period),
+    m_count(count)
+  { }
+
+  void
+  run(void)
+  {
+    Time::Lockstep::join(m_name);
+    s_joined.add(1);
+
+    for (unsigned i = 0; i < m_count; ++i)
+    {
+      Time::Delay::waitMsec(m_period);
+
+      Concurrency::ScopedMutex l(s_lock);
+      s_events.push_back(Event((Time::Clock::getNsec() - s_start) / 1000000, m_name));
+    }
+
+    Time::Lockstep::leave();
+  }
+
+private:
+  std::string m_name;
+  unsigned m_period;
+  unsigned m_count;
+};
+
+//! Thread that sleeps without joining the scheduler.
+class Sleeper: public Concurrency::Thread
+{
+public:
+  Sleeper(unsigned period):
+    woken(0),
+    m_period(period)
+  { }
+
+  void
+  run(void)
+  {
+    s_joined.add(1);
+    Time::Delay::waitMsec(m_period);
+    woken = (Time::Clock::getNsec() - s_start) / 1000000;
+  }
+
+  //! Simulated time of wake up (ms).
+  uint64_t woken;
+
+private:
+  unsigned m_period;
+};
+
+//! Reactive task whose consumer sleeps on simulated time.
+class Consumer: public Tasks::AbstractTask
+{
+public:
+  Consumer(Tasks::Context& ctx):
+    woken(0),
+    m_recipient(this, ctx)
+  {
+    m_recipient.bind(IMC::EstimatedState::getIdStatic(),
+                     new Tasks::Consumer<Consumer, IMC::EstimatedState>(*this, &Consumer::consume));
+    // Mark the recipient reactive before messages are queued.
+    m_recipient.waitForMessages(0);
+  }
+
+  ~Consumer(void)
+  {
+    m_recipient.unbindAll();
+  }
+
+  void
+  receive(const IMC::Message* msg)
+  {
+    m_recipient.put(msg);
+  }
+
+  void
+  consume(const IMC::EstimatedState* msg)
+  {
+    (void)msg;
+    Time::Delay::waitMsec(500);
+    woken.store((Time::Clock::getNsec() - s_start) / 1000000);
+  }
+
+  const char*
+  getName(void) const
+  {
+    return "Consumer";
+  }
+
+  void inf(const char*, ...) { }
+  void war(const char*, ...) { }
+  void err(const char*, ...) { }
+  void cri(const char*, ...) { }
+  void debug(const char*, ...) { }
+  void trace(const char*, ...) { }
+  void spew(const char*, ...) { }
+
+  //! Simulated time of wake up in consume() (ms).
+  Concurrency::AtomicValue<uint64_t> woken;
+
+protected:
+  void
+  run(void)
+  {
+    s_joined.add(1);
+    while (woken.load() == 0 && !isStopping())
+      m_recipient.waitForMessages(0.1);
+  }
+
+private:
+  Tasks::Recipient m_recipient;
+};
+
+//! Wait for a number of threads to start.
+static void
+waitForThreads(int count)
+{
+  while (s_joined.add(0) < count)
+    Time::Delay::waitHostNsec(1000000);
+}
+
+//! Run two tickers and a sleeper.
+//! @param sleeper simulated time of sleeper wake up (ms).
+//! @return runs of participants.
+static std::vector<Event>
+simulate(uint64_t& sleeper)
+{
+  s_events.clear();
+  s_joined.sub(s_joined.add(0));
+
+  Time::Lockstep::enable();
+  s_start = Time::Clock::getNsec();
+
+  // Hold the clock until every thread is ready.
+  Time::Lockstep::join("main");
+
+  Ticker a("a", 100, 100);
+  Ticker b("b", 250, 40);
+  Sleeper s(5000);
+  a.start();
+  b.start();
+  s.start();
+  waitForThreads(3);
+
+  Time::Lockstep::leave();
+
+  a.join();
+  b.join();
+  s.join();
+  Time::Lockstep::disable();
+
+  sleeper = s.woken;
+  return s_events;
+}
+
+int
+main(void)
+{
+  Test test("Time::Lockstep");
+
+  {
+    uint64_t now = Time::Clock::getNsec();
+    uint64_t diff = Time::Clock::getHostNsec() - now;
+    test.boolean("disabled: host clock", !Time::Lockstep::isEnabled() && diff < 1000000);
+  }
+
+  {
+    std::vector<Event> expected;
+    for (unsigned i = 1; i <= 100; ++i)
+      expected.push_back(Event(i * 100, "a"));
+    for (unsigned i = 1; i <= 40; ++i)
+      expected.push_back(Event(i * 250, "b"));
+    std::sort(expected.begin(), expected.end());
+
+    uint64_t sleeper = 0;
+    double start = Time::Clock::get();
+    std::vector<Event> first = simulate(sleeper);
+    double elapsed = Time::Clock::get() - start;
+
+    test.boolean("enabled: runs in deadline and name order", first == expected);
+    test.boolean("enabled: faster than real time", elapsed < 2.0);
+    test.boolean("enabled: sleepers never wake up early", sleeper >= 5000);
+
+    std::vector<Event> second = simulate(sleeper);
+    test.boolean("enabled: deterministic", first == second);
+  }
+
+  {
+    Time::Lockstep::enable();
+    s_start = Time::Clock::getNsec();
+    uint64_t epoch = Time::Clock::getSinceEpochNsec();
+    s_joined.sub(s_joined.add(0));
+
+    Time::Lockstep::hold();
+    Sleeper s(1000);
+    s.start();
+    waitForThreads(1);
+    Time::Delay::waitHostNsec(100000000);
+    bool held = (Time::Clock::getNsec() == s_start) && (s.woken == 0);
+
+    Time::Lockstep::release();
+    s.join();
+    uint64_t elapsed = Time::Clock::getSinceEpochNsec() - epoch;
+    Time::Lockstep::disable();
+
+    test.boolean("hold(): clock does not advance", held);
+    test.boolean("release(): clock advances", s.woken == 1000);
+    test.boolean("getSinceEpochNsec(): simulated", elapsed == 1000000000);
+  }
+
+  {
+    Time::Lockstep::enable();
+    s_start = Time::Clock::getNsec();
+    s_joined.sub(s_joined.add(0));
+
+    Tasks::Context ctx;
+    Consumer c(ctx);
+    c.start();
+    waitForThreads(1);
+
+    IMC::EstimatedState msg;
+    c.receive(&msg);
+
+    // Wait up to two seconds of host time for consume() to return.
+    for (unsigned i = 0; i < 200 && c.woken.load() == 0; ++i)
+      Time::Delay::waitHostNsec(10000000);
+    uint64_t woken = c.woken.load();
+
+    // Wake up the consumer if it is stuck.
+    Time::Lockstep::disable();
+    c.stopAndJoin();
+
+    test.boolean("claim(): consumer may sleep", woken == 500);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,175 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+//! Produce compressible data.
+static std::string
+createData(unsigned size)
+{
+  std::string data(size, 0);
+  for (unsigned i = 0; i < size; ++i)
+    data[i] = (char)((i / 16) % 64 + (i % 7));
+  return data;
+}
+
+int
+main(void)
+{
+  Test test("Compression::Lz4");
+
+  std::string data = createData(300 * 1024);
+
+  Compression::Lz4Compressor com;
+  Utils::ByteBuffer cdata = com.compress((char*)data.data(), data.size());
+  test.boolean("compress()", cdata.getSize() > 0 && cdata.getSize() < data.size());
+
+  {
+    // Feed the compressed stream in small, misaligned pieces into a
+    // small output buffer.
+    Compression::Lz4Decompressor dec;
+    std::string out;
+    std::vector<char> bfr(1000);
+    unsigned long idx = 0;
+    bool progress = true;
+
+    while (progress && idx < cdata.getSize())
+    {
+      unsigned long len = std::min(cdata.getSize() - idx, 777UL);
+      char* src = cdata.getBufferSigned() + idx;
+      progress = false;
+
+      do
+      {
+        dec.decompress(&bfr[0], bfr.size(), src, len);
+        out.append(&bfr[0], dec.decompressed());
+        src += dec.processed();
+        len -= dec.processed();
+        idx += dec.processed();
+
+        if (dec.decompressed() > 0 || dec.processed() > 0)
+          progress = true;
+      }
+      while (dec.decompressed() > 0 || dec.processed() > 0);
+    }
+
+    test.boolean("decompress() in pieces", out == data);
+  }
+
+  {
+    // Feed the compressed stream one byte at a time. Every byte is
+    // consumed exactly once and pending output is retrieved without
+    // more input.
+    Compression::Lz4Decompressor dec;
+    std::string out;
+    std::vector<char> bfr(1000);
+    bool consumed = true;
+
+    for (unsigned long idx = 0; idx < cdata.getSize(); ++idx)
+    {
+      unsigned long len = 1;
+      do
+      {
+        dec.decompress(&bfr[0], bfr.size(), cdata.getBufferSigned() + idx, len);
+        out.append(&bfr[0], dec.decompressed());
+        len -= dec.processed();
+      }
+      while (len > 0 && dec.decompressed() > 0);
+
+      consumed = consumed && len == 0;
+
+      while (dec.hasPendingOutput())
+      {
+        dec.decompress(&bfr[0], bfr.size(), cdata.getBufferSigned(), 0);
+        out.append(&bfr[0], dec.decompressed());
+      }
+    }
+
+    test.boolean("decompress() byte by byte", consumed && out == data
+                 && dec.processedTotal() == cdata.getSize());
+  }
+
+  {
+    Compression::Lz4Decompressor dec;
+    cdata.getBufferSigned()[0] = 'X';
+    bool thrown = false;
+
+    try
+    {
+      dec.decompress(cdata.getBufferSigned(), cdata.getSize());
+    }
+    catch (Compression::CorruptedData&)
+    {
+      thrown = true;
+    }
+
+    test.boolean("corrupted data", thrown);
+  }
+
+  FileSystem::Path file = FileSystem::Path::current() / "test_Lz4.lz4b";
+
+  {
+    Compression::FileOutput ofs(file.c_str(), Compression::METHOD_LZ4);
+    for (unsigned i = 0; i < 4; ++i)
+      ofs.write(data.data(), data.size());
+  }
+
+  test.boolean("Factory::detect()", Compression::Factory::detect(file.c_str()) == Compression::METHOD_LZ4);
+
+  {
+    // Small reads leave decoded data pending after the last input
+    // byte was read from the file.
+    Compression::FileInput ifs(file.c_str(), Compression::METHOD_LZ4);
+    std::vector<char> bfr(1000);
+    std::string out;
+
+    while (ifs.read(&bfr[0], bfr.size()) || ifs.gcount() > 0)
+      out.append(&bfr[0], ifs.gcount());
+
+    test.boolean("FileOutput/FileInput", out == data + data + data + data);
+  }
+
+  file.remove();
+
+  return test.getReturnValue();
+}
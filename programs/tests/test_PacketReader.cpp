@@ -0,0 +1,187 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <sstream>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+//! Number of messages of each type written to the log.
+static const unsigned c_count = 20000;
+
+//! Produce a log with interleaved EstimatedState and Rpm messages.
+static std::string
+createLog(void)
+{
+  std::ostringstream os;
+
+  for (unsigned i = 0; i < c_count; ++i)
+  {
+    IMC::EstimatedState state;
+    state.x = i;
+    state.setTimeStamp(i);
+    IMC::Packet::serialize(&state, os);
+
+    IMC::Rpm rpm;
+    rpm.value = i % 1000;
+    rpm.setTimeStamp(i);
+    IMC::Packet::serialize(&rpm, os);
+  }
+
+  return os.str();
+}
+
+int
+main(void)
+{
+  Test test("IMC::PacketReader");
+  std::string log = createLog();
+
+  {
+    std::istringstream is(log);
+    IMC::PacketReader reader(is);
+    unsigned states = 0;
+    unsigned rpms = 0;
+    bool valid = true;
+
+    IMC::Message* msg = NULL;
+    while ((msg = reader.next()) != NULL)
+    {
+      if (msg->getId() == DUNE_IMC_ESTIMATEDSTATE)
+      {
+        IMC::EstimatedState* state = static_cast<IMC::EstimatedState*>(msg);
+        valid = valid && (state->x == states) && (state->getTimeStamp() == states);
+        ++states;
+      }
+      else if (msg->getId() == DUNE_IMC_RPM)
+      {
+        valid = valid && (static_cast<IMC::Rpm*>(msg)->value == (int)(rpms % 1000));
+        ++rpms;
+      }
+    }
+
+    test.boolean("next(): all messages", states == c_count && rpms == c_count);
+    test.boolean("next(): message contents", valid);
+  }
+
+  {
+    std::istringstream is(log);
+    IMC::PacketReader reader(is);
+    reader.accept(DUNE_IMC_RPM);
+
+    unsigned rpms = 0;
+    bool valid = true;
+    IMC::Message* msg = NULL;
+    while ((msg = reader.next()) != NULL)
+    {
+      valid = valid && (msg->getId() == DUNE_IMC_RPM);
+      ++rpms;
+    }
+
+    test.boolean("accept(): only accepted messages", valid && rpms == c_count);
+  }
+
+  {
+    std::istringstream is(log);
+    IMC::PacketReader reader(is);
+
+    IMC::Header hdr;
+    const uint8_t* data = NULL;
+    unsigned size = 0;
+    reader.nextPacket(hdr, data, size);
+
+    Utils::ByteBuffer bfr;
+    IMC::EstimatedState state;
+    state.x = 0;
+    state.setTimeStamp(0);
+    IMC::Packet::serialize(&state, bfr);
+
+    test.boolean("nextPacket(): verbatim packet",
+                 size == bfr.getSize() && std::memcmp(data, bfr.getBuffer(), size) == 0);
+  }
+
+  {
+    std::string corrupted(log);
+    corrupted[DUNE_IMC_CONST_HEADER_SIZE] ^= 0xff;
+    std::istringstream is(corrupted);
+    IMC::PacketReader reader(is);
+
+    IMC::Header hdr;
+    const uint8_t* data = NULL;
+    unsigned size = 0;
+    reader.nextPacket(hdr, data, size);
+
+    bool thrown = false;
+    try
+    {
+      IMC::PacketReader::validate(hdr, data);
+    }
+    catch (IMC::InvalidCrc&)
+    {
+      thrown = true;
+    }
+
+    test.boolean("validate(): corrupted packet", thrown);
+  }
+
+  {
+    std::istringstream is(log.substr(0, log.size() - 1));
+    IMC::PacketReader reader(is);
+
+    bool thrown = false;
+    try
+    {
+      while (reader.next() != NULL)
+      { }
+    }
+    catch (IMC::BufferTooShort&)
+    {
+      thrown = true;
+    }
+
+    test.boolean("next(): truncated packet", thrown);
+  }
+
+  {
+    std::istringstream is("");
+    IMC::PacketReader reader(is);
+    test.boolean("next(): empty stream", reader.next() == NULL);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,213 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+//! Number of messages in the stream.
+static const unsigned c_count = 2000;
+
+//! Produce a stream of EstimatedState and LogBookEntry messages.
+static std::string
+createStream(void)
+{
+  std::ostringstream os;
+
+  for (unsigned i = 0; i < c_count; ++i)
+  {
+    if (i % 2)
+    {
+      IMC::LogBookEntry lbe;
+      lbe.text = std::string(i % 300, 'x');
+      lbe.setTimeStamp(i);
+      IMC::Packet::serialize(&lbe, os);
+    }
+    else
+    {
+      IMC::EstimatedState state;
+      state.x = i;
+      state.setTimeStamp(i);
+      IMC::Packet::serialize(&state, os);
+    }
+  }
+
+  return os.str();
+}
+
+//! Check that messages are the ones produced by createStream and
+//! release them.
+static bool
+check(std::vector<IMC::Message*>& msgs)
+{
+  bool valid = (msgs.size() == c_count);
+
+  for (unsigned i = 0; i < msgs.size(); ++i)
+  {
+    IMC::Message* m = msgs[i];
+    valid = valid && (m->getTimeStamp() == i);
+
+    if (i % 2)
+      valid = valid && (m->getId() == DUNE_IMC_LOGBOOKENTRY)
+      && (static_cast<IMC::LogBookEntry*>(m)->text.size() == i % 300);
+    else
+      valid = valid && (m->getId() == DUNE_IMC_ESTIMATEDSTATE)
+      && (static_cast<IMC::EstimatedState*>(m)->x == i);
+
+    delete m;
+  }
+
+  msgs.clear();
+  return valid;
+}
+
+//! Parse a stream in blocks of varying size.
+static void
+parseBlocks(IMC::Parser& parser, const std::string& stream, std::vector<IMC::Message*>& msgs)
+{
+  const uint8_t* data = (const uint8_t*)stream.data();
+  size_t pos = 0;
+
+  for (unsigned i = 0; pos < stream.size(); ++i)
+  {
+    size_t n = std::min((size_t)(1 + (i * 37) % 311), stream.size() - pos);
+    parser.parse(data + pos, n, msgs);
+    pos += n;
+  }
+}
+
+int
+main(void)
+{
+  Test test("IMC::Parser");
+  std::string stream = createStream();
+  const uint8_t* data = (const uint8_t*)stream.data();
+  std::vector<IMC::Message*> msgs;
+
+  {
+    IMC::Parser parser;
+    for (size_t i = 0; i < stream.size(); ++i)
+    {
+      IMC::Message* m = parser.parse(data[i]);
+      if (m)
+        msgs.push_back(m);
+    }
+
+    test.boolean("parse(byte): all messages", check(msgs));
+  }
+
+  {
+    IMC::Parser parser;
+    size_t n = parser.parse(data, stream.size(), msgs);
+    test.boolean("parse(block): single block", n == c_count && check(msgs));
+  }
+
+  {
+    IMC::Parser parser;
+    parseBlocks(parser, stream, msgs);
+    test.boolean("parse(block): split blocks", check(msgs));
+  }
+
+  {
+    IMC::Parser parser;
+    for (size_t i = 0; i < stream.size(); ++i)
+      parser.parse(data + i, 1, msgs);
+
+    test.boolean("parse(block): one byte blocks", check(msgs));
+  }
+
+  {
+    IMC::Parser parser;
+    for (size_t i = 0; i < stream.size(); ++i)
+    {
+      if ((i / 100) % 2)
+      {
+        parser.parse(data + i, 1, msgs);
+      }
+      else
+      {
+        IMC::Message* m = parser.parse(data[i]);
+        if (m)
+          msgs.push_back(m);
+      }
+    }
+
+    test.boolean("parse(block): mixed with parse(byte)", check(msgs));
+  }
+
+  {
+    // Garbage that includes a sync number and a truncated header
+    // before the stream.
+    std::string garbage("\x01\xfe\x54\x02\x03\x54", 6);
+    IMC::Parser parser;
+    parseBlocks(parser, garbage + stream, msgs);
+    test.boolean("parse(block): leading garbage", check(msgs));
+  }
+
+  {
+    // Corrupt the payload of the first message.
+    std::string corrupted(stream);
+    corrupted[DUNE_IMC_CONST_HEADER_SIZE] ^= 0xff;
+
+    IMC::Parser parser;
+    parseBlocks(parser, corrupted, msgs);
+
+    bool valid = (msgs.size() == c_count - 1) && (msgs[0]->getTimeStamp() == 1);
+    for (size_t i = 0; i < msgs.size(); ++i)
+      delete msgs[i];
+    msgs.clear();
+
+    test.boolean("parse(block): corrupted packet", valid);
+  }
+
+  {
+    IMC::Parser parser;
+    size_t half = stream.size() / 2;
+    parser.parse(data, half, msgs);
+    size_t first = msgs.size();
+    parser.reset();
+    for (size_t i = 0; i < msgs.size(); ++i)
+      delete msgs[i];
+    msgs.clear();
+
+    parser.parse(data, stream.size(), msgs);
+    test.boolean("reset(): discard incomplete packet", first > 0 && check(msgs));
+  }
+
+  return test.getReturnValue();
+}
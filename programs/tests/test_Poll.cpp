@@ -0,0 +1,127 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// POSIX headers.
+#include <unistd.h>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+//! Number of pipes in the polling pool.
+static const unsigned c_pipes = 64;
+
+int
+main(void)
+{
+  Test test("IO::Poll");
+
+  std::vector<int> rd(c_pipes);
+  std::vector<int> wr(c_pipes);
+  for (unsigned i = 0; i < c_pipes; ++i)
+  {
+    int fds[2];
+    if (pipe(fds) != 0)
+      return 1;
+    rd[i] = fds[0];
+    wr[i] = fds[1];
+  }
+
+  char c = 'x';
+
+  {
+    IO::Poll poll;
+    for (unsigned i = 0; i < c_pipes; ++i)
+      poll.add(rd[i]);
+
+    test.boolean("poll(): timeout", !poll.poll(0.01) && poll.getTriggered().empty());
+
+    write(wr[3], &c, 1);
+    write(wr[42], &c, 1);
+
+    bool ready = poll.poll(1.0);
+    test.boolean("poll(): ready handles", ready && poll.getTriggered().size() == 2);
+    test.boolean("wasTriggered()", poll.wasTriggered(rd[3]) && poll.wasTriggered(rd[42])
+                 && !poll.wasTriggered(rd[0]) && !poll.wasTriggered(rd[3], IO::Poll::EV_WRITE));
+
+    // Level-triggered: unread data is reported again.
+    read(rd[3], &c, 1);
+    poll.poll(1.0);
+    test.boolean("poll(): level-triggered", poll.getTriggered().size() == 1
+                 && poll.wasTriggered(rd[42]) && !poll.wasTriggered(rd[3]));
+
+    poll.remove(rd[42]);
+    test.boolean("remove()", !poll.wasTriggered(rd[42]) && !poll.poll(0.01));
+    read(rd[42], &c, 1);
+  }
+
+  {
+    IO::Poll poll;
+    poll.add(rd[0], IO::Poll::EV_READ);
+    poll.add(wr[0], IO::Poll::EV_WRITE);
+
+    test.boolean("poll(): write readiness", poll.poll(1.0) && poll.wasTriggered(wr[0], IO::Poll::EV_WRITE)
+                 && !poll.wasTriggered(rd[0]));
+
+    poll.modify(wr[0], 0);
+    test.boolean("modify()", !poll.poll(0.01));
+  }
+
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+  {
+    IO::Poll poll;
+    poll.add(rd[1], IO::Poll::EV_READ | IO::Poll::EV_EDGE);
+
+    write(wr[1], &c, 1);
+    bool first = poll.poll(1.0);
+    bool second = poll.poll(0.01);
+    test.boolean("poll(): edge-triggered", first && !second);
+  }
+#endif
+
+  test.boolean("poll(handle): timeout", !IO::Poll::poll(rd[2], 0.01));
+  write(wr[2], &c, 1);
+  test.boolean("poll(handle): ready", IO::Poll::poll(rd[2], 1.0));
+
+  for (unsigned i = 0; i < c_pipes; ++i)
+  {
+    close(rd[i]);
+    close(wr[i]);
+  }
+
+  return test.getReturnValue();
+}
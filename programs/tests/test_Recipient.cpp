@@ -0,0 +1,145 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+//! Minimal task that records the received Temperature values.
+class Sink: public Tasks::AbstractTask
+{
+public:
+  Sink(Tasks::Context& ctx, Tasks::BindMode mode):
+    recipient(this, ctx)
+  {
+    recipient.bind(IMC::Temperature::getIdStatic(),
+                   new Tasks::Consumer<Sink, IMC::Temperature>(*this, &Sink::consume),
+                   mode);
+  }
+
+  void
+  receive(const IMC::Message* msg)
+  {
+    recipient.put(msg);
+  }
+
+  void
+  receive(IMC::SharedMessage* msg)
+  {
+    recipient.put(msg);
+  }
+
+  void
+  consume(const IMC::Temperature* msg)
+  {
+    values.push_back(msg->value);
+  }
+
+  const char*
+  getName(void) const
+  {
+    return "Sink";
+  }
+
+  void inf(const char*, ...) { }
+  void war(const char*, ...) { }
+  void err(const char*, ...) { }
+  void cri(const char*, ...) { }
+  void debug(const char*, ...) { }
+  void trace(const char*, ...) { }
+  void spew(const char*, ...) { }
+
+  Tasks::Recipient recipient;
+  std::vector<float> values;
+
+protected:
+  void
+  run(void)
+  { }
+};
+
+static void
+publish(Tasks::Context& ctx, unsigned count)
+{
+  IMC::Temperature msg;
+  for (unsigned i = 0; i < count; ++i)
+  {
+    msg.setSourceEntity(1 + (i % 2));
+    msg.value = i;
+    ctx.mbus.dispatch(&msg);
+  }
+}
+
+int
+main(void)
+{
+  Test test("Tasks::Recipient");
+  Tasks::Context ctx;
+
+  {
+    Sink sink(ctx, Tasks::BM_QUEUE);
+    publish(ctx, 10);
+    sink.recipient.runCallBacks();
+    test.boolean("BM_QUEUE delivers all", sink.values.size() == 10);
+  }
+
+  {
+    Sink sink(ctx, Tasks::BM_LATEST);
+    publish(ctx, 10);
+    sink.recipient.runCallBacks();
+    test.boolean("BM_LATEST delivers one per source", sink.values.size() == 2);
+    test.boolean("BM_LATEST delivers latest values",
+                 sink.values.size() == 2 && sink.values[0] == 8 && sink.values[1] == 9);
+
+    publish(ctx, 3);
+    sink.recipient.runCallBacks();
+    test.boolean("BM_LATEST after consumption", sink.values.size() == 4);
+  }
+
+  {
+    Sink sink(ctx, Tasks::BM_QUEUE);
+    sink.recipient.setMailbox(4, Tasks::Recipient::OVERFLOW_DROP_OLDEST);
+    publish(ctx, 10);
+    sink.recipient.runCallBacks();
+    test.boolean("OVERFLOW_DROP_OLDEST keeps newest",
+                 sink.values.size() == 4 && sink.values[0] == 6);
+    test.boolean("drop counter", sink.recipient.getDropCount() == 6);
+    test.boolean("high-water mark", sink.recipient.getHighWaterMark() == 4);
+  }
+
+  return test.getReturnValue();
+}
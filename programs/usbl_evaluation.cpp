@@ -78,7 +78,13 @@ main(int32_t argc, char** argv)
 
     try
     {
-      while ((msg = DUNE::IMC::Packet::deserialize(*is)) != 0)
+      DUNE::IMC::PacketReader reader(*is);
+      reader.accept(DUNE_IMC_LOGGINGCONTROL);
+      reader.accept(DUNE_IMC_ESTIMATEDSTATE);
+      reader.accept(DUNE_IMC_USBLFIXEXTENDED);
+      reader.accept(DUNE_IMC_USBLFIX);
+
+      while ((msg = reader.next()) != 0)
       {
         if (msg->getId() == DUNE_IMC_LOGGINGCONTROL)
         {
@@ -129,8 +135,6 @@ main(int32_t argc, char** argv)
             m_sum_bearings += b;
           }
         }
-
-        delete msg;
       }
     }
     catch (std::runtime_error& e)
@@ -59,7 +59,10 @@ main(int argc, char** argv)
 
   try
   {
-    while ((msg = DUNE::IMC::Packet::deserialize(*is)) != 0)
+    DUNE::IMC::PacketReader reader(*is);
+    reader.accept(DUNE_IMC_COMPRESSEDIMAGE);
+
+    while ((msg = reader.next()) != 0)
     {
       if (msg->getId() == DUNE_IMC_COMPRESSEDIMAGE)
       {
@@ -69,8 +72,6 @@ main(int argc, char** argv)
         std::ofstream ofs(fname.c_str(), std::ios::binary);
         ofs.write(&(img->data[0]), img->data.size());
       }
-
-      delete msg;
     }
   }
   catch (std::runtime_error& e)
@@ -0,0 +1,83 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Utility to convert LSF files to chunked LSF containers.                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdlib>
+#include <iostream>
+#include <fstream>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+using DUNE_NAMESPACES;
+
+int
+main(int argc, char** argv)
+{
+  if (argc < 3 || argc > 4)
+  {
+    std::cerr << "Usage: " << argv[0] << " Data.lsf[.gz] Data.lsfc [chunk size in KiB]" << std::endl;
+    return 1;
+  }
+
+  unsigned chunk_size = IMC::ChunkedLog::c_chunk_size;
+  if (argc == 4)
+    chunk_size = std::atoi(argv[3]) * 1024;
+
+  std::istream* is = 0;
+  Compression::Methods method = Compression::Factory::detect(argv[1]);
+  if (method == METHOD_UNKNOWN)
+    is = new std::ifstream(argv[1], std::ios::binary);
+  else
+    is = new Compression::FileInput(argv[1], method);
+
+  IMC::ChunkedLogOutput os(argv[2], chunk_size);
+  IMC::PacketReader reader(*is);
+  IMC::Header hdr;
+  const uint8_t* data = NULL;
+  unsigned size = 0;
+
+  try
+  {
+    while (reader.nextPacket(hdr, data, size))
+    {
+      IMC::PacketReader::validate(hdr, data);
+      os.write((const char*)data, size);
+    }
+  }
+  catch (std::runtime_error& e)
+  {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+  }
+
+  delete is;
+
+  return 0;
+}
@@ -51,6 +51,7 @@ usage(void)
             << "\t-v [0-2]: verbosity level\n\n"
             << "f1 ... fn can be:\n"
             << "\t* Gzipped LSF files (.gz extension)\n"
+            << "\t* Chunked LSF files (.lsfc extension)\n"
             << "\t* LLF log dir names (will look for Data.lsf.gz in it)\n"
             << "\t* plain LSF files\n";
 }
@@ -196,9 +197,14 @@ main(int argc, char** argv)
 
     if (file.isDirectory())
     {
-      file = file / "Data.lsf";
-      if (!file.isFile())
-        file += ".gz";
+      if ((file / "Data.lsfc").isFile())
+        file = file / "Data.lsfc";
+      else
+      {
+        file = file / "Data.lsf";
+        if (!file.isFile())
+          file += ".gz";
+      }
     }
 
     if (!file.isFile())
@@ -207,15 +213,19 @@ main(int argc, char** argv)
       return 1;
     }
 
+    IMC::ChunkedLogInput* chunked = NULL;
     Compression::Methods method = Compression::Factory::detect(file.c_str());
-    if (method == METHOD_UNKNOWN)
+    if (IMC::ChunkedLogReader::isChunked(file.c_str()))
+      is = chunked = new IMC::ChunkedLogInput(file.c_str());
+    else if (method == METHOD_UNKNOWN)
       is = new std::ifstream(file.c_str(), std::ios::binary);
     else
       is = new Compression::FileInput(file.c_str(), method);
 
+    IMC::PacketReader reader(*is);
     IMC::Message* m;
 
-    m = IMC::Packet::deserialize(*is);
+    m = reader.next();
     if (!m)
     {
       std::cerr << file << " contains no messages\n";
@@ -226,16 +236,42 @@ main(int argc, char** argv)
     DUNE::Utils::ByteBuffer bb;
 
     double time_origin = m->getTimeStamp();
+
+    // Skip messages that will not be replayed.
+    if (filtering)
+    {
+      std::map<std::string, bool>::iterator itr = filter.begin();
+      for (; itr != filter.end(); ++itr)
+      {
+        try
+        {
+          reader.accept(IMC::Factory::getIdFromAbbrev(itr->first));
+        }
+        catch (...)
+        {
+          std::cerr << "Unknown message: " << itr->first << '\n';
+          delete is;
+          return 1;
+        }
+      }
+    }
+
     if (begin >= 0)
     {
-      do
+      // Skip chunks before the begin time.
+      if (chunked != NULL && begin > 0)
+      {
+        chunked->seek(time_origin + begin);
+        reader.reset();
+        m = reader.next();
+      }
+
+      while (m)
       {
         if (m->getTimeStamp() - time_origin >= begin)
           break;
-        delete m;
-        m = IMC::Packet::deserialize(*is);
+        m = reader.next();
       }
-      while (m);
 
       if (!m)
       {
@@ -282,12 +318,10 @@ main(int argc, char** argv)
           m->toText(std::cout);
       }
 
-      delete m;
-
       if (end >= 0 && vtime >= end)
         break;
     }
-    while ((m = IMC::Packet::deserialize(*is)) != 0);
+    while ((m = reader.next()) != 0);
     delete is;
   }
   return 0;
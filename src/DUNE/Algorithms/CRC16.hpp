@@ -42,6 +42,10 @@ namespace DUNE
 
     extern const uint16_t c_crc16_ibm_table[256];
 
+    //! Tables for processing eight bytes per step. Entry k of a
+    //! byte is the CRC of that byte followed by k zero bytes.
+    extern const uint16_t c_crc16_ibm_slices[8][256];
+
     //! CRC-16-IBM Algorithm.
     //! The polynomial used is x^16 + x^15 + x^2 + 1 (0x8005)
     class CRC16
@@ -55,6 +59,15 @@ namespace DUNE
       static inline uint16_t
       compute(const uint8_t* buffer, uint16_t len, uint16_t crc = 0)
       {
+        const uint16_t (*t)[256] = c_crc16_ibm_slices;
+
+        for (; len >= 8; len -= 8, buffer += 8)
+        {
+          crc = t[7][(crc ^ buffer[0]) & 0xff] ^ t[6][((crc >> 8) ^ buffer[1]) & 0xff]
+          ^ t[5][buffer[2]] ^ t[4][buffer[3]] ^ t[3][buffer[4]]
+          ^ t[2][buffer[5]] ^ t[1][buffer[6]] ^ t[0][buffer[7]];
+        }
+
         while (len--)
           crc = (crc >> 8) ^ c_crc16_ibm_table[(crc ^ *buffer++) & 0xff];
 
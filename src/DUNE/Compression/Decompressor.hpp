@@ -95,6 +95,16 @@ namespace DUNE
         return m_unprocessed;
       }
 
+      //! Test if decompressed data did not fit the destination
+      //! buffer and is waiting to be retrieved. Call decompress()
+      //! again, with or without more input, to retrieve it.
+      //! @return true if there is pending output, false otherwise.
+      virtual bool
+      hasPendingOutput(void) const
+      {
+        return false;
+      }
+
     protected:
       virtual unsigned long
       decompressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len, unsigned long& unprocessed_len) = 0;
@@ -36,8 +36,10 @@
 #include <DUNE/Compression/ZlibCompressor.hpp>
 #include <DUNE/Compression/GzipCompressor.hpp>
 #include <DUNE/Compression/Bzip2Compressor.hpp>
+#include <DUNE/Compression/Lz4Compressor.hpp>
 #include <DUNE/Compression/ZlibDecompressor.hpp>
 #include <DUNE/Compression/Bzip2Decompressor.hpp>
+#include <DUNE/Compression/Lz4Decompressor.hpp>
 #include <DUNE/Compression/Factory.hpp>
 
 namespace DUNE
@@ -56,6 +58,9 @@ namespace DUNE
       if (name == "bzip2")
         return METHOD_BZIP2;
 
+      if (name == "lz4")
+        return METHOD_LZ4;
+
       return METHOD_UNKNOWN;
     }
 
@@ -70,6 +75,8 @@ namespace DUNE
           return "gzip";
         case METHOD_BZIP2:
           return "bzip2";
+        case METHOD_LZ4:
+          return "lz4";
         case METHOD_UNKNOWN:
           break;
       }
@@ -88,6 +95,8 @@ namespace DUNE
           return ".gz";
         case METHOD_BZIP2:
           return ".bz2";
+        case METHOD_LZ4:
+          return ".lz4b";
         case METHOD_UNKNOWN:
           break;
       }
@@ -105,9 +114,9 @@ namespace DUNE
     Factory::detect(const char* fname)
     {
       std::ifstream ifs(fname, std::ios::binary);
-      uint8_t bfr[2] = {0};
+      uint8_t bfr[4] = {0};
 
-      ifs.read((char*)bfr, 2);
+      ifs.read((char*)bfr, 4);
 
       if (std::memcmp("\x1f\x8b", bfr, 2) == 0)
         return METHOD_GZIP;
@@ -118,6 +127,9 @@ namespace DUNE
       if (std::memcmp("BZ", bfr, 2) == 0)
         return METHOD_BZIP2;
 
+      if (std::memcmp("LZ4B", bfr, 4) == 0)
+        return METHOD_LZ4;
+
       return METHOD_UNKNOWN;
     }
 
@@ -132,6 +144,8 @@ namespace DUNE
           return new GzipCompressor;
         case METHOD_BZIP2:
           return new Bzip2Compressor;
+        case METHOD_LZ4:
+          return new Lz4Compressor;
         default:
           break;
       }
@@ -156,6 +170,8 @@ namespace DUNE
           return new ZlibDecompressor(true);
         case METHOD_BZIP2:
           return new Bzip2Decompressor;
+        case METHOD_LZ4:
+          return new Lz4Decompressor;
         default:
           break;
       }
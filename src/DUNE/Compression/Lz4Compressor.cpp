@@ -0,0 +1,80 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// DUNE headers.
+#include <DUNE/Utils/ByteCopy.hpp>
+#include <DUNE/Compression/Exceptions.hpp>
+#include <DUNE/Compression/Lz4Compressor.hpp>
+
+// LZ4 headers.
+#include <lz4/lz4.h>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    unsigned long
+    Lz4Compressor::compressBound(unsigned long length) const
+    {
+      unsigned long blocks = length / c_max_block_size + 1;
+      return length + length / 255 + blocks * (16 + c_header_size);
+    }
+
+    unsigned long
+    Lz4Compressor::compressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len)
+    {
+      unsigned long dst_idx = 0;
+
+      while (src_len > 0)
+      {
+        uint32_t size = (src_len > c_max_block_size) ? c_max_block_size : src_len;
+
+        if (dst_len - dst_idx < c_header_size + (unsigned long)LZ4_compressBound(size))
+          throw BufferTooShort(dst_len);
+
+        char* block = dst + dst_idx;
+        int rv = LZ4_compress(src, block + c_header_size, size);
+        if (rv <= 0)
+          throw Error("LZ4 compression failed");
+
+        uint32_t csize = rv;
+        Utils::ByteCopy::toLE(c_magic, (uint8_t*)block);
+        Utils::ByteCopy::toLE(size, (uint8_t*)block + 4);
+        Utils::ByteCopy::toLE(csize, (uint8_t*)block + 8);
+
+        dst_idx += c_header_size + csize;
+        src += size;
+        src_len -= size;
+      }
+
+      return dst_idx;
+    }
+  }
+}
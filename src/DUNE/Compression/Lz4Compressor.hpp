@@ -0,0 +1,80 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+#ifndef DUNE_COMPRESSION_LZ4_COMPRESSOR_HPP_INCLUDED_
+#define DUNE_COMPRESSION_LZ4_COMPRESSOR_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Compression/Compressor.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Lz4Compressor;
+
+    //! LZ4 compressor. Data is written as a sequence of independent
+    //! blocks, each one preceded by a header with a magic number
+    //! ("LZ4B"), the uncompressed size and the compressed size (all
+    //! little-endian 32-bit values). Blocks can be concatenated
+    //! freely, which allows streaming through StreamBuffer.
+    //!
+    //! This framing is specific to DUNE and is not the LZ4 frame
+    //! format understood by the lz4 command line tool, hence files
+    //! use the ".lz4b" extension instead of ".lz4".
+    class Lz4Compressor: public Compressor
+    {
+    public:
+      //! Block magic number ("LZ4B" when stored in little-endian).
+      static const uint32_t c_magic = 0x42345a4c;
+      //! Size of the block header.
+      static const unsigned c_header_size = 12;
+      //! Maximum uncompressed size of a block.
+      static const unsigned c_max_block_size = 16 * 1024 * 1024;
+
+      //! Constructor. LZ4 has a single compression level, the
+      //! argument is accepted for interface compatibility.
+      Lz4Compressor(int a_level = -1):
+        Compressor(a_level)
+      { }
+
+    protected:
+      virtual unsigned long
+      compressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len);
+
+      virtual unsigned long
+      compressBound(unsigned long length) const;
+    };
+  }
+}
+
+#endif
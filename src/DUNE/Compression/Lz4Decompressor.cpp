@@ -0,0 +1,162 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Utils/ByteCopy.hpp>
+#include <DUNE/Compression/Exceptions.hpp>
+#include <DUNE/Compression/Lz4Compressor.hpp>
+#include <DUNE/Compression/Lz4Decompressor.hpp>
+
+// LZ4 headers.
+#include <lz4/lz4.h>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    //! Parse and validate a block header.
+    //! @param[in] bfr header.
+    //! @param[out] size uncompressed size.
+    //! @return compressed size.
+    static uint32_t
+    parseHeader(const char* bfr, uint32_t& size)
+    {
+      uint32_t magic = 0;
+      uint32_t csize = 0;
+      Utils::ByteCopy::fromLE(magic, (const uint8_t*)bfr);
+      Utils::ByteCopy::fromLE(size, (const uint8_t*)bfr + 4);
+      Utils::ByteCopy::fromLE(csize, (const uint8_t*)bfr + 8);
+
+      if (magic != Lz4Compressor::c_magic
+          || size > Lz4Compressor::c_max_block_size
+          || csize > (uint32_t)LZ4_compressBound(size))
+        throw CorruptedData();
+
+      return csize;
+    }
+
+    Lz4Decompressor::Lz4Decompressor(void):
+      Decompressor(),
+      m_output_idx(0)
+    { }
+
+    bool
+    Lz4Decompressor::fill(char*& src, unsigned long& src_len, size_t size)
+    {
+      if (m_input.size() < size)
+      {
+        size_t count = std::min((unsigned long)(size - m_input.size()), src_len);
+        m_input.insert(m_input.end(), src, src + count);
+        src += count;
+        src_len -= count;
+      }
+
+      return m_input.size() >= size;
+    }
+
+    unsigned long
+    Lz4Decompressor::decode(const char* block, char* dst, unsigned long dst_len)
+    {
+      uint32_t size = 0;
+      uint32_t csize = parseHeader(block, size);
+      const char* data = block + Lz4Compressor::c_header_size;
+
+      // Decompress straight into the caller's buffer when it fits.
+      if (size <= dst_len)
+      {
+        if (LZ4_decompress_safe(data, dst, csize, size) != (int)size)
+          throw CorruptedData();
+        return size;
+      }
+
+      m_output.resize(size);
+      if (LZ4_decompress_safe(data, &m_output[0], csize, size) != (int)size)
+        throw CorruptedData();
+
+      std::memcpy(dst, &m_output[0], dst_len);
+      m_output_idx = dst_len;
+      return dst_len;
+    }
+
+    unsigned long
+    Lz4Decompressor::decompressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len, unsigned long& unprocessed_len)
+    {
+      unsigned long written = 0;
+
+      while (written < dst_len)
+      {
+        // Drain leftovers of the previous block.
+        if (m_output_idx < m_output.size())
+        {
+          unsigned long count = std::min((unsigned long)(m_output.size() - m_output_idx), dst_len - written);
+          std::memcpy(dst + written, &m_output[m_output_idx], count);
+          m_output_idx += count;
+          written += count;
+          continue;
+        }
+
+        m_output.clear();
+        m_output_idx = 0;
+
+        // Complete block available in the input buffer: decode in place.
+        uint32_t size = 0;
+        if (m_input.empty() && src_len >= Lz4Compressor::c_header_size)
+        {
+          unsigned long block_len = Lz4Compressor::c_header_size + parseHeader(src, size);
+          if (src_len >= block_len)
+          {
+            written += decode(src, dst + written, dst_len - written);
+            src += block_len;
+            src_len -= block_len;
+            continue;
+          }
+        }
+
+        // Otherwise accumulate the block.
+        if (!fill(src, src_len, Lz4Compressor::c_header_size))
+          break;
+
+        unsigned long block_len = Lz4Compressor::c_header_size + parseHeader(&m_input[0], size);
+        if (!fill(src, src_len, block_len))
+          break;
+
+        written += decode(&m_input[0], dst + written, dst_len - written);
+        m_input.clear();
+      }
+
+      unprocessed_len = src_len;
+      return written;
+    }
+  }
+}
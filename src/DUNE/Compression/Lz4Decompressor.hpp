@@ -0,0 +1,96 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+#ifndef DUNE_COMPRESSION_LZ4_DECOMPRESSOR_HPP_INCLUDED_
+#define DUNE_COMPRESSION_LZ4_DECOMPRESSOR_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Compression/Decompressor.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Lz4Decompressor;
+
+    //! LZ4 decompressor for data produced by Lz4Compressor. Input
+    //! may be split at arbitrary positions: incomplete blocks are
+    //! kept internally until the rest of the block is supplied, and
+    //! decoded data that does not fit the destination buffer is kept
+    //! until retrieved (see hasPendingOutput()).
+    class Lz4Decompressor: public Decompressor
+    {
+    public:
+      Lz4Decompressor(void);
+
+      bool
+      hasPendingOutput(void) const
+      {
+        return m_output_idx < m_output.size();
+      }
+
+    protected:
+      virtual unsigned long
+      decompressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len, unsigned long& unprocessed_len);
+
+    private:
+      //! Incomplete block.
+      std::vector<char> m_input;
+      //! Decompressed data that did not fit the caller's buffer.
+      std::vector<char> m_output;
+      //! Read index of m_output.
+      size_t m_output_idx;
+
+      //! Move input bytes to m_input until it holds 'size' bytes.
+      //! @param[in,out] src input buffer.
+      //! @param[in,out] src_len size of input buffer.
+      //! @param[in] size required size.
+      //! @return true if m_input holds at least 'size' bytes, false
+      //! otherwise.
+      bool
+      fill(char*& src, unsigned long& src_len, size_t size);
+
+      //! Decompress one complete block.
+      //! @param[in] block block, including header.
+      //! @param[out] dst destination buffer.
+      //! @param[in] dst_len size of destination buffer.
+      //! @return number of bytes written to dst.
+      unsigned long
+      decode(const char* block, char* dst, unsigned long dst_len);
+    };
+  }
+}
+
+#endif
@@ -126,7 +126,7 @@ namespace DUNE
 
       while (chunk_rem > 0)
       {
-        if (m_get_bfr_rem == 0)
+        if (m_get_bfr_rem == 0 && !m_dec->hasPendingOutput())
         {
           if (m_istream->eof())
           {
@@ -40,6 +40,7 @@ namespace DUNE
 #include <DUNE/Concurrency/Exceptions.hpp>
 #include <DUNE/Concurrency/AtomicInteger.hpp>
 #include <DUNE/Concurrency/AtomicCounter.hpp>
+#include <DUNE/Concurrency/AtomicValue.hpp>
 #include <DUNE/Concurrency/Mutex.hpp>
 #include <DUNE/Concurrency/ScopedMutex.hpp>
 #include <DUNE/Concurrency/RWLock.hpp>
@@ -53,6 +54,8 @@ namespace DUNE
 #include <DUNE/Concurrency/Scheduler.hpp>
 #include <DUNE/Concurrency/Constants.hpp>
 #include <DUNE/Concurrency/TSQueue.hpp>
+#include <DUNE/Concurrency/EventCount.hpp>
+#include <DUNE/Concurrency/BoundedQueue.hpp>
 #include <DUNE/Concurrency/Process.hpp>
 #include <DUNE/Concurrency/SharedMemory.hpp>
 #include <DUNE/Concurrency/Semaphore.hpp>
@@ -0,0 +1,160 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+#ifndef DUNE_CONCURRENCY_ATOMIC_VALUE_HPP_INCLUDED_
+#define DUNE_CONCURRENCY_ATOMIC_VALUE_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Initializer.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+
+// Check if we can use GCC's atomic functions.
+#if defined(__ATOMIC_ACQUIRE) && defined(__ATOMIC_RELEASE)
+#  ifndef DUNE_CONCURRENCY_ATOMIC_VALUE_GCC
+#    define DUNE_CONCURRENCY_ATOMIC_VALUE_GCC
+#  endif
+#endif
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    //! Word sized value (pointer, integer or boolean) with atomic
+    //! load, store and compare-and-swap operations. Loads have
+    //! acquire semantics and stores have release semantics, making
+    //! this class suitable to publish immutable objects to lock-free
+    //! readers.
+    template <typename T>
+    class AtomicValue
+    {
+    public:
+      //! Constructor.
+      //! @param value initial value.
+      AtomicValue(T value = T()):
+        m_value(value)
+      { }
+
+      //! Atomically read the current value.
+      //! @return current value.
+      inline T
+      load(void) const
+      {
+        // GCC implementation.
+#if defined(DUNE_CONCURRENCY_ATOMIC_VALUE_GCC)
+        return __atomic_load_n(&m_value, __ATOMIC_ACQUIRE);
+
+        // Generic implementation.
+#else
+        ScopedMutex lock(m_lock);
+        return m_value;
+#endif
+      }
+
+      //! Atomically replace the current value.
+      //! @param value new value.
+      inline void
+      store(T value)
+      {
+        // GCC implementation.
+#if defined(DUNE_CONCURRENCY_ATOMIC_VALUE_GCC)
+        __atomic_store_n(&m_value, value, __ATOMIC_RELEASE);
+
+        // Generic implementation.
+#else
+        ScopedMutex lock(m_lock);
+        m_value = value;
+#endif
+      }
+
+      //! Atomically replace the current value, returning the
+      //! previous one.
+      //! @param value new value.
+      //! @return previous value.
+      inline T
+      exchange(T value)
+      {
+        // GCC implementation.
+#if defined(DUNE_CONCURRENCY_ATOMIC_VALUE_GCC)
+        return __atomic_exchange_n(&m_value, value, __ATOMIC_ACQ_REL);
+
+        // Generic implementation.
+#else
+        ScopedMutex lock(m_lock);
+        T rv = m_value;
+        m_value = value;
+        return rv;
+#endif
+      }
+
+      //! Replace the current value if it matches an expected value.
+      //! @param expected expected value.
+      //! @param value new value.
+      //! @return true if the value was replaced, false otherwise.
+      inline bool
+      compareAndSwap(T expected, T value)
+      {
+        // GCC implementation.
+#if defined(DUNE_CONCURRENCY_ATOMIC_VALUE_GCC)
+        return __atomic_compare_exchange_n(&m_value, &expected, value, false,
+                                           __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+
+        // Generic implementation.
+#else
+        ScopedMutex lock(m_lock);
+        if (m_value != expected)
+          return false;
+
+        m_value = value;
+        return true;
+#endif
+      }
+
+    private:
+      //! Internal value.
+      T m_value;
+
+#if !defined(DUNE_CONCURRENCY_ATOMIC_VALUE_GCC)
+      //! Explicit lock for generic implementation.
+      mutable Mutex m_lock;
+#endif
+
+      //! Non - copyable.
+      AtomicValue(const AtomicValue&);
+
+      //! Non - assignable.
+      AtomicValue&
+      operator=(const AtomicValue&);
+    };
+  }
+}
+
+#endif
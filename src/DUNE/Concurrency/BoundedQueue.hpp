@@ -0,0 +1,253 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+#ifndef DUNE_CONCURRENCY_BOUNDED_QUEUE_HPP_INCLUDED_
+#define DUNE_CONCURRENCY_BOUNDED_QUEUE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/AtomicValue.hpp>
+#include <DUNE/Concurrency/EventCount.hpp>
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    //! Lock-free, fixed capacity FIFO for multiple producers and
+    //! consumers. Storage is allocated once at construction; push()
+    //! and pop() never allocate memory or take locks. Each slot
+    //! carries a sequence number that tells producers and consumers
+    //! whether it is free or holds a value, so that concurrent
+    //! operations only contend on the head or tail index.
+    template <typename T>
+    class BoundedQueue
+    {
+    public:
+      //! Constructor.
+      //! @param capacity maximum number of elements, rounded up to
+      //! the next power of two.
+      BoundedQueue(unsigned capacity):
+        m_head(0),
+        m_tail(0)
+      {
+        unsigned size = 2;
+        while (size < capacity)
+          size <<= 1;
+
+        m_mask = size - 1;
+        m_cells = new Cell[size];
+        for (unsigned i = 0; i < size; ++i)
+          m_cells[i].sequence.store(i);
+      }
+
+      //! Destructor.
+      ~BoundedQueue(void)
+      {
+        delete [] m_cells;
+      }
+
+      //! Retrieve the maximum number of elements of the queue.
+      //! @return capacity.
+      inline unsigned
+      capacity(void) const
+      {
+        return m_mask + 1;
+      }
+
+      //! Retrieve the number of elements currently in the queue.
+      //! This value is approximate while other threads are pushing
+      //! or popping.
+      //! @return number of elements.
+      inline unsigned
+      size(void) const
+      {
+        unsigned long tail = m_tail.load();
+        unsigned long head = m_head.load();
+        return (tail > head) ? (unsigned)(tail - head) : 0;
+      }
+
+      //! Verify if the queue has elements.
+      //! @return true if the queue has no elements, false otherwise.
+      inline bool
+      empty(void) const
+      {
+        return size() == 0;
+      }
+
+      //! Add an element to the end of the queue and wake any
+      //! consumers that are waiting.
+      //! @param v element.
+      //! @return true if the element was added, false if the queue
+      //! is full.
+      bool
+      push(const T& v)
+      {
+        unsigned long pos = m_tail.load();
+        Cell* cell = NULL;
+
+        for (;;)
+        {
+          cell = &m_cells[pos & m_mask];
+          long diff = (long)cell->sequence.load() - (long)pos;
+
+          if (diff == 0)
+          {
+            if (m_tail.compareAndSwap(pos, pos + 1))
+              break;
+          }
+          else if (diff < 0)
+          {
+            return false;
+          }
+
+          pos = m_tail.load();
+        }
+
+        cell->value = v;
+        cell->sequence.store(pos + 1);
+        m_items.post();
+        return true;
+      }
+
+      //! Remove the first element of the queue.
+      //! @param v element.
+      //! @return true if an element was removed, false if the queue
+      //! is empty.
+      bool
+      pop(T& v)
+      {
+        unsigned long pos = m_head.load();
+        Cell* cell = NULL;
+
+        for (;;)
+        {
+          cell = &m_cells[pos & m_mask];
+          long diff = (long)cell->sequence.load() - (long)(pos + 1);
+
+          if (diff == 0)
+          {
+            if (m_head.compareAndSwap(pos, pos + 1))
+              break;
+          }
+          else if (diff < 0)
+          {
+            return false;
+          }
+
+          pos = m_head.load();
+        }
+
+        v = cell->value;
+        cell->sequence.store(pos + m_mask + 1);
+        m_space.post();
+        return true;
+      }
+
+      //! Wait for items to be available.
+      //! @param timeout timeout in seconds, measured on the host
+      //! clock, use a negative number to wait forever.
+      //! @return true if at least one element is available, false
+      //! otherwise.
+      bool
+      waitForItems(double timeout = -1.0)
+      {
+        if (!empty())
+          return true;
+
+        unsigned key = m_items.prepareWait();
+        if (!empty())
+        {
+          m_items.cancelWait();
+          return true;
+        }
+
+        m_items.wait(key, timeout);
+        return !empty();
+      }
+
+      //! Wait for the queue to have room for at least one element.
+      //! @param timeout timeout in seconds, measured on the host
+      //! clock, use a negative number to wait forever.
+      //! @return true if there is room for one element, false
+      //! otherwise.
+      bool
+      waitForSpace(double timeout = -1.0)
+      {
+        if (size() < capacity())
+          return true;
+
+        unsigned key = m_space.prepareWait();
+        if (size() < capacity())
+        {
+          m_space.cancelWait();
+          return true;
+        }
+
+        m_space.wait(key, timeout);
+        return size() < capacity();
+      }
+
+    private:
+      //! Queue slot.
+      struct Cell
+      {
+        //! Sequence number.
+        AtomicValue<unsigned long> sequence;
+        //! Element.
+        T value;
+      };
+
+      //! Slots.
+      Cell* m_cells;
+      //! Index mask (capacity - 1).
+      unsigned long m_mask;
+      //! Position of the next element to pop.
+      AtomicValue<unsigned long> m_head;
+      //! Position of the next element to push.
+      AtomicValue<unsigned long> m_tail;
+      //! Signaled when elements are pushed.
+      EventCount m_items;
+      //! Signaled when elements are popped.
+      EventCount m_space;
+
+      //! Non - copyable.
+      BoundedQueue(const BoundedQueue&);
+
+      //! Non - assignable.
+      BoundedQueue&
+      operator=(const BoundedQueue&);
+    };
+  }
+}
+
+#endif
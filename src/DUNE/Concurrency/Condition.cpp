@@ -96,7 +96,7 @@ namespace DUNE
 
       if (t > 0)
       {
-        t += m_clock_monotonic ? Time::Clock::get() : Time::Clock::getSinceEpoch();
+        t += (m_clock_monotonic ? Time::Clock::getHostNsec() : Time::Clock::getHostSinceEpochNsec()) / Time::c_nsec_per_sec_fp;
 
         timespec ts = DUNE_TIMESPEC_INIT_SEC_FP(t);
         rv = pthread_cond_timedwait(&m_cond, &m_mutex, &ts);
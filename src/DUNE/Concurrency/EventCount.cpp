@@ -0,0 +1,175 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <cerrno>
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Concurrency/EventCount.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/Utils.hpp>
+
+// Linux headers.
+#if defined(DUNE_SYS_HAS_LINUX_FUTEX_H)
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#  include <climits>
+#endif
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    EventCount::EventCount(void):
+      m_value(0),
+      m_waiters(0)
+    { }
+
+#if defined(DUNE_SYS_HAS_LINUX_FUTEX_H)
+
+    unsigned
+    EventCount::prepareWait(void)
+    {
+      // Full barrier: the caller re-checks its condition after this.
+      __sync_add_and_fetch(&m_waiters, 1);
+      return __atomic_load_n(&m_value, __ATOMIC_ACQUIRE);
+    }
+
+    void
+    EventCount::cancelWait(void)
+    {
+      __sync_sub_and_fetch(&m_waiters, 1);
+    }
+
+    bool
+    EventCount::wait(unsigned key, double timeout)
+    {
+      double deadline = (timeout < 0) ? -1.0 : Time::Clock::getHostNsec() / Time::c_nsec_per_sec_fp + timeout;
+      bool posted = true;
+
+      while ((unsigned)__atomic_load_n(&m_value, __ATOMIC_ACQUIRE) == key)
+      {
+        timespec* tsp = NULL;
+        timespec ts;
+
+        if (deadline >= 0)
+        {
+          double remaining = deadline - Time::Clock::getHostNsec() / Time::c_nsec_per_sec_fp;
+          if (remaining <= 0)
+          {
+            posted = false;
+            break;
+          }
+
+          ts.tv_sec = (time_t)remaining;
+          ts.tv_nsec = (long)((remaining - ts.tv_sec) * Time::c_nsec_per_sec);
+          tsp = &ts;
+        }
+
+        syscall(SYS_futex, &m_value, FUTEX_WAIT_PRIVATE, (int)key, tsp, NULL, 0);
+      }
+
+      __sync_sub_and_fetch(&m_waiters, 1);
+      return posted;
+    }
+
+    void
+    EventCount::post(void)
+    {
+      // Pairs with the barrier in prepareWait().
+      __sync_synchronize();
+      if (__atomic_load_n(&m_waiters, __ATOMIC_RELAXED) == 0)
+        return;
+
+      __sync_add_and_fetch(&m_value, 1);
+      syscall(SYS_futex, &m_value, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+    }
+
+#else
+
+    unsigned
+    EventCount::prepareWait(void)
+    {
+      ScopedCondition l(m_cond);
+      ++m_waiters;
+      return m_value;
+    }
+
+    void
+    EventCount::cancelWait(void)
+    {
+      ScopedCondition l(m_cond);
+      --m_waiters;
+    }
+
+    bool
+    EventCount::wait(unsigned key, double timeout)
+    {
+      double deadline = (timeout < 0) ? -1.0 : Time::Clock::getHostNsec() / Time::c_nsec_per_sec_fp + timeout;
+      bool posted = true;
+
+      ScopedCondition l(m_cond);
+      while ((unsigned)m_value == key)
+      {
+        if (deadline < 0)
+        {
+          m_cond.wait();
+          continue;
+        }
+
+        double remaining = deadline - Time::Clock::getHostNsec() / Time::c_nsec_per_sec_fp;
+        if (remaining <= 0 || !m_cond.wait(remaining))
+        {
+          posted = (unsigned)m_value != key;
+          break;
+        }
+      }
+
+      --m_waiters;
+      return posted;
+    }
+
+    void
+    EventCount::post(void)
+    {
+      ScopedCondition l(m_cond);
+      if (m_waiters == 0)
+        return;
+
+      ++m_value;
+      m_cond.broadcast();
+    }
+
+#endif
+  }
+}
@@ -0,0 +1,104 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+#ifndef DUNE_CONCURRENCY_EVENT_COUNT_HPP_INCLUDED_
+#define DUNE_CONCURRENCY_EVENT_COUNT_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM EventCount;
+
+    //! An event count allows threads to block until a lock-free
+    //! data structure changes state without taking a lock on the
+    //! non-blocking path. A waiter calls prepareWait(), re-checks
+    //! its condition and then calls wait() or cancelWait(). A
+    //! notifier changes the data structure and then calls post(),
+    //! which costs a memory barrier unless a thread is waiting. On
+    //! Linux waiting threads sleep on a futex, elsewhere a condition
+    //! variable is used.
+    class EventCount
+    {
+    public:
+      //! Constructor.
+      EventCount(void);
+
+      //! Register the calling thread as a waiter.
+      //! @return key to be passed to wait().
+      unsigned
+      prepareWait(void);
+
+      //! Unregister the calling thread as a waiter without blocking.
+      void
+      cancelWait(void);
+
+      //! Block until post() is called after prepareWait() returned
+      //! the given key.
+      //! @param key value returned by prepareWait().
+      //! @param timeout maximum amount of time to wait in seconds,
+      //! use a negative number to wait forever. The timeout is
+      //! measured on the host clock, even if simulated time is
+      //! enabled.
+      //! @return true if an event was posted, false on timeout.
+      bool
+      wait(unsigned key, double timeout = -1.0);
+
+      //! Wake all waiting threads.
+      void
+      post(void);
+
+    private:
+      //! Event counter.
+      int m_value;
+      //! Number of registered waiters.
+      int m_waiters;
+
+#if !defined(DUNE_SYS_HAS_LINUX_FUTEX_H)
+      //! Condition variable for generic implementation.
+      Condition m_cond;
+#endif
+
+      //! Non - copyable.
+      EventCount(const EventCount&);
+
+      //! Non - assignable.
+      EventCount&
+      operator=(const EventCount&);
+    };
+  }
+}
+
+#endif
@@ -42,6 +42,7 @@
 #include <DUNE/Tasks/Manager.hpp>
 #include <DUNE/FileSystem/Path.hpp>
 #include <DUNE/Time/Delay.hpp>
+#include <DUNE/Time/Lockstep.hpp>
 #include <DUNE/Utils/String.hpp>
 
 namespace DUNE
@@ -135,6 +136,20 @@ namespace DUNE
     m_ctx.config.get("General", "CPU Usage - Moving Average Samples", "10", m_cpu_avg_samples);
     m_cpu_avg = new Math::MovingAverage<double>(m_cpu_avg_samples);
 
+    // Simulated time.
+    bool lockstep = false;
+    double lockstep_speed = 0;
+    m_ctx.config.get("General", "Lockstep Simulation", "false", lockstep);
+    m_ctx.config.get("General", "Lockstep Simulation - Speed", "0", lockstep_speed);
+    if (lockstep)
+    {
+      Time::Lockstep::enable(lockstep_speed);
+      if (lockstep_speed > 0)
+        inf(DTR("lockstep simulation: up to %0.1f times real time"), lockstep_speed);
+      else
+        inf(DTR("lockstep simulation: as fast as possible"));
+    }
+
     m_tman = new DUNE::Tasks::Manager(m_ctx);
 
     bind<IMC::RestartSystem>(this);
@@ -148,6 +163,7 @@ namespace DUNE
     m_ctx.mbus.pause();
     delete m_tman;
     delete m_cpu_avg;
+    Time::Lockstep::disable();
     inf(DTR("clean shutdown"));
   }
 
@@ -42,8 +42,13 @@ namespace DUNE
 #include <DUNE/IMC/InlineMessage.hpp>
 #include <DUNE/IMC/MessageList.hpp>
 #include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/SharedMessage.hpp>
 #include <DUNE/IMC/Factory.hpp>
 #include <DUNE/IMC/Packet.hpp>
+#include <DUNE/IMC/PacketReader.hpp>
+#include <DUNE/IMC/ChunkedLog.hpp>
+#include <DUNE/IMC/ChunkedLogReader.hpp>
+#include <DUNE/IMC/ChunkedLogWriter.hpp>
 #include <DUNE/IMC/Macros.hpp>
 #include <DUNE/IMC/AddressResolver.hpp>
 #include <DUNE/IMC/Parser.hpp>
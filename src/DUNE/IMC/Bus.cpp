@@ -31,11 +31,14 @@
 #include <algorithm>
 
 // DUNE headers.
+#include <DUNE/Concurrency/Scheduler.hpp>
+#include <DUNE/Concurrency/TLS.hpp>
 #include <DUNE/Streams/Terminal.hpp>
 #include <DUNE/Utils/String.hpp>
 #include <DUNE/IMC/Factory.hpp>
 #include <DUNE/IMC/Bus.hpp>
 #include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/SharedMessage.hpp>
 #include <DUNE/IMC/Definitions.hpp>
 
 namespace DUNE
@@ -60,7 +63,25 @@ namespace DUNE
       Tasks::AbstractTask* exclude;
     };
 
+    //! Reader counter shard of a thread, assigned round-robin when
+    //! the thread first dispatches.
+    struct ReaderIndex
+    {
+      ReaderIndex(void):
+        value(static_cast<unsigned>(s_next.add(1)))
+      { }
+
+      unsigned value;
+
+      static Concurrency::AtomicCounter s_next;
+    };
+
+    Concurrency::AtomicCounter ReaderIndex::s_next;
+
+    static Concurrency::TLS<ReaderIndex> s_reader_index;
+
     Bus::Bus(void):
+      m_epoch(0),
       m_paused(false)
     { }
 
@@ -75,6 +96,64 @@ namespace DUNE
 
       for (unsigned i = 0; i < m_bind_msgs.size(); ++i)
         delete m_bind_msgs[i];
+
+      for (unsigned i = 0; i < c_pages; ++i)
+      {
+        Page* page = m_table[i].load();
+        if (page == NULL)
+          continue;
+
+        for (unsigned j = 0; j < c_page_size; ++j)
+          delete page->slots[j].load();
+
+        delete page;
+      }
+    }
+
+    Bus::Slot&
+    Bus::getSlot(uint16_t id)
+    {
+      Concurrency::AtomicValue<Page*>& entry = m_table[id >> c_page_bits];
+      Page* page = entry.load();
+      if (page == NULL)
+      {
+        page = new Page;
+        entry.store(page);
+      }
+
+      return page->slots[id & (c_page_size - 1)];
+    }
+
+    void
+    Bus::publish(Slot& slot, const RecipientList* list)
+    {
+      const RecipientList* old = slot.load();
+      slot.store(list);
+
+      // Dispatching threads may still be walking the old list.
+      synchronize();
+      delete old;
+    }
+
+    void
+    Bus::synchronize(void)
+    {
+      // A dispatch that read the epoch before a flip may increment
+      // the counter of either epoch, hence both are drained in turn.
+      // Dispatches counted after a counter is seen at zero load the
+      // slot after it was replaced. Each dispatch increments and
+      // decrements the same shard, so shards drain independently.
+      for (unsigned i = 0; i < 2; ++i)
+      {
+        unsigned epoch = m_epoch.load();
+        m_epoch.store(epoch ^ 1);
+
+        for (unsigned j = 0; j < c_reader_shards; ++j)
+        {
+          while (m_readers[j].readers[epoch].add(0) != 0)
+            Concurrency::Scheduler::yield();
+        }
+      }
     }
 
     void
@@ -86,47 +165,100 @@ namespace DUNE
       bind->consumer = task->getName();
       bind->message_id = id;
 
-      Concurrency::ScopedRWLock l(m_lock, true);
+      Concurrency::ScopedMutex l(m_lock);
       m_bind_msgs.push_back(bind);
-      TransportList::iterator itr = std::find(m_recipients[id].begin(), m_recipients[id].end(), task);
-      if (itr == m_recipients[id].end())
-        m_recipients[id].push_back(task);
+
+      Slot& slot = getSlot(id);
+      const RecipientList* old = slot.load();
+      RecipientList* list = NULL;
+      if (old == NULL)
+      {
+        list = new RecipientList;
+      }
+      else
+      {
+        if (std::find(old->begin(), old->end(), task) != old->end())
+          return;
+
+        list = new RecipientList(*old);
+      }
+
+      list->push_back(task);
+      publish(slot, list);
     }
 
     void
     Bus::unregisterRecipient(Tasks::AbstractTask* task, uint16_t id)
     {
-      Concurrency::ScopedRWLock l(m_lock, true);
-      m_recipients[id].remove(task);
+      Concurrency::ScopedMutex l(m_lock);
+
+      Slot& slot = getSlot(id);
+      const RecipientList* old = slot.load();
+      if (old == NULL)
+        return;
+
+      if (std::find(old->begin(), old->end(), task) == old->end())
+        return;
+
+      RecipientList* list = new RecipientList(*old);
+      list->erase(std::remove(list->begin(), list->end(), task), list->end());
+
+      if (list->empty())
+      {
+        delete list;
+        list = NULL;
+      }
+
+      publish(slot, list);
     }
 
     void
     Bus::dispatch(const Message* msg, Tasks::AbstractTask* task)
     {
+      if (m_paused.load())
       {
         Concurrency::ScopedMutex lock(m_paused_lock);
-        if (m_paused)
+        if (m_paused.load())
         {
           m_back_log.push(new BackLogEntry(msg, task));
           return;
         }
       }
 
+      // Announce this dispatch so that writers do not release the
+      // recipient list, or return from unregisterRecipient(), while
+      // it is in use.
+      unsigned epoch = m_epoch.load();
+      unsigned shard = s_reader_index.value().value & (c_reader_shards - 1);
+      Concurrency::AtomicCounter& readers = m_readers[shard].readers[epoch];
+      readers.add(1);
+
       uint16_t id = msg->getId();
-      Concurrency::ScopedRWLock l(m_lock);
-      TransportList& dlst(m_recipients[id]);
-      for (TransportList::iterator itr = dlst.begin(); itr != dlst.end(); ++itr)
+      Page* page = m_table[id >> c_page_bits].load();
+      const RecipientList* list = NULL;
+      if (page != NULL)
+        list = page->slots[id & (c_page_size - 1)].load();
+
+      if (list != NULL)
       {
-        if (*itr != task)
-          (*itr)->receive(msg);
+        // All recipients share a single immutable copy of the message.
+        SharedMessage* shared = new SharedMessage(msg);
+        for (RecipientList::const_iterator itr = list->begin(); itr != list->end(); ++itr)
+        {
+          if (*itr != task)
+            (*itr)->receive(shared);
+        }
+        shared->release();
       }
+
+      readers.sub(1);
     }
 
     void
     Bus::resume(void)
     {
       m_paused_lock.lock();
-      m_paused = false;
+      m_paused.store(false);
       m_paused_lock.unlock();
 
       while (!m_back_log.empty())
@@ -143,6 +275,7 @@ namespace DUNE
     const std::vector<TransportBindings*>
     Bus::getBindings(void)
     {
+      Concurrency::ScopedMutex l(m_lock);
       return m_bind_msgs;
     }
   }
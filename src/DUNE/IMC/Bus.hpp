@@ -41,6 +41,8 @@
 
 // DUNE headers.
 #include <DUNE/Tasks/AbstractTask.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
+#include <DUNE/Concurrency/AtomicValue.hpp>
 #include <DUNE/Concurrency/TSQueue.hpp>
 #include <DUNE/Concurrency/ScopedMutex.hpp>
 #include <DUNE/Concurrency/ScopedRWLock.hpp>
@@ -73,13 +75,18 @@ namespace DUNE
       registerRecipient(Tasks::AbstractTask* task, uint16_t id);
 
       //! Unregister a task as a recipient of a given message
-      //! identification number.
+      //! identification number. Returns only after every dispatch
+      //! that could still see the task as a recipient has finished,
+      //! so the task will not receive further messages of this
+      //! type. Must not be called from within dispatch(), i.e., from
+      //! a task's receive() function.
       //! @param task task object.
       //! @param id message identification number.
       void
       unregisterRecipient(Tasks::AbstractTask* task, uint16_t id);
 
-      //! Dispatches a message to registered listeners.
+      //! Dispatches a message to registered listeners. This function
+      //! does not take any lock unless the bus is paused.
       //! @param msg message to dispatch.
       //! @param task do not deliver message to this task.
       void
@@ -89,7 +96,7 @@ namespace DUNE
       pause(void)
       {
         Concurrency::ScopedMutex lock(m_paused_lock);
-        m_paused = true;
+        m_paused.store(true);
       }
 
       void
@@ -99,13 +106,51 @@ namespace DUNE
       getBindings(void);
 
     private:
-      typedef std::list<Tasks::AbstractTask*> TransportList;
-      //! Table of recipients.
-      std::map<uint16_t, TransportList> m_recipients;
-      //! Internal list lock.
-      Concurrency::RWLock m_lock;
+      //! Immutable list of recipients of a message identifier.
+      typedef std::vector<Tasks::AbstractTask*> RecipientList;
+      //! Dispatch table slot.
+      typedef Concurrency::AtomicValue<const RecipientList*> Slot;
+      //! Number of bits of the message identifier used to index a page.
+      static const unsigned c_page_bits = 8;
+      //! Number of slots per page of the dispatch table.
+      static const unsigned c_page_size = 1 << c_page_bits;
+      //! Number of pages of the dispatch table.
+      static const unsigned c_pages = 65536 / c_page_size;
+
+      //! Page of the dispatch table.
+      struct Page
+      {
+        Slot slots[c_page_size];
+      };
+
+      //! Number of reader counter shards (power of two).
+      static const unsigned c_reader_shards = 32;
+      //! Cache line size used to pad reader counter shards.
+      static const unsigned c_cache_line_size = 64;
+
+      //! Dispatch counters of one shard.
+      struct ReaderShard
+      {
+        //! Number of dispatches in progress, per epoch.
+        Concurrency::AtomicCounter readers[2];
+        //! Keep counters of neighbouring shards on distinct cache lines.
+        char padding[c_cache_line_size];
+      };
+
+      //! Dispatch table indexed by message identifier. Pages are
+      //! allocated on first registration and recipient lists are
+      //! replaced, never modified, so that readers need no locks.
+      Concurrency::AtomicValue<Page*> m_table[c_pages];
+      //! Number of dispatches in progress, per epoch, counted on the
+      //! shard of the dispatching thread. Shards are padded so that
+      //! concurrent dispatches do not contend on a single cache line.
+      ReaderShard m_readers[c_reader_shards];
+      //! Current epoch (0 or 1).
+      Concurrency::AtomicValue<unsigned> m_epoch;
+      //! Writer lock.
+      Concurrency::Mutex m_lock;
       //! Bus is paused.
-      bool m_paused;
+      Concurrency::AtomicValue<bool> m_paused;
       //! Pause lock.
       Concurrency::Mutex m_paused_lock;
       //! List containing all generated TransportBindings for future logging/reference.
@@ -113,6 +158,27 @@ namespace DUNE
       //! Back log queue. Saves messages when Bus is paused.
       Concurrency::TSQueue<BackLogEntry*> m_back_log;
 
+      //! Retrieve the dispatch table slot of a message identifier,
+      //! allocating its page if needed. Must be called with the
+      //! writer lock held.
+      //! @param id message identification number.
+      //! @return slot.
+      Slot&
+      getSlot(uint16_t id);
+
+      //! Replace the recipient list of a dispatch table slot and
+      //! release the previous one once no dispatch is using it.
+      //! Must be called with the writer lock held.
+      //! @param slot dispatch table slot.
+      //! @param list new recipient list or NULL.
+      void
+      publish(Slot& slot, const RecipientList* list);
+
+      //! Wait until all dispatches that started before this call
+      //! have finished. Must be called with the writer lock held.
+      void
+      synchronize(void);
+
       //! Non - copyable.
       Bus(Bus const&);
 
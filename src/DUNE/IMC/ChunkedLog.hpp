@@ -0,0 +1,132 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+#ifndef DUNE_IMC_CHUNKED_LOG_HPP_INCLUDED_
+#define DUNE_IMC_CHUNKED_LOG_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Chunked LSF container.
+    //!
+    //! The container stores a sequence of IMC packets, exactly as
+    //! found in a LSF file, split into chunks that are compressed
+    //! independently with LZ4. A chunk never splits a packet. The
+    //! layout of a file is:
+    //!
+    //! - header: magic (4 bytes), version (uint16_t) and the
+    //!   synchronization number (uint16_t) in the byte order used
+    //!   by the rest of the file.
+    //! - chunks: compressed size (uint32_t), uncompressed size
+    //!   (uint32_t) and compressed data.
+    //! - index: number of chunks (uint32_t) and one entry per chunk
+    //!   with offset (uint64_t), compressed size (uint32_t),
+    //!   uncompressed size (uint32_t), smallest and largest timestamps
+    //!   (fp64_t), number of packets (uint32_t), number of distinct
+    //!   message identification numbers (uint16_t) and the sorted
+    //!   identification numbers (uint16_t each).
+    //! - trailer: offset of the index (uint64_t) and magic (4 bytes).
+    //!
+    //! The index allows seeking by time and skipping chunks without
+    //! messages of interest. If it is missing, for example after a
+    //! power failure, it is rebuilt by scanning the chunks.
+    namespace ChunkedLog
+    {
+      //! File magic.
+      static const char c_magic[] = {'L', 'S', 'F', 'C'};
+      //! Format version.
+      static const uint16_t c_version = 1;
+      //! Size of the file header.
+      static const unsigned c_header_size = 8;
+      //! Size of a chunk header.
+      static const unsigned c_chunk_header_size = 8;
+      //! Size of the file trailer.
+      static const unsigned c_trailer_size = 12;
+      //! Default amount of uncompressed data per chunk.
+      static const unsigned c_chunk_size = 1 << 20;
+      //! Maximum amount of uncompressed data per chunk. Readers
+      //! reject chunks that claim to be larger.
+      static const unsigned c_chunk_size_max = 64 << 20;
+      //! Default maximum time span of a chunk (s).
+      static const double c_chunk_duration = 60.0;
+
+      //! Index entry of a chunk.
+      struct Chunk
+      {
+        //! Offset of the chunk header in the file.
+        uint64_t offset;
+        //! Size of the compressed data.
+        uint32_t compressed_size;
+        //! Size of the uncompressed data.
+        uint32_t size;
+        //! Smallest packet timestamp. Packets from other systems may
+        //! be out of order, hence this is not necessarily the
+        //! timestamp of the first packet.
+        fp64_t time_min;
+        //! Largest packet timestamp.
+        fp64_t time_max;
+        //! Number of packets.
+        uint32_t count;
+        //! Sorted list of message identification numbers.
+        std::vector<uint16_t> ids;
+
+        //! Test if the chunk contains messages of a given type.
+        //! @param[in] id message identification number.
+        //! @return true if the chunk contains the message, false otherwise.
+        bool
+        contains(uint16_t id) const
+        {
+          return std::binary_search(ids.begin(), ids.end(), id);
+        }
+      };
+
+      //! Invalid chunked log exception.
+      class InvalidFile: public std::runtime_error
+      {
+      public:
+        InvalidFile(const std::string& reason):
+          std::runtime_error("invalid chunked log: " + reason)
+        { }
+      };
+    }
+  }
+}
+
+#endif
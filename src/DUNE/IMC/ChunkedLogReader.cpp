@@ -0,0 +1,318 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+#include <set>
+
+// DUNE headers.
+#include <DUNE/IMC/ChunkedLogReader.hpp>
+#include <DUNE/IMC/Constants.hpp>
+#include <DUNE/IMC/Packet.hpp>
+#include <DUNE/Utils/ByteCopy.hpp>
+
+// Vendor headers.
+#include <lz4/lz4.h>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    template <typename Type>
+    unsigned
+    ChunkedLogReader::get(Type& value, const uint8_t* bfr) const
+    {
+      if (m_reverse)
+        return Utils::ByteCopy::rcopy(value, bfr);
+
+      return Utils::ByteCopy::copy(value, bfr);
+    }
+
+    ChunkedLogReader::ChunkedLogReader(std::istream& is):
+      m_is(is),
+      m_reverse(false),
+      m_file_size(0),
+      m_next(0)
+    {
+      m_is.seekg(0, std::ios::end);
+      m_file_size = m_is.tellg();
+      m_is.seekg(0);
+
+      uint8_t hdr[ChunkedLog::c_header_size];
+      m_is.read((char*)hdr, sizeof(hdr));
+
+      if (m_is.gcount() != sizeof(hdr) || std::memcmp(hdr, ChunkedLog::c_magic, sizeof(ChunkedLog::c_magic)) != 0)
+        throw ChunkedLog::InvalidFile("bad magic");
+
+      uint16_t sync = 0;
+      Utils::ByteCopy::copy(sync, hdr + 6);
+      if (sync == DUNE_IMC_CONST_SYNC_REV)
+        m_reverse = true;
+      else if (sync != DUNE_IMC_CONST_SYNC)
+        throw ChunkedLog::InvalidFile("bad byte order");
+
+      uint16_t version = 0;
+      get(version, hdr + 4);
+      if (version != ChunkedLog::c_version)
+        throw ChunkedLog::InvalidFile("unsupported version");
+
+      if (!readIndex())
+        rebuildIndex();
+
+      updateTimes();
+      m_is.clear();
+    }
+
+    bool
+    ChunkedLogReader::isChunked(const char* filename)
+    {
+      std::ifstream ifs(filename, std::ios::binary);
+      char bfr[sizeof(ChunkedLog::c_magic)] = {0};
+
+      ifs.read(bfr, sizeof(bfr));
+
+      return std::memcmp(bfr, ChunkedLog::c_magic, sizeof(bfr)) == 0;
+    }
+
+    unsigned
+    ChunkedLogReader::findChunk(double time) const
+    {
+      // The running maximum is sorted, unlike the chunk timestamps.
+      return std::lower_bound(m_time_max.begin(), m_time_max.end(), time) - m_time_max.begin();
+    }
+
+    void
+    ChunkedLogReader::updateTimes(void)
+    {
+      m_time_max.resize(m_index.size());
+
+      for (unsigned i = 0; i < m_index.size(); ++i)
+      {
+        m_time_max[i] = m_index[i].time_max;
+        if (i > 0 && m_time_max[i - 1] > m_time_max[i])
+          m_time_max[i] = m_time_max[i - 1];
+      }
+    }
+
+    void
+    ChunkedLogReader::seekChunk(unsigned chunk)
+    {
+      m_next = chunk;
+      setg(0, 0, 0);
+    }
+
+    bool
+    ChunkedLogReader::isValid(const ChunkedLog::Chunk& c) const
+    {
+      if (c.offset + ChunkedLog::c_chunk_header_size > m_file_size)
+        return false;
+
+      if (c.compressed_size > m_file_size - c.offset - ChunkedLog::c_chunk_header_size)
+        return false;
+
+      if (c.size > ChunkedLog::c_chunk_size_max)
+        return false;
+
+      return c.compressed_size <= (uint32_t)LZ4_compressBound(c.size);
+    }
+
+    void
+    ChunkedLogReader::readChunk(unsigned chunk, std::vector<char>& data)
+    {
+      const ChunkedLog::Chunk& c = m_index[chunk];
+      if (!isValid(c))
+        throw ChunkedLog::InvalidFile("invalid chunk size");
+
+      m_is.clear();
+      m_is.seekg(c.offset + ChunkedLog::c_chunk_header_size);
+
+      m_compressed.resize(c.compressed_size);
+      m_is.read(&m_compressed[0], c.compressed_size);
+      if ((uint32_t)m_is.gcount() != c.compressed_size)
+        throw ChunkedLog::InvalidFile("truncated chunk");
+
+      data.resize(c.size);
+      int rv = LZ4_decompress_safe(&m_compressed[0], &data[0], c.compressed_size, c.size);
+      if (rv != (int)c.size)
+        throw ChunkedLog::InvalidFile("corrupted chunk");
+    }
+
+    ChunkedLogReader::int_type
+    ChunkedLogReader::underflow(void)
+    {
+      while (gptr() == egptr())
+      {
+        if (m_next >= m_index.size())
+          return traits_type::eof();
+
+        readChunk(m_next++, m_data);
+        if (!m_data.empty())
+          setg(&m_data[0], &m_data[0], &m_data[0] + m_data.size());
+      }
+
+      return traits_type::to_int_type(*gptr());
+    }
+
+    bool
+    ChunkedLogReader::readIndex(void)
+    {
+      uint64_t size = m_file_size;
+
+      if (size < ChunkedLog::c_header_size + ChunkedLog::c_trailer_size + 4)
+        return false;
+
+      uint8_t trailer[ChunkedLog::c_trailer_size];
+      m_is.seekg(size - ChunkedLog::c_trailer_size);
+      m_is.read((char*)trailer, sizeof(trailer));
+      if (std::memcmp(trailer + 8, ChunkedLog::c_magic, sizeof(ChunkedLog::c_magic)) != 0)
+        return false;
+
+      uint64_t offset = 0;
+      get(offset, trailer);
+      if (offset < ChunkedLog::c_header_size || offset + 4 > size - ChunkedLog::c_trailer_size)
+        return false;
+
+      std::vector<uint8_t> bfr(size - ChunkedLog::c_trailer_size - offset);
+      m_is.seekg(offset);
+      m_is.read((char*)&bfr[0], bfr.size());
+
+      const uint8_t* ptr = &bfr[0];
+      const uint8_t* end = ptr + bfr.size();
+      // Size of an index entry without identification numbers.
+      const unsigned entry_size = 8 + 4 + 4 + 8 + 8 + 4 + 2;
+
+      uint32_t count = 0;
+      ptr += get(count, ptr);
+
+      // Reject counts that cannot fit the index before allocating.
+      if (count > (uint64_t)(end - ptr) / entry_size)
+        return false;
+
+      std::vector<ChunkedLog::Chunk> index(count);
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        if ((unsigned)(end - ptr) < entry_size)
+          return false;
+
+        ChunkedLog::Chunk& c = index[i];
+        uint16_t ids = 0;
+        ptr += get(c.offset, ptr);
+        ptr += get(c.compressed_size, ptr);
+        ptr += get(c.size, ptr);
+        ptr += get(c.time_min, ptr);
+        ptr += get(c.time_max, ptr);
+        ptr += get(c.count, ptr);
+        ptr += get(ids, ptr);
+
+        if ((unsigned)(end - ptr) < ids * 2u)
+          return false;
+
+        c.ids.resize(ids);
+        for (uint16_t j = 0; j < ids; ++j)
+          ptr += get(c.ids[j], ptr);
+
+        // Rebuild the index if it references invalid chunks.
+        if (!isValid(c))
+          return false;
+      }
+
+      m_index.swap(index);
+      return true;
+    }
+
+    void
+    ChunkedLogReader::rebuildIndex(void)
+    {
+      m_index.clear();
+
+      m_is.clear();
+      m_is.seekg(ChunkedLog::c_header_size);
+      uint64_t offset = ChunkedLog::c_header_size;
+
+      while (true)
+      {
+        uint8_t hdr[ChunkedLog::c_chunk_header_size];
+        m_is.read((char*)hdr, sizeof(hdr));
+        if (m_is.gcount() != sizeof(hdr))
+          break;
+
+        ChunkedLog::Chunk c;
+        c.offset = offset;
+        get(c.compressed_size, hdr);
+        get(c.size, hdr + 4);
+        c.time_min = 0;
+        c.time_max = 0;
+        c.count = 0;
+
+        // Treat implausible chunk headers as the end of valid data.
+        if (!isValid(c))
+          break;
+
+        // Decompress the chunk to recover its timestamps and contents.
+        m_index.push_back(c);
+        try
+        {
+          readChunk(m_index.size() - 1, m_data);
+        }
+        catch (ChunkedLog::InvalidFile&)
+        {
+          // Truncated chunk at the end of the file.
+          m_index.pop_back();
+          break;
+        }
+
+        ChunkedLog::Chunk& chunk = m_index.back();
+        std::set<uint16_t> ids;
+        unsigned pos = 0;
+        while (pos + DUNE_IMC_CONST_HEADER_SIZE <= m_data.size())
+        {
+          Header phdr;
+          Packet::deserializeHeader(phdr, (uint8_t*)&m_data[pos], DUNE_IMC_CONST_HEADER_SIZE);
+
+          if (chunk.count == 0 || phdr.timestamp < chunk.time_min)
+            chunk.time_min = phdr.timestamp;
+
+          if (chunk.count == 0 || phdr.timestamp > chunk.time_max)
+            chunk.time_max = phdr.timestamp;
+          ++chunk.count;
+          ids.insert(phdr.mgid);
+          pos += DUNE_IMC_CONST_HEADER_SIZE + phdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+        }
+
+        chunk.ids.assign(ids.begin(), ids.end());
+        offset += ChunkedLog::c_chunk_header_size + c.compressed_size;
+        m_is.seekg(offset);
+      }
+
+      m_data.clear();
+    }
+  }
+}
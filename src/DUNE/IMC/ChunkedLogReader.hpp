@@ -0,0 +1,206 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+#ifndef DUNE_IMC_CHUNKED_LOG_READER_HPP_INCLUDED_
+#define DUNE_IMC_CHUNKED_LOG_READER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <fstream>
+#include <istream>
+#include <streambuf>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/ChunkedLog.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM ChunkedLogReader;
+
+    //! Stream buffer that reads the IMC packets of a chunked LSF
+    //! container, decompressing one chunk at a time. Reading starts
+    //! at the first chunk and can be moved to any chunk with
+    //! seek(). Chunks can also be decompressed individually, e.g.,
+    //! by tools that process chunks in parallel using one reader
+    //! per thread.
+    class ChunkedLogReader: public std::streambuf
+    {
+    public:
+      //! Constructor. Loads the chunk index, rebuilding it if the
+      //! container was not properly closed.
+      //! @param[in] is input stream.
+      //! @throw ChunkedLog::InvalidFile if the stream is not a
+      //! chunked LSF container.
+      ChunkedLogReader(std::istream& is);
+
+      //! Test if a file is a chunked LSF container.
+      //! @param[in] filename file name.
+      //! @return true if the file is a chunked LSF container, false
+      //! otherwise.
+      static bool
+      isChunked(const char* filename);
+
+      //! Retrieve the chunk index.
+      //! @return chunk index.
+      const std::vector<ChunkedLog::Chunk>&
+      getIndex(void) const
+      {
+        return m_index;
+      }
+
+      //! Find the first chunk with packets not older than a given
+      //! time. Chunks are not assumed to be ordered by time.
+      //! @param[in] time timestamp.
+      //! @return chunk number, or the number of chunks if all packets
+      //! are older.
+      unsigned
+      findChunk(double time) const;
+
+      //! Continue reading at the start of a given chunk.
+      //! @param[in] chunk chunk number.
+      void
+      seekChunk(unsigned chunk);
+
+      //! Continue reading at the start of the chunk that holds a
+      //! given time. Packets of that chunk older than the given time
+      //! are still returned.
+      //! @param[in] time timestamp.
+      void
+      seek(double time)
+      {
+        seekChunk(findChunk(time));
+      }
+
+      //! Decompress a chunk.
+      //! @param[in] chunk chunk number.
+      //! @param[out] data uncompressed chunk data.
+      //! @throw ChunkedLog::InvalidFile if the chunk is corrupted.
+      void
+      readChunk(unsigned chunk, std::vector<char>& data);
+
+    protected:
+      int_type
+      underflow(void);
+
+    private:
+      //! Input stream.
+      std::istream& m_is;
+      //! True if the container byte order differs from the host.
+      bool m_reverse;
+      //! Chunk index.
+      std::vector<ChunkedLog::Chunk> m_index;
+      //! Largest packet timestamp up to and including each chunk.
+      std::vector<double> m_time_max;
+      //! Size of the container.
+      uint64_t m_file_size;
+      //! Next chunk to be read.
+      unsigned m_next;
+      //! Uncompressed data of the current chunk.
+      std::vector<char> m_data;
+      //! Compressed data buffer.
+      std::vector<char> m_compressed;
+
+      //! Check if the sizes of a chunk are plausible, i.e., the chunk
+      //! fits in the container, is not larger than the maximum chunk
+      //! size and its compressed size is attainable by LZ4.
+      //! @param[in] c chunk.
+      //! @return true if the chunk sizes are valid, false otherwise.
+      bool
+      isValid(const ChunkedLog::Chunk& c) const;
+
+      //! Read the index stored at the end of the container.
+      //! @return true if the index was read, false otherwise.
+      bool
+      readIndex(void);
+
+      //! Rebuild the index by scanning all chunks.
+      void
+      rebuildIndex(void);
+
+      //! Compute the running maximum of chunk timestamps used by
+      //! findChunk().
+      void
+      updateTimes(void);
+
+      //! Read a value in the container byte order.
+      //! @param[out] value value.
+      //! @param[in] bfr buffer.
+      //! @return number of bytes read.
+      template <typename Type>
+      unsigned
+      get(Type& value, const uint8_t* bfr) const;
+    };
+
+    //! Input file stream of a chunked LSF container.
+    class ChunkedLogInput: public std::istream
+    {
+    public:
+      //! Constructor.
+      //! @param[in] filename file name.
+      ChunkedLogInput(const char* filename):
+        std::istream(0),
+        m_stream(filename, std::ios::binary | std::ios::in),
+        m_reader(m_stream)
+      {
+        rdbuf(&m_reader);
+      }
+
+      //! Retrieve the chunk reader.
+      //! @return chunk reader.
+      ChunkedLogReader&
+      getReader(void)
+      {
+        return m_reader;
+      }
+
+      //! Continue reading at the start of the chunk that holds a
+      //! given time.
+      //! @param[in] time timestamp.
+      void
+      seek(double time)
+      {
+        m_reader.seek(time);
+        clear();
+      }
+
+    private:
+      //! File stream, must outlive the reader.
+      std::ifstream m_stream;
+      //! Chunk reader.
+      ChunkedLogReader m_reader;
+    };
+  }
+}
+
+#endif
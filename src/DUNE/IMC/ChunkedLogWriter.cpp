@@ -0,0 +1,237 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/I18N.hpp>
+#include <DUNE/IMC/ChunkedLogWriter.hpp>
+#include <DUNE/IMC/Constants.hpp>
+#include <DUNE/IMC/Packet.hpp>
+#include <DUNE/IMC/Serialization.hpp>
+
+// Vendor headers.
+#include <lz4/lz4.h>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    ChunkedLogWriter::ChunkedLogWriter(std::ostream& os, unsigned chunk_size, double chunk_duration):
+      m_os(os),
+      m_chunk_size(chunk_size),
+      m_chunk_duration(chunk_duration),
+      m_offset(ChunkedLog::c_header_size),
+      m_framed(0),
+      m_chunk_start(0),
+      m_closed(false)
+    {
+      m_chunk.count = 0;
+      // A chunk may exceed the chunk size by up to one packet.
+      m_chunk_size = std::min(m_chunk_size, ChunkedLog::c_chunk_size_max - (unsigned)DUNE_IMC_CONST_MAX_SIZE);
+      m_data.reserve(m_chunk_size + DUNE_IMC_CONST_MAX_SIZE);
+
+      uint8_t hdr[ChunkedLog::c_header_size];
+      std::memcpy(hdr, ChunkedLog::c_magic, sizeof(ChunkedLog::c_magic));
+      IMC::serialize(ChunkedLog::c_version, hdr + 4);
+      IMC::serialize((uint16_t)DUNE_IMC_CONST_SYNC, hdr + 6);
+      m_os.write((char*)hdr, sizeof(hdr));
+    }
+
+    ChunkedLogWriter::~ChunkedLogWriter(void)
+    {
+      try
+      {
+        close();
+      }
+      catch (...)
+      { }
+    }
+
+    void
+    ChunkedLogWriter::close(void)
+    {
+      if (m_closed)
+        return;
+
+      m_closed = true;
+
+      frame();
+
+      // Keep trailing bytes of a truncated packet.
+      m_framed = m_data.size();
+      writeChunk();
+      writeIndex();
+      m_os.flush();
+    }
+
+    ChunkedLogWriter::int_type
+    ChunkedLogWriter::overflow(int_type c)
+    {
+      if (traits_type::eq_int_type(c, traits_type::eof()))
+        return traits_type::not_eof(c);
+
+      char byte = traits_type::to_char_type(c);
+      xsputn(&byte, 1);
+      return c;
+    }
+
+    std::streamsize
+    ChunkedLogWriter::xsputn(const char* bfr, std::streamsize bfr_len)
+    {
+      if (m_closed)
+        return 0;
+
+      m_data.insert(m_data.end(), bfr, bfr + bfr_len);
+      frame();
+      return bfr_len;
+    }
+
+    int
+    ChunkedLogWriter::sync(void)
+    {
+      if (m_closed)
+        return 0;
+
+      // Chunks are only cut by size, time span or close(), hence
+      // flushing only pushes completed chunks to the output stream.
+      frame();
+      m_os.flush();
+      return m_os.good() ? 0 : -1;
+    }
+
+    void
+    ChunkedLogWriter::frame(void)
+    {
+      while (m_data.size() - m_framed >= DUNE_IMC_CONST_HEADER_SIZE)
+      {
+        Header hdr;
+        Packet::deserializeHeader(hdr, (uint8_t*)&m_data[m_framed], DUNE_IMC_CONST_HEADER_SIZE);
+
+        unsigned total = DUNE_IMC_CONST_HEADER_SIZE + hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+        if (m_data.size() - m_framed < total)
+          break;
+
+        if (m_chunk.count > 0 && hdr.timestamp - m_chunk_start >= m_chunk_duration)
+        {
+          writeChunk();
+          continue;
+        }
+
+        if (m_chunk.count == 0)
+        {
+          m_chunk_start = hdr.timestamp;
+          m_chunk.time_min = hdr.timestamp;
+          m_chunk.time_max = hdr.timestamp;
+        }
+
+        m_chunk.time_min = std::min(m_chunk.time_min, hdr.timestamp);
+        m_chunk.time_max = std::max(m_chunk.time_max, hdr.timestamp);
+        ++m_chunk.count;
+        m_ids.insert(hdr.mgid);
+        m_framed += total;
+
+        if (m_framed >= m_chunk_size)
+          writeChunk();
+      }
+    }
+
+    void
+    ChunkedLogWriter::writeChunk(void)
+    {
+      if (m_framed == 0)
+        return;
+
+      int bound = LZ4_compressBound(m_framed);
+      m_compressed.resize(ChunkedLog::c_chunk_header_size + bound);
+      int size = LZ4_compress_limitedOutput(&m_data[0], &m_compressed[ChunkedLog::c_chunk_header_size],
+                                            m_framed, bound);
+      if (size <= 0)
+        throw std::runtime_error(DTR("failed to compress chunk"));
+
+      m_chunk.offset = m_offset;
+      m_chunk.compressed_size = size;
+      m_chunk.size = m_framed;
+      m_chunk.ids.assign(m_ids.begin(), m_ids.end());
+
+      // Chunk holding only the trailing bytes of a truncated packet.
+      if (m_chunk.count == 0)
+        m_chunk.time_min = m_chunk.time_max = m_index.empty() ? 0 : m_index.back().time_max;
+
+      uint8_t* ptr = (uint8_t*)&m_compressed[0];
+      ptr += IMC::serialize(m_chunk.compressed_size, ptr);
+      IMC::serialize(m_chunk.size, ptr);
+
+      unsigned total = ChunkedLog::c_chunk_header_size + size;
+      m_os.write(&m_compressed[0], total);
+      m_offset += total;
+      m_index.push_back(m_chunk);
+
+      m_data.erase(m_data.begin(), m_data.begin() + m_framed);
+      m_framed = 0;
+      m_chunk.count = 0;
+      m_ids.clear();
+    }
+
+    void
+    ChunkedLogWriter::writeIndex(void)
+    {
+      std::vector<uint8_t> bfr;
+      uint8_t tmp[8];
+
+      IMC::serialize((uint32_t)m_index.size(), tmp);
+      bfr.insert(bfr.end(), tmp, tmp + 4);
+
+      for (unsigned i = 0; i < m_index.size(); ++i)
+      {
+        const ChunkedLog::Chunk& c = m_index[i];
+
+        bfr.insert(bfr.end(), tmp, tmp + IMC::serialize(c.offset, tmp));
+        bfr.insert(bfr.end(), tmp, tmp + IMC::serialize(c.compressed_size, tmp));
+        bfr.insert(bfr.end(), tmp, tmp + IMC::serialize(c.size, tmp));
+        bfr.insert(bfr.end(), tmp, tmp + IMC::serialize(c.time_min, tmp));
+        bfr.insert(bfr.end(), tmp, tmp + IMC::serialize(c.time_max, tmp));
+        bfr.insert(bfr.end(), tmp, tmp + IMC::serialize(c.count, tmp));
+        bfr.insert(bfr.end(), tmp, tmp + IMC::serialize((uint16_t)c.ids.size(), tmp));
+
+        for (unsigned j = 0; j < c.ids.size(); ++j)
+          bfr.insert(bfr.end(), tmp, tmp + IMC::serialize(c.ids[j], tmp));
+      }
+
+      bfr.insert(bfr.end(), tmp, tmp + IMC::serialize(m_offset, tmp));
+      bfr.insert(bfr.end(), ChunkedLog::c_magic, ChunkedLog::c_magic + sizeof(ChunkedLog::c_magic));
+
+      m_os.write((char*)&bfr[0], bfr.size());
+    }
+  }
+}
@@ -0,0 +1,165 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+#ifndef DUNE_IMC_CHUNKED_LOG_WRITER_HPP_INCLUDED_
+#define DUNE_IMC_CHUNKED_LOG_WRITER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <fstream>
+#include <ostream>
+#include <set>
+#include <streambuf>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/ChunkedLog.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM ChunkedLogWriter;
+
+    //! Stream buffer that writes a sequence of IMC packets as a
+    //! chunked LSF container. Data may be written in arbitrary
+    //! pieces; packets are framed as they become complete and a
+    //! chunk is compressed and written whenever it reaches the
+    //! configured size or time span, or when the container is
+    //! closed. Flushing the stream does not end the chunk being
+    //! built, so that chunks keep their size and compression ratio.
+    class ChunkedLogWriter: public std::streambuf
+    {
+    public:
+      //! Constructor.
+      //! @param[in] os output stream.
+      //! @param[in] chunk_size amount of uncompressed data per chunk.
+      //! @param[in] chunk_duration maximum time span of a chunk (s).
+      ChunkedLogWriter(std::ostream& os,
+                       unsigned chunk_size = ChunkedLog::c_chunk_size,
+                       double chunk_duration = ChunkedLog::c_chunk_duration);
+
+      //! Destructor. Closes the container.
+      ~ChunkedLogWriter(void);
+
+      //! Write the pending chunk, the index and the trailer. No more
+      //! data can be written afterwards.
+      void
+      close(void);
+
+      //! Retrieve the index of the chunks written so far.
+      //! @return chunk index.
+      const std::vector<ChunkedLog::Chunk>&
+      getIndex(void) const
+      {
+        return m_index;
+      }
+
+    protected:
+      int_type
+      overflow(int_type c);
+
+      std::streamsize
+      xsputn(const char* bfr, std::streamsize bfr_len);
+
+      //! Write complete packets of full chunks and flush the output
+      //! stream. The chunk being built is not written.
+      //! @return 0 on success, -1 on failure.
+      int
+      sync(void);
+
+    private:
+      //! Output stream.
+      std::ostream& m_os;
+      //! Amount of uncompressed data per chunk.
+      unsigned m_chunk_size;
+      //! Maximum time span of a chunk.
+      double m_chunk_duration;
+      //! Offset of the next chunk.
+      uint64_t m_offset;
+      //! Uncompressed data.
+      std::vector<char> m_data;
+      //! Amount of framed data (complete packets).
+      unsigned m_framed;
+      //! Compression buffer.
+      std::vector<char> m_compressed;
+      //! Chunk being built.
+      ChunkedLog::Chunk m_chunk;
+      //! Timestamp of the first packet of the chunk being built.
+      double m_chunk_start;
+      //! Message identification numbers of the chunk being built.
+      std::set<uint16_t> m_ids;
+      //! Index of written chunks.
+      std::vector<ChunkedLog::Chunk> m_index;
+      //! True if the container was closed.
+      bool m_closed;
+
+      //! Frame complete packets and write full chunks.
+      void
+      frame(void);
+
+      //! Compress and write framed data as a chunk.
+      void
+      writeChunk(void);
+
+      //! Write index and trailer.
+      void
+      writeIndex(void);
+    };
+
+    //! Output file stream of a chunked LSF container.
+    class ChunkedLogOutput: public std::ostream
+    {
+    public:
+      //! Constructor.
+      //! @param[in] filename file name.
+      //! @param[in] chunk_size amount of uncompressed data per chunk.
+      //! @param[in] chunk_duration maximum time span of a chunk (s).
+      ChunkedLogOutput(const char* filename,
+                       unsigned chunk_size = ChunkedLog::c_chunk_size,
+                       double chunk_duration = ChunkedLog::c_chunk_duration):
+        std::ostream(0),
+        m_stream(filename, std::ios::binary | std::ios::out),
+        m_writer(m_stream, chunk_size, chunk_duration)
+      {
+        rdbuf(&m_writer);
+      }
+
+    private:
+      //! File stream, must outlive the writer.
+      std::ofstream m_stream;
+      //! Chunk writer.
+      ChunkedLogWriter m_writer;
+    };
+  }
+}
+
+#endif
@@ -278,25 +278,24 @@ namespace DUNE
     uint8_t*
     QueryEntityInfo::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      return ptr__;
+      IMC::store(id, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     QueryEntityInfo::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     QueryEntityInfo::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
@@ -409,25 +408,24 @@ namespace DUNE
     uint8_t*
     CpuUsage::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     CpuUsage::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     CpuUsage::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 1;
     }
 
     fp64_t
@@ -578,25 +576,24 @@ namespace DUNE
     uint8_t*
     DevCalibrationControl::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      return ptr__;
+      IMC::store(op, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     DevCalibrationControl::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     DevCalibrationControl::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      return 1;
     }
 
     void
@@ -858,76 +855,75 @@ namespace DUNE
     uint8_t*
     VehicleOperationalLimits::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(speed_min, ptr__);
-      ptr__ += IMC::serialize(speed_max, ptr__);
-      ptr__ += IMC::serialize(long_accel, ptr__);
-      ptr__ += IMC::serialize(alt_max_msl, ptr__);
-      ptr__ += IMC::serialize(dive_fraction_max, ptr__);
-      ptr__ += IMC::serialize(climb_fraction_max, ptr__);
-      ptr__ += IMC::serialize(bank_max, ptr__);
-      ptr__ += IMC::serialize(p_max, ptr__);
-      ptr__ += IMC::serialize(pitch_min, ptr__);
-      ptr__ += IMC::serialize(pitch_max, ptr__);
-      ptr__ += IMC::serialize(q_max, ptr__);
-      ptr__ += IMC::serialize(g_min, ptr__);
-      ptr__ += IMC::serialize(g_max, ptr__);
-      ptr__ += IMC::serialize(g_lat_max, ptr__);
-      ptr__ += IMC::serialize(rpm_min, ptr__);
-      ptr__ += IMC::serialize(rpm_max, ptr__);
-      ptr__ += IMC::serialize(rpm_rate_max, ptr__);
-      return ptr__;
+      IMC::store(op, bfr__ + 0);
+      IMC::store(speed_min, bfr__ + 1);
+      IMC::store(speed_max, bfr__ + 5);
+      IMC::store(long_accel, bfr__ + 9);
+      IMC::store(alt_max_msl, bfr__ + 13);
+      IMC::store(dive_fraction_max, bfr__ + 17);
+      IMC::store(climb_fraction_max, bfr__ + 21);
+      IMC::store(bank_max, bfr__ + 25);
+      IMC::store(p_max, bfr__ + 29);
+      IMC::store(pitch_min, bfr__ + 33);
+      IMC::store(pitch_max, bfr__ + 37);
+      IMC::store(q_max, bfr__ + 41);
+      IMC::store(g_min, bfr__ + 45);
+      IMC::store(g_max, bfr__ + 49);
+      IMC::store(g_lat_max, bfr__ + 53);
+      IMC::store(rpm_min, bfr__ + 57);
+      IMC::store(rpm_max, bfr__ + 61);
+      IMC::store(rpm_rate_max, bfr__ + 65);
+      return bfr__ + 69;
     }
 
     uint16_t
     VehicleOperationalLimits::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_min, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_max, bfr__, size__);
-      bfr__ += IMC::deserialize(long_accel, bfr__, size__);
-      bfr__ += IMC::deserialize(alt_max_msl, bfr__, size__);
-      bfr__ += IMC::deserialize(dive_fraction_max, bfr__, size__);
-      bfr__ += IMC::deserialize(climb_fraction_max, bfr__, size__);
-      bfr__ += IMC::deserialize(bank_max, bfr__, size__);
-      bfr__ += IMC::deserialize(p_max, bfr__, size__);
-      bfr__ += IMC::deserialize(pitch_min, bfr__, size__);
-      bfr__ += IMC::deserialize(pitch_max, bfr__, size__);
-      bfr__ += IMC::deserialize(q_max, bfr__, size__);
-      bfr__ += IMC::deserialize(g_min, bfr__, size__);
-      bfr__ += IMC::deserialize(g_max, bfr__, size__);
-      bfr__ += IMC::deserialize(g_lat_max, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_min, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_max, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_rate_max, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 69) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      IMC::load(speed_min, bfr__ + 1);
+      IMC::load(speed_max, bfr__ + 5);
+      IMC::load(long_accel, bfr__ + 9);
+      IMC::load(alt_max_msl, bfr__ + 13);
+      IMC::load(dive_fraction_max, bfr__ + 17);
+      IMC::load(climb_fraction_max, bfr__ + 21);
+      IMC::load(bank_max, bfr__ + 25);
+      IMC::load(p_max, bfr__ + 29);
+      IMC::load(pitch_min, bfr__ + 33);
+      IMC::load(pitch_max, bfr__ + 37);
+      IMC::load(q_max, bfr__ + 41);
+      IMC::load(g_min, bfr__ + 45);
+      IMC::load(g_max, bfr__ + 49);
+      IMC::load(g_lat_max, bfr__ + 53);
+      IMC::load(rpm_min, bfr__ + 57);
+      IMC::load(rpm_max, bfr__ + 61);
+      IMC::load(rpm_rate_max, bfr__ + 65);
+      return 69;
     }
 
     uint16_t
     VehicleOperationalLimits::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(long_accel, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(alt_max_msl, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(dive_fraction_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(climb_fraction_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bank_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(pitch_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(pitch_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(g_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(g_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(g_lat_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_rate_max, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 69) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      IMC::reverseLoad(speed_min, bfr__ + 1);
+      IMC::reverseLoad(speed_max, bfr__ + 5);
+      IMC::reverseLoad(long_accel, bfr__ + 9);
+      IMC::reverseLoad(alt_max_msl, bfr__ + 13);
+      IMC::reverseLoad(dive_fraction_max, bfr__ + 17);
+      IMC::reverseLoad(climb_fraction_max, bfr__ + 21);
+      IMC::reverseLoad(bank_max, bfr__ + 25);
+      IMC::reverseLoad(p_max, bfr__ + 29);
+      IMC::reverseLoad(pitch_min, bfr__ + 33);
+      IMC::reverseLoad(pitch_max, bfr__ + 37);
+      IMC::reverseLoad(q_max, bfr__ + 41);
+      IMC::reverseLoad(g_min, bfr__ + 45);
+      IMC::reverseLoad(g_max, bfr__ + 49);
+      IMC::reverseLoad(g_lat_max, bfr__ + 53);
+      IMC::reverseLoad(rpm_min, bfr__ + 57);
+      IMC::reverseLoad(rpm_max, bfr__ + 61);
+      IMC::reverseLoad(rpm_rate_max, bfr__ + 65);
+      return 69;
     }
 
     void
@@ -1111,76 +1107,75 @@ namespace DUNE
     uint8_t*
     SimulatedState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(height, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      ptr__ += IMC::serialize(u, ptr__);
-      ptr__ += IMC::serialize(v, ptr__);
-      ptr__ += IMC::serialize(w, ptr__);
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(q, ptr__);
-      ptr__ += IMC::serialize(r, ptr__);
-      ptr__ += IMC::serialize(svx, ptr__);
-      ptr__ += IMC::serialize(svy, ptr__);
-      ptr__ += IMC::serialize(svz, ptr__);
-      return ptr__;
+      IMC::store(lat, bfr__ + 0);
+      IMC::store(lon, bfr__ + 8);
+      IMC::store(height, bfr__ + 16);
+      IMC::store(x, bfr__ + 20);
+      IMC::store(y, bfr__ + 24);
+      IMC::store(z, bfr__ + 28);
+      IMC::store(phi, bfr__ + 32);
+      IMC::store(theta, bfr__ + 36);
+      IMC::store(psi, bfr__ + 40);
+      IMC::store(u, bfr__ + 44);
+      IMC::store(v, bfr__ + 48);
+      IMC::store(w, bfr__ + 52);
+      IMC::store(p, bfr__ + 56);
+      IMC::store(q, bfr__ + 60);
+      IMC::store(r, bfr__ + 64);
+      IMC::store(svx, bfr__ + 68);
+      IMC::store(svy, bfr__ + 72);
+      IMC::store(svz, bfr__ + 76);
+      return bfr__ + 80;
     }
 
     uint16_t
     SimulatedState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(height, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      bfr__ += IMC::deserialize(u, bfr__, size__);
-      bfr__ += IMC::deserialize(v, bfr__, size__);
-      bfr__ += IMC::deserialize(w, bfr__, size__);
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(q, bfr__, size__);
-      bfr__ += IMC::deserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(svx, bfr__, size__);
-      bfr__ += IMC::deserialize(svy, bfr__, size__);
-      bfr__ += IMC::deserialize(svz, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 80) throw BufferTooShort();
+      IMC::load(lat, bfr__ + 0);
+      IMC::load(lon, bfr__ + 8);
+      IMC::load(height, bfr__ + 16);
+      IMC::load(x, bfr__ + 20);
+      IMC::load(y, bfr__ + 24);
+      IMC::load(z, bfr__ + 28);
+      IMC::load(phi, bfr__ + 32);
+      IMC::load(theta, bfr__ + 36);
+      IMC::load(psi, bfr__ + 40);
+      IMC::load(u, bfr__ + 44);
+      IMC::load(v, bfr__ + 48);
+      IMC::load(w, bfr__ + 52);
+      IMC::load(p, bfr__ + 56);
+      IMC::load(q, bfr__ + 60);
+      IMC::load(r, bfr__ + 64);
+      IMC::load(svx, bfr__ + 68);
+      IMC::load(svy, bfr__ + 72);
+      IMC::load(svz, bfr__ + 76);
+      return 80;
     }
 
     uint16_t
     SimulatedState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(u, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(w, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(r, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(svx, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(svy, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(svz, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 80) throw BufferTooShort();
+      IMC::reverseLoad(lat, bfr__ + 0);
+      IMC::reverseLoad(lon, bfr__ + 8);
+      IMC::reverseLoad(height, bfr__ + 16);
+      IMC::reverseLoad(x, bfr__ + 20);
+      IMC::reverseLoad(y, bfr__ + 24);
+      IMC::reverseLoad(z, bfr__ + 28);
+      IMC::reverseLoad(phi, bfr__ + 32);
+      IMC::reverseLoad(theta, bfr__ + 36);
+      IMC::reverseLoad(psi, bfr__ + 40);
+      IMC::reverseLoad(u, bfr__ + 44);
+      IMC::reverseLoad(v, bfr__ + 48);
+      IMC::reverseLoad(w, bfr__ + 52);
+      IMC::reverseLoad(p, bfr__ + 56);
+      IMC::reverseLoad(q, bfr__ + 60);
+      IMC::reverseLoad(r, bfr__ + 64);
+      IMC::reverseLoad(svx, bfr__ + 68);
+      IMC::reverseLoad(svy, bfr__ + 72);
+      IMC::reverseLoad(svz, bfr__ + 76);
+      return 80;
     }
 
     void
@@ -1369,31 +1364,30 @@ namespace DUNE
     uint8_t*
     DynamicsSimParam::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(tas2acc_pgain, ptr__);
-      ptr__ += IMC::serialize(bank2p_pgain, ptr__);
-      return ptr__;
+      IMC::store(op, bfr__ + 0);
+      IMC::store(tas2acc_pgain, bfr__ + 1);
+      IMC::store(bank2p_pgain, bfr__ + 5);
+      return bfr__ + 9;
     }
 
     uint16_t
     DynamicsSimParam::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(tas2acc_pgain, bfr__, size__);
-      bfr__ += IMC::deserialize(bank2p_pgain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      IMC::load(tas2acc_pgain, bfr__ + 1);
+      IMC::load(bank2p_pgain, bfr__ + 5);
+      return 9;
     }
 
     uint16_t
     DynamicsSimParam::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(tas2acc_pgain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bank2p_pgain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      IMC::reverseLoad(tas2acc_pgain, bfr__ + 1);
+      IMC::reverseLoad(bank2p_pgain, bfr__ + 5);
+      return 9;
     }
 
     void
@@ -1436,28 +1430,27 @@ namespace DUNE
     uint8_t*
     StorageUsage::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(available, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(available, bfr__ + 0);
+      IMC::store(value, bfr__ + 4);
+      return bfr__ + 5;
     }
 
     uint16_t
     StorageUsage::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(available, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(available, bfr__ + 0);
+      IMC::load(value, bfr__ + 4);
+      return 5;
     }
 
     uint16_t
     StorageUsage::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(available, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::reverseLoad(available, bfr__ + 0);
+      IMC::load(value, bfr__ + 4);
+      return 5;
     }
 
     fp64_t
@@ -1924,31 +1917,30 @@ namespace DUNE
     uint8_t*
     ClockControl::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(clock, ptr__);
-      ptr__ += IMC::serialize(tz, ptr__);
-      return ptr__;
+      IMC::store(op, bfr__ + 0);
+      IMC::store(clock, bfr__ + 1);
+      IMC::store(tz, bfr__ + 9);
+      return bfr__ + 10;
     }
 
     uint16_t
     ClockControl::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(clock, bfr__, size__);
-      bfr__ += IMC::deserialize(tz, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 10) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      IMC::load(clock, bfr__ + 1);
+      IMC::load(tz, bfr__ + 9);
+      return 10;
     }
 
     uint16_t
     ClockControl::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(clock, bfr__, size__);
-      bfr__ += IMC::deserialize(tz, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 10) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      IMC::reverseLoad(clock, bfr__ + 1);
+      IMC::load(tz, bfr__ + 9);
+      return 10;
     }
 
     void
@@ -1992,31 +1984,30 @@ namespace DUNE
     uint8_t*
     HistoricCTD::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(conductivity, ptr__);
-      ptr__ += IMC::serialize(temperature, ptr__);
-      ptr__ += IMC::serialize(depth, ptr__);
-      return ptr__;
+      IMC::store(conductivity, bfr__ + 0);
+      IMC::store(temperature, bfr__ + 4);
+      IMC::store(depth, bfr__ + 8);
+      return bfr__ + 12;
     }
 
     uint16_t
     HistoricCTD::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(conductivity, bfr__, size__);
-      bfr__ += IMC::deserialize(temperature, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12) throw BufferTooShort();
+      IMC::load(conductivity, bfr__ + 0);
+      IMC::load(temperature, bfr__ + 4);
+      IMC::load(depth, bfr__ + 8);
+      return 12;
     }
 
     uint16_t
     HistoricCTD::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(conductivity, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(temperature, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(depth, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12) throw BufferTooShort();
+      IMC::reverseLoad(conductivity, bfr__ + 0);
+      IMC::reverseLoad(temperature, bfr__ + 4);
+      IMC::reverseLoad(depth, bfr__ + 8);
+      return 12;
     }
 
     void
@@ -2064,37 +2055,36 @@ namespace DUNE
     uint8_t*
     HistoricTelemetry::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(altitude, ptr__);
-      ptr__ += IMC::serialize(roll, ptr__);
-      ptr__ += IMC::serialize(pitch, ptr__);
-      ptr__ += IMC::serialize(yaw, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      return ptr__;
+      IMC::store(altitude, bfr__ + 0);
+      IMC::store(roll, bfr__ + 4);
+      IMC::store(pitch, bfr__ + 6);
+      IMC::store(yaw, bfr__ + 8);
+      IMC::store(speed, bfr__ + 10);
+      return bfr__ + 12;
     }
 
     uint16_t
     HistoricTelemetry::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(altitude, bfr__, size__);
-      bfr__ += IMC::deserialize(roll, bfr__, size__);
-      bfr__ += IMC::deserialize(pitch, bfr__, size__);
-      bfr__ += IMC::deserialize(yaw, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12) throw BufferTooShort();
+      IMC::load(altitude, bfr__ + 0);
+      IMC::load(roll, bfr__ + 4);
+      IMC::load(pitch, bfr__ + 6);
+      IMC::load(yaw, bfr__ + 8);
+      IMC::load(speed, bfr__ + 10);
+      return 12;
     }
 
     uint16_t
     HistoricTelemetry::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(altitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(roll, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(pitch, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(yaw, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12) throw BufferTooShort();
+      IMC::reverseLoad(altitude, bfr__ + 0);
+      IMC::reverseLoad(roll, bfr__ + 4);
+      IMC::reverseLoad(pitch, bfr__ + 6);
+      IMC::reverseLoad(yaw, bfr__ + 8);
+      IMC::reverseLoad(speed, bfr__ + 10);
+      return 12;
     }
 
     void
@@ -2486,25 +2476,24 @@ namespace DUNE
     uint8_t*
     RSSI::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     RSSI::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     RSSI::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -2554,25 +2543,24 @@ namespace DUNE
     uint8_t*
     VSWR::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     VSWR::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     VSWR::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -2622,25 +2610,24 @@ namespace DUNE
     uint8_t*
     LinkLevel::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     LinkLevel::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     LinkLevel::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -3379,28 +3366,27 @@ namespace DUNE
     uint8_t*
     LinkLatency::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(sys_src, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      IMC::store(sys_src, bfr__ + 4);
+      return bfr__ + 6;
     }
 
     uint16_t
     LinkLatency::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(sys_src, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 6) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      IMC::load(sys_src, bfr__ + 4);
+      return 6;
     }
 
     uint16_t
     LinkLatency::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sys_src, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 6) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      IMC::reverseLoad(sys_src, bfr__ + 4);
+      return 6;
     }
 
     fp64_t
@@ -3453,28 +3439,27 @@ namespace DUNE
     uint8_t*
     ExtendedRSSI::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(units, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      IMC::store(units, bfr__ + 4);
+      return bfr__ + 5;
     }
 
     uint16_t
     ExtendedRSSI::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      IMC::load(units, bfr__ + 4);
+      return 5;
     }
 
     uint16_t
     ExtendedRSSI::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      IMC::load(units, bfr__ + 4);
+      return 5;
     }
 
     fp64_t
@@ -4084,28 +4069,27 @@ namespace DUNE
     uint8_t*
     LblRange::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(range, ptr__);
-      return ptr__;
+      IMC::store(id, bfr__ + 0);
+      IMC::store(range, bfr__ + 1);
+      return bfr__ + 5;
     }
 
     uint16_t
     LblRange::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(range, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(range, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
     LblRange::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(range, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::reverseLoad(range, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
@@ -4728,25 +4712,24 @@ namespace DUNE
     uint8_t*
     Rpm::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 2;
     }
 
     uint16_t
     Rpm::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 2) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 2;
     }
 
     uint16_t
     Rpm::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 2) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 2;
     }
 
     fp64_t
@@ -4796,25 +4779,24 @@ namespace DUNE
     uint8_t*
     Voltage::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Voltage::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Voltage::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -4864,25 +4846,24 @@ namespace DUNE
     uint8_t*
     Current::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Current::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Current::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -4964,70 +4945,69 @@ namespace DUNE
     uint8_t*
     GpsFix::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(validity, ptr__);
-      ptr__ += IMC::serialize(type, ptr__);
-      ptr__ += IMC::serialize(utc_year, ptr__);
-      ptr__ += IMC::serialize(utc_month, ptr__);
-      ptr__ += IMC::serialize(utc_day, ptr__);
-      ptr__ += IMC::serialize(utc_time, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(height, ptr__);
-      ptr__ += IMC::serialize(satellites, ptr__);
-      ptr__ += IMC::serialize(cog, ptr__);
-      ptr__ += IMC::serialize(sog, ptr__);
-      ptr__ += IMC::serialize(hdop, ptr__);
-      ptr__ += IMC::serialize(vdop, ptr__);
-      ptr__ += IMC::serialize(hacc, ptr__);
-      ptr__ += IMC::serialize(vacc, ptr__);
-      return ptr__;
+      IMC::store(validity, bfr__ + 0);
+      IMC::store(type, bfr__ + 2);
+      IMC::store(utc_year, bfr__ + 3);
+      IMC::store(utc_month, bfr__ + 5);
+      IMC::store(utc_day, bfr__ + 6);
+      IMC::store(utc_time, bfr__ + 7);
+      IMC::store(lat, bfr__ + 11);
+      IMC::store(lon, bfr__ + 19);
+      IMC::store(height, bfr__ + 27);
+      IMC::store(satellites, bfr__ + 31);
+      IMC::store(cog, bfr__ + 32);
+      IMC::store(sog, bfr__ + 36);
+      IMC::store(hdop, bfr__ + 40);
+      IMC::store(vdop, bfr__ + 44);
+      IMC::store(hacc, bfr__ + 48);
+      IMC::store(vacc, bfr__ + 52);
+      return bfr__ + 56;
     }
 
     uint16_t
     GpsFix::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_year, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_month, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_day, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_time, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(height, bfr__, size__);
-      bfr__ += IMC::deserialize(satellites, bfr__, size__);
-      bfr__ += IMC::deserialize(cog, bfr__, size__);
-      bfr__ += IMC::deserialize(sog, bfr__, size__);
-      bfr__ += IMC::deserialize(hdop, bfr__, size__);
-      bfr__ += IMC::deserialize(vdop, bfr__, size__);
-      bfr__ += IMC::deserialize(hacc, bfr__, size__);
-      bfr__ += IMC::deserialize(vacc, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 56) throw BufferTooShort();
+      IMC::load(validity, bfr__ + 0);
+      IMC::load(type, bfr__ + 2);
+      IMC::load(utc_year, bfr__ + 3);
+      IMC::load(utc_month, bfr__ + 5);
+      IMC::load(utc_day, bfr__ + 6);
+      IMC::load(utc_time, bfr__ + 7);
+      IMC::load(lat, bfr__ + 11);
+      IMC::load(lon, bfr__ + 19);
+      IMC::load(height, bfr__ + 27);
+      IMC::load(satellites, bfr__ + 31);
+      IMC::load(cog, bfr__ + 32);
+      IMC::load(sog, bfr__ + 36);
+      IMC::load(hdop, bfr__ + 40);
+      IMC::load(vdop, bfr__ + 44);
+      IMC::load(hacc, bfr__ + 48);
+      IMC::load(vacc, bfr__ + 52);
+      return 56;
     }
 
     uint16_t
     GpsFix::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(utc_year, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_month, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_day, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(utc_time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height, bfr__, size__);
-      bfr__ += IMC::deserialize(satellites, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(cog, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sog, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(hdop, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vdop, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(hacc, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vacc, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 56) throw BufferTooShort();
+      IMC::reverseLoad(validity, bfr__ + 0);
+      IMC::load(type, bfr__ + 2);
+      IMC::reverseLoad(utc_year, bfr__ + 3);
+      IMC::load(utc_month, bfr__ + 5);
+      IMC::load(utc_day, bfr__ + 6);
+      IMC::reverseLoad(utc_time, bfr__ + 7);
+      IMC::reverseLoad(lat, bfr__ + 11);
+      IMC::reverseLoad(lon, bfr__ + 19);
+      IMC::reverseLoad(height, bfr__ + 27);
+      IMC::load(satellites, bfr__ + 31);
+      IMC::reverseLoad(cog, bfr__ + 32);
+      IMC::reverseLoad(sog, bfr__ + 36);
+      IMC::reverseLoad(hdop, bfr__ + 40);
+      IMC::reverseLoad(vdop, bfr__ + 44);
+      IMC::reverseLoad(hacc, bfr__ + 48);
+      IMC::reverseLoad(vacc, bfr__ + 52);
+      return 56;
     }
 
     void
@@ -5092,37 +5072,36 @@ namespace DUNE
     uint8_t*
     EulerAngles::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      ptr__ += IMC::serialize(psi_magnetic, ptr__);
-      return ptr__;
+      IMC::store(time, bfr__ + 0);
+      IMC::store(phi, bfr__ + 8);
+      IMC::store(theta, bfr__ + 16);
+      IMC::store(psi, bfr__ + 24);
+      IMC::store(psi_magnetic, bfr__ + 32);
+      return bfr__ + 40;
     }
 
     uint16_t
     EulerAngles::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      bfr__ += IMC::deserialize(psi_magnetic, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 40) throw BufferTooShort();
+      IMC::load(time, bfr__ + 0);
+      IMC::load(phi, bfr__ + 8);
+      IMC::load(theta, bfr__ + 16);
+      IMC::load(psi, bfr__ + 24);
+      IMC::load(psi_magnetic, bfr__ + 32);
+      return 40;
     }
 
     uint16_t
     EulerAngles::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi_magnetic, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 40) throw BufferTooShort();
+      IMC::reverseLoad(time, bfr__ + 0);
+      IMC::reverseLoad(phi, bfr__ + 8);
+      IMC::reverseLoad(theta, bfr__ + 16);
+      IMC::reverseLoad(psi, bfr__ + 24);
+      IMC::reverseLoad(psi_magnetic, bfr__ + 32);
+      return 40;
     }
 
     void
@@ -5172,37 +5151,36 @@ namespace DUNE
     uint8_t*
     EulerAnglesDelta::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(timestep, ptr__);
-      return ptr__;
+      IMC::store(time, bfr__ + 0);
+      IMC::store(x, bfr__ + 8);
+      IMC::store(y, bfr__ + 16);
+      IMC::store(z, bfr__ + 24);
+      IMC::store(timestep, bfr__ + 32);
+      return bfr__ + 36;
     }
 
     uint16_t
     EulerAnglesDelta::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(timestep, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 36) throw BufferTooShort();
+      IMC::load(time, bfr__ + 0);
+      IMC::load(x, bfr__ + 8);
+      IMC::load(y, bfr__ + 16);
+      IMC::load(z, bfr__ + 24);
+      IMC::load(timestep, bfr__ + 32);
+      return 36;
     }
 
     uint16_t
     EulerAnglesDelta::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(timestep, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 36) throw BufferTooShort();
+      IMC::reverseLoad(time, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 8);
+      IMC::reverseLoad(y, bfr__ + 16);
+      IMC::reverseLoad(z, bfr__ + 24);
+      IMC::reverseLoad(timestep, bfr__ + 32);
+      return 36;
     }
 
     void
@@ -5250,34 +5228,33 @@ namespace DUNE
     uint8_t*
     AngularVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::store(time, bfr__ + 0);
+      IMC::store(x, bfr__ + 8);
+      IMC::store(y, bfr__ + 16);
+      IMC::store(z, bfr__ + 24);
+      return bfr__ + 32;
     }
 
     uint16_t
     AngularVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 32) throw BufferTooShort();
+      IMC::load(time, bfr__ + 0);
+      IMC::load(x, bfr__ + 8);
+      IMC::load(y, bfr__ + 16);
+      IMC::load(z, bfr__ + 24);
+      return 32;
     }
 
     uint16_t
     AngularVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 32) throw BufferTooShort();
+      IMC::reverseLoad(time, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 8);
+      IMC::reverseLoad(y, bfr__ + 16);
+      IMC::reverseLoad(z, bfr__ + 24);
+      return 32;
     }
 
     void
@@ -5324,34 +5301,33 @@ namespace DUNE
     uint8_t*
     Acceleration::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::store(time, bfr__ + 0);
+      IMC::store(x, bfr__ + 8);
+      IMC::store(y, bfr__ + 16);
+      IMC::store(z, bfr__ + 24);
+      return bfr__ + 32;
     }
 
     uint16_t
     Acceleration::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 32) throw BufferTooShort();
+      IMC::load(time, bfr__ + 0);
+      IMC::load(x, bfr__ + 8);
+      IMC::load(y, bfr__ + 16);
+      IMC::load(z, bfr__ + 24);
+      return 32;
     }
 
     uint16_t
     Acceleration::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 32) throw BufferTooShort();
+      IMC::reverseLoad(time, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 8);
+      IMC::reverseLoad(y, bfr__ + 16);
+      IMC::reverseLoad(z, bfr__ + 24);
+      return 32;
     }
 
     void
@@ -5398,34 +5374,33 @@ namespace DUNE
     uint8_t*
     MagneticField::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::store(time, bfr__ + 0);
+      IMC::store(x, bfr__ + 8);
+      IMC::store(y, bfr__ + 16);
+      IMC::store(z, bfr__ + 24);
+      return bfr__ + 32;
     }
 
     uint16_t
     MagneticField::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 32) throw BufferTooShort();
+      IMC::load(time, bfr__ + 0);
+      IMC::load(x, bfr__ + 8);
+      IMC::load(y, bfr__ + 16);
+      IMC::load(z, bfr__ + 24);
+      return 32;
     }
 
     uint16_t
     MagneticField::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 32) throw BufferTooShort();
+      IMC::reverseLoad(time, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 8);
+      IMC::reverseLoad(y, bfr__ + 16);
+      IMC::reverseLoad(z, bfr__ + 24);
+      return 32;
     }
 
     void
@@ -5472,34 +5447,33 @@ namespace DUNE
     uint8_t*
     GroundVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(validity, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::store(validity, bfr__ + 0);
+      IMC::store(x, bfr__ + 1);
+      IMC::store(y, bfr__ + 9);
+      IMC::store(z, bfr__ + 17);
+      return bfr__ + 25;
     }
 
     uint16_t
     GroundVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 25) throw BufferTooShort();
+      IMC::load(validity, bfr__ + 0);
+      IMC::load(x, bfr__ + 1);
+      IMC::load(y, bfr__ + 9);
+      IMC::load(z, bfr__ + 17);
+      return 25;
     }
 
     uint16_t
     GroundVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 25) throw BufferTooShort();
+      IMC::load(validity, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 1);
+      IMC::reverseLoad(y, bfr__ + 9);
+      IMC::reverseLoad(z, bfr__ + 17);
+      return 25;
     }
 
     void
@@ -5546,34 +5520,33 @@ namespace DUNE
     uint8_t*
     WaterVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(validity, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::store(validity, bfr__ + 0);
+      IMC::store(x, bfr__ + 1);
+      IMC::store(y, bfr__ + 9);
+      IMC::store(z, bfr__ + 17);
+      return bfr__ + 25;
     }
 
     uint16_t
     WaterVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 25) throw BufferTooShort();
+      IMC::load(validity, bfr__ + 0);
+      IMC::load(x, bfr__ + 1);
+      IMC::load(y, bfr__ + 9);
+      IMC::load(z, bfr__ + 17);
+      return 25;
     }
 
     uint16_t
     WaterVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 25) throw BufferTooShort();
+      IMC::load(validity, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 1);
+      IMC::reverseLoad(y, bfr__ + 9);
+      IMC::reverseLoad(z, bfr__ + 17);
+      return 25;
     }
 
     void
@@ -5620,34 +5593,33 @@ namespace DUNE
     uint8_t*
     VelocityDelta::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::store(time, bfr__ + 0);
+      IMC::store(x, bfr__ + 8);
+      IMC::store(y, bfr__ + 16);
+      IMC::store(z, bfr__ + 24);
+      return bfr__ + 32;
     }
 
     uint16_t
     VelocityDelta::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 32) throw BufferTooShort();
+      IMC::load(time, bfr__ + 0);
+      IMC::load(x, bfr__ + 8);
+      IMC::load(y, bfr__ + 16);
+      IMC::load(z, bfr__ + 24);
+      return 32;
     }
 
     uint16_t
     VelocityDelta::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 32) throw BufferTooShort();
+      IMC::reverseLoad(time, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 8);
+      IMC::reverseLoad(y, bfr__ + 16);
+      IMC::reverseLoad(z, bfr__ + 24);
+      return 32;
     }
 
     void
@@ -5698,40 +5670,39 @@ namespace DUNE
     uint8_t*
     DeviceState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      return ptr__;
+      IMC::store(x, bfr__ + 0);
+      IMC::store(y, bfr__ + 4);
+      IMC::store(z, bfr__ + 8);
+      IMC::store(phi, bfr__ + 12);
+      IMC::store(theta, bfr__ + 16);
+      IMC::store(psi, bfr__ + 20);
+      return bfr__ + 24;
     }
 
     uint16_t
     DeviceState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24) throw BufferTooShort();
+      IMC::load(x, bfr__ + 0);
+      IMC::load(y, bfr__ + 4);
+      IMC::load(z, bfr__ + 8);
+      IMC::load(phi, bfr__ + 12);
+      IMC::load(theta, bfr__ + 16);
+      IMC::load(psi, bfr__ + 20);
+      return 24;
     }
 
     uint16_t
     DeviceState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24) throw BufferTooShort();
+      IMC::reverseLoad(x, bfr__ + 0);
+      IMC::reverseLoad(y, bfr__ + 4);
+      IMC::reverseLoad(z, bfr__ + 8);
+      IMC::reverseLoad(phi, bfr__ + 12);
+      IMC::reverseLoad(theta, bfr__ + 16);
+      IMC::reverseLoad(psi, bfr__ + 20);
+      return 24;
     }
 
     void
@@ -5778,28 +5749,27 @@ namespace DUNE
     uint8_t*
     BeamConfig::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(beam_width, ptr__);
-      ptr__ += IMC::serialize(beam_height, ptr__);
-      return ptr__;
+      IMC::store(beam_width, bfr__ + 0);
+      IMC::store(beam_height, bfr__ + 4);
+      return bfr__ + 8;
     }
 
     uint16_t
     BeamConfig::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(beam_width, bfr__, size__);
-      bfr__ += IMC::deserialize(beam_height, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::load(beam_width, bfr__ + 0);
+      IMC::load(beam_height, bfr__ + 4);
+      return 8;
     }
 
     uint16_t
     BeamConfig::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(beam_width, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(beam_height, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::reverseLoad(beam_width, bfr__ + 0);
+      IMC::reverseLoad(beam_height, bfr__ + 4);
+      return 8;
     }
 
     void
@@ -5966,25 +5936,24 @@ namespace DUNE
     uint8_t*
     Temperature::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Temperature::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Temperature::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -6034,25 +6003,24 @@ namespace DUNE
     uint8_t*
     Pressure::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     Pressure::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     Pressure::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -6102,25 +6070,24 @@ namespace DUNE
     uint8_t*
     Depth::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Depth::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Depth::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -6170,25 +6137,24 @@ namespace DUNE
     uint8_t*
     DepthOffset::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     DepthOffset::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     DepthOffset::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -6238,25 +6204,24 @@ namespace DUNE
     uint8_t*
     SoundSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     SoundSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     SoundSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -6306,25 +6271,24 @@ namespace DUNE
     uint8_t*
     WaterDensity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     WaterDensity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     WaterDensity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -6374,25 +6338,24 @@ namespace DUNE
     uint8_t*
     Conductivity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Conductivity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Conductivity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -6442,25 +6405,24 @@ namespace DUNE
     uint8_t*
     Salinity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Salinity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Salinity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -6514,31 +6476,30 @@ namespace DUNE
     uint8_t*
     WindSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(direction, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(turbulence, ptr__);
-      return ptr__;
+      IMC::store(direction, bfr__ + 0);
+      IMC::store(speed, bfr__ + 4);
+      IMC::store(turbulence, bfr__ + 8);
+      return bfr__ + 12;
     }
 
     uint16_t
     WindSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(direction, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(turbulence, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12) throw BufferTooShort();
+      IMC::load(direction, bfr__ + 0);
+      IMC::load(speed, bfr__ + 4);
+      IMC::load(turbulence, bfr__ + 8);
+      return 12;
     }
 
     uint16_t
     WindSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(direction, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(turbulence, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12) throw BufferTooShort();
+      IMC::reverseLoad(direction, bfr__ + 0);
+      IMC::reverseLoad(speed, bfr__ + 4);
+      IMC::reverseLoad(turbulence, bfr__ + 8);
+      return 12;
     }
 
     void
@@ -6579,25 +6540,24 @@ namespace DUNE
     uint8_t*
     RelativeHumidity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     RelativeHumidity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     RelativeHumidity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -6759,25 +6719,24 @@ namespace DUNE
     uint8_t*
     Force::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Force::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Force::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -6995,25 +6954,24 @@ namespace DUNE
     uint8_t*
     PulseDetectionControl::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      return ptr__;
+      IMC::store(op, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     PulseDetectionControl::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     PulseDetectionControl::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      return 1;
     }
 
     void
@@ -7161,67 +7119,66 @@ namespace DUNE
     uint8_t*
     GpsNavData::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(itow, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(height_ell, ptr__);
-      ptr__ += IMC::serialize(height_sea, ptr__);
-      ptr__ += IMC::serialize(hacc, ptr__);
-      ptr__ += IMC::serialize(vacc, ptr__);
-      ptr__ += IMC::serialize(vel_n, ptr__);
-      ptr__ += IMC::serialize(vel_e, ptr__);
-      ptr__ += IMC::serialize(vel_d, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(gspeed, ptr__);
-      ptr__ += IMC::serialize(heading, ptr__);
-      ptr__ += IMC::serialize(sacc, ptr__);
-      ptr__ += IMC::serialize(cacc, ptr__);
-      return ptr__;
+      IMC::store(itow, bfr__ + 0);
+      IMC::store(lat, bfr__ + 4);
+      IMC::store(lon, bfr__ + 12);
+      IMC::store(height_ell, bfr__ + 20);
+      IMC::store(height_sea, bfr__ + 24);
+      IMC::store(hacc, bfr__ + 28);
+      IMC::store(vacc, bfr__ + 32);
+      IMC::store(vel_n, bfr__ + 36);
+      IMC::store(vel_e, bfr__ + 40);
+      IMC::store(vel_d, bfr__ + 44);
+      IMC::store(speed, bfr__ + 48);
+      IMC::store(gspeed, bfr__ + 52);
+      IMC::store(heading, bfr__ + 56);
+      IMC::store(sacc, bfr__ + 60);
+      IMC::store(cacc, bfr__ + 64);
+      return bfr__ + 68;
     }
 
     uint16_t
     GpsNavData::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(itow, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(height_ell, bfr__, size__);
-      bfr__ += IMC::deserialize(height_sea, bfr__, size__);
-      bfr__ += IMC::deserialize(hacc, bfr__, size__);
-      bfr__ += IMC::deserialize(vacc, bfr__, size__);
-      bfr__ += IMC::deserialize(vel_n, bfr__, size__);
-      bfr__ += IMC::deserialize(vel_e, bfr__, size__);
-      bfr__ += IMC::deserialize(vel_d, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(gspeed, bfr__, size__);
-      bfr__ += IMC::deserialize(heading, bfr__, size__);
-      bfr__ += IMC::deserialize(sacc, bfr__, size__);
-      bfr__ += IMC::deserialize(cacc, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 68) throw BufferTooShort();
+      IMC::load(itow, bfr__ + 0);
+      IMC::load(lat, bfr__ + 4);
+      IMC::load(lon, bfr__ + 12);
+      IMC::load(height_ell, bfr__ + 20);
+      IMC::load(height_sea, bfr__ + 24);
+      IMC::load(hacc, bfr__ + 28);
+      IMC::load(vacc, bfr__ + 32);
+      IMC::load(vel_n, bfr__ + 36);
+      IMC::load(vel_e, bfr__ + 40);
+      IMC::load(vel_d, bfr__ + 44);
+      IMC::load(speed, bfr__ + 48);
+      IMC::load(gspeed, bfr__ + 52);
+      IMC::load(heading, bfr__ + 56);
+      IMC::load(sacc, bfr__ + 60);
+      IMC::load(cacc, bfr__ + 64);
+      return 68;
     }
 
     uint16_t
     GpsNavData::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(itow, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height_ell, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height_sea, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(hacc, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vacc, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vel_n, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vel_e, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vel_d, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(gspeed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(heading, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sacc, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(cacc, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 68) throw BufferTooShort();
+      IMC::reverseLoad(itow, bfr__ + 0);
+      IMC::reverseLoad(lat, bfr__ + 4);
+      IMC::reverseLoad(lon, bfr__ + 12);
+      IMC::reverseLoad(height_ell, bfr__ + 20);
+      IMC::reverseLoad(height_sea, bfr__ + 24);
+      IMC::reverseLoad(hacc, bfr__ + 28);
+      IMC::reverseLoad(vacc, bfr__ + 32);
+      IMC::reverseLoad(vel_n, bfr__ + 36);
+      IMC::reverseLoad(vel_e, bfr__ + 40);
+      IMC::reverseLoad(vel_d, bfr__ + 44);
+      IMC::reverseLoad(speed, bfr__ + 48);
+      IMC::reverseLoad(gspeed, bfr__ + 52);
+      IMC::reverseLoad(heading, bfr__ + 56);
+      IMC::reverseLoad(sacc, bfr__ + 60);
+      IMC::reverseLoad(cacc, bfr__ + 64);
+      return 68;
     }
 
     void
@@ -7276,28 +7233,27 @@ namespace DUNE
     uint8_t*
     ServoPosition::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(id, bfr__ + 0);
+      IMC::store(value, bfr__ + 1);
+      return bfr__ + 5;
     }
 
     uint16_t
     ServoPosition::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(value, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
     ServoPosition::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::reverseLoad(value, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
@@ -7360,25 +7316,24 @@ namespace DUNE
     uint8_t*
     DataSanity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(sane, ptr__);
-      return ptr__;
+      IMC::store(sane, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     DataSanity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sane, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1) throw BufferTooShort();
+      IMC::load(sane, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     DataSanity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sane, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1) throw BufferTooShort();
+      IMC::load(sane, bfr__ + 0);
+      return 1;
     }
 
     void
@@ -7416,25 +7371,24 @@ namespace DUNE
     uint8_t*
     RhodamineDye::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     RhodamineDye::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     RhodamineDye::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -7484,25 +7438,24 @@ namespace DUNE
     uint8_t*
     CrudeOil::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     CrudeOil::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     CrudeOil::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -7552,25 +7505,24 @@ namespace DUNE
     uint8_t*
     FineOil::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     FineOil::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     FineOil::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -7620,25 +7572,24 @@ namespace DUNE
     uint8_t*
     Turbidity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Turbidity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Turbidity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -7688,25 +7639,24 @@ namespace DUNE
     uint8_t*
     Chlorophyll::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Chlorophyll::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Chlorophyll::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -7756,25 +7706,24 @@ namespace DUNE
     uint8_t*
     Fluorescein::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Fluorescein::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Fluorescein::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -7824,25 +7773,24 @@ namespace DUNE
     uint8_t*
     Phycocyanin::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Phycocyanin::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Phycocyanin::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -7892,25 +7840,24 @@ namespace DUNE
     uint8_t*
     Phycoerythrin::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Phycoerythrin::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Phycoerythrin::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -7990,67 +7937,66 @@ namespace DUNE
     uint8_t*
     GpsFixRtk::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(validity, ptr__);
-      ptr__ += IMC::serialize(type, ptr__);
-      ptr__ += IMC::serialize(tow, ptr__);
-      ptr__ += IMC::serialize(base_lat, ptr__);
-      ptr__ += IMC::serialize(base_lon, ptr__);
-      ptr__ += IMC::serialize(base_height, ptr__);
-      ptr__ += IMC::serialize(n, ptr__);
-      ptr__ += IMC::serialize(e, ptr__);
-      ptr__ += IMC::serialize(d, ptr__);
-      ptr__ += IMC::serialize(v_n, ptr__);
-      ptr__ += IMC::serialize(v_e, ptr__);
-      ptr__ += IMC::serialize(v_d, ptr__);
-      ptr__ += IMC::serialize(satellites, ptr__);
-      ptr__ += IMC::serialize(iar_hyp, ptr__);
-      ptr__ += IMC::serialize(iar_ratio, ptr__);
-      return ptr__;
+      IMC::store(validity, bfr__ + 0);
+      IMC::store(type, bfr__ + 2);
+      IMC::store(tow, bfr__ + 3);
+      IMC::store(base_lat, bfr__ + 7);
+      IMC::store(base_lon, bfr__ + 15);
+      IMC::store(base_height, bfr__ + 23);
+      IMC::store(n, bfr__ + 27);
+      IMC::store(e, bfr__ + 31);
+      IMC::store(d, bfr__ + 35);
+      IMC::store(v_n, bfr__ + 39);
+      IMC::store(v_e, bfr__ + 43);
+      IMC::store(v_d, bfr__ + 47);
+      IMC::store(satellites, bfr__ + 51);
+      IMC::store(iar_hyp, bfr__ + 52);
+      IMC::store(iar_ratio, bfr__ + 54);
+      return bfr__ + 58;
     }
 
     uint16_t
     GpsFixRtk::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(tow, bfr__, size__);
-      bfr__ += IMC::deserialize(base_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(base_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(base_height, bfr__, size__);
-      bfr__ += IMC::deserialize(n, bfr__, size__);
-      bfr__ += IMC::deserialize(e, bfr__, size__);
-      bfr__ += IMC::deserialize(d, bfr__, size__);
-      bfr__ += IMC::deserialize(v_n, bfr__, size__);
-      bfr__ += IMC::deserialize(v_e, bfr__, size__);
-      bfr__ += IMC::deserialize(v_d, bfr__, size__);
-      bfr__ += IMC::deserialize(satellites, bfr__, size__);
-      bfr__ += IMC::deserialize(iar_hyp, bfr__, size__);
-      bfr__ += IMC::deserialize(iar_ratio, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 58) throw BufferTooShort();
+      IMC::load(validity, bfr__ + 0);
+      IMC::load(type, bfr__ + 2);
+      IMC::load(tow, bfr__ + 3);
+      IMC::load(base_lat, bfr__ + 7);
+      IMC::load(base_lon, bfr__ + 15);
+      IMC::load(base_height, bfr__ + 23);
+      IMC::load(n, bfr__ + 27);
+      IMC::load(e, bfr__ + 31);
+      IMC::load(d, bfr__ + 35);
+      IMC::load(v_n, bfr__ + 39);
+      IMC::load(v_e, bfr__ + 43);
+      IMC::load(v_d, bfr__ + 47);
+      IMC::load(satellites, bfr__ + 51);
+      IMC::load(iar_hyp, bfr__ + 52);
+      IMC::load(iar_ratio, bfr__ + 54);
+      return 58;
     }
 
     uint16_t
     GpsFixRtk::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(tow, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(base_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(base_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(base_height, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(n, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(e, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(d, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v_n, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v_e, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v_d, bfr__, size__);
-      bfr__ += IMC::deserialize(satellites, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(iar_hyp, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(iar_ratio, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 58) throw BufferTooShort();
+      IMC::reverseLoad(validity, bfr__ + 0);
+      IMC::load(type, bfr__ + 2);
+      IMC::reverseLoad(tow, bfr__ + 3);
+      IMC::reverseLoad(base_lat, bfr__ + 7);
+      IMC::reverseLoad(base_lon, bfr__ + 15);
+      IMC::reverseLoad(base_height, bfr__ + 23);
+      IMC::reverseLoad(n, bfr__ + 27);
+      IMC::reverseLoad(e, bfr__ + 31);
+      IMC::reverseLoad(d, bfr__ + 35);
+      IMC::reverseLoad(v_n, bfr__ + 39);
+      IMC::reverseLoad(v_e, bfr__ + 43);
+      IMC::reverseLoad(v_d, bfr__ + 47);
+      IMC::load(satellites, bfr__ + 51);
+      IMC::reverseLoad(iar_hyp, bfr__ + 52);
+      IMC::reverseLoad(iar_ratio, bfr__ + 54);
+      return 58;
     }
 
     void
@@ -8148,82 +8094,81 @@ namespace DUNE
     uint8_t*
     EstimatedState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(height, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      ptr__ += IMC::serialize(u, ptr__);
-      ptr__ += IMC::serialize(v, ptr__);
-      ptr__ += IMC::serialize(w, ptr__);
-      ptr__ += IMC::serialize(vx, ptr__);
-      ptr__ += IMC::serialize(vy, ptr__);
-      ptr__ += IMC::serialize(vz, ptr__);
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(q, ptr__);
-      ptr__ += IMC::serialize(r, ptr__);
-      ptr__ += IMC::serialize(depth, ptr__);
-      ptr__ += IMC::serialize(alt, ptr__);
-      return ptr__;
+      IMC::store(lat, bfr__ + 0);
+      IMC::store(lon, bfr__ + 8);
+      IMC::store(height, bfr__ + 16);
+      IMC::store(x, bfr__ + 20);
+      IMC::store(y, bfr__ + 24);
+      IMC::store(z, bfr__ + 28);
+      IMC::store(phi, bfr__ + 32);
+      IMC::store(theta, bfr__ + 36);
+      IMC::store(psi, bfr__ + 40);
+      IMC::store(u, bfr__ + 44);
+      IMC::store(v, bfr__ + 48);
+      IMC::store(w, bfr__ + 52);
+      IMC::store(vx, bfr__ + 56);
+      IMC::store(vy, bfr__ + 60);
+      IMC::store(vz, bfr__ + 64);
+      IMC::store(p, bfr__ + 68);
+      IMC::store(q, bfr__ + 72);
+      IMC::store(r, bfr__ + 76);
+      IMC::store(depth, bfr__ + 80);
+      IMC::store(alt, bfr__ + 84);
+      return bfr__ + 88;
     }
 
     uint16_t
     EstimatedState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(height, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      bfr__ += IMC::deserialize(u, bfr__, size__);
-      bfr__ += IMC::deserialize(v, bfr__, size__);
-      bfr__ += IMC::deserialize(w, bfr__, size__);
-      bfr__ += IMC::deserialize(vx, bfr__, size__);
-      bfr__ += IMC::deserialize(vy, bfr__, size__);
-      bfr__ += IMC::deserialize(vz, bfr__, size__);
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(q, bfr__, size__);
-      bfr__ += IMC::deserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::deserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 88) throw BufferTooShort();
+      IMC::load(lat, bfr__ + 0);
+      IMC::load(lon, bfr__ + 8);
+      IMC::load(height, bfr__ + 16);
+      IMC::load(x, bfr__ + 20);
+      IMC::load(y, bfr__ + 24);
+      IMC::load(z, bfr__ + 28);
+      IMC::load(phi, bfr__ + 32);
+      IMC::load(theta, bfr__ + 36);
+      IMC::load(psi, bfr__ + 40);
+      IMC::load(u, bfr__ + 44);
+      IMC::load(v, bfr__ + 48);
+      IMC::load(w, bfr__ + 52);
+      IMC::load(vx, bfr__ + 56);
+      IMC::load(vy, bfr__ + 60);
+      IMC::load(vz, bfr__ + 64);
+      IMC::load(p, bfr__ + 68);
+      IMC::load(q, bfr__ + 72);
+      IMC::load(r, bfr__ + 76);
+      IMC::load(depth, bfr__ + 80);
+      IMC::load(alt, bfr__ + 84);
+      return 88;
     }
 
     uint16_t
     EstimatedState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(u, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(w, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vx, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vy, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vz, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(r, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 88) throw BufferTooShort();
+      IMC::reverseLoad(lat, bfr__ + 0);
+      IMC::reverseLoad(lon, bfr__ + 8);
+      IMC::reverseLoad(height, bfr__ + 16);
+      IMC::reverseLoad(x, bfr__ + 20);
+      IMC::reverseLoad(y, bfr__ + 24);
+      IMC::reverseLoad(z, bfr__ + 28);
+      IMC::reverseLoad(phi, bfr__ + 32);
+      IMC::reverseLoad(theta, bfr__ + 36);
+      IMC::reverseLoad(psi, bfr__ + 40);
+      IMC::reverseLoad(u, bfr__ + 44);
+      IMC::reverseLoad(v, bfr__ + 48);
+      IMC::reverseLoad(w, bfr__ + 52);
+      IMC::reverseLoad(vx, bfr__ + 56);
+      IMC::reverseLoad(vy, bfr__ + 60);
+      IMC::reverseLoad(vz, bfr__ + 64);
+      IMC::reverseLoad(p, bfr__ + 68);
+      IMC::reverseLoad(q, bfr__ + 72);
+      IMC::reverseLoad(r, bfr__ + 76);
+      IMC::reverseLoad(depth, bfr__ + 80);
+      IMC::reverseLoad(alt, bfr__ + 84);
+      return 88;
     }
 
     void
@@ -8388,25 +8333,24 @@ namespace DUNE
     uint8_t*
     DissolvedOxygen::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     DissolvedOxygen::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     DissolvedOxygen::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -8456,25 +8400,24 @@ namespace DUNE
     uint8_t*
     AirSaturation::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     AirSaturation::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     AirSaturation::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -8524,25 +8467,24 @@ namespace DUNE
     uint8_t*
     Throttle::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     Throttle::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     Throttle::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -8592,25 +8534,24 @@ namespace DUNE
     uint8_t*
     PH::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     PH::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     PH::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -8660,25 +8601,24 @@ namespace DUNE
     uint8_t*
     Redox::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Redox::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Redox::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -8732,31 +8672,30 @@ namespace DUNE
     uint8_t*
     CameraZoom::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(zoom, ptr__);
-      ptr__ += IMC::serialize(action, ptr__);
-      return ptr__;
+      IMC::store(id, bfr__ + 0);
+      IMC::store(zoom, bfr__ + 1);
+      IMC::store(action, bfr__ + 2);
+      return bfr__ + 3;
     }
 
     uint16_t
     CameraZoom::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(zoom, bfr__, size__);
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 3) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(zoom, bfr__ + 1);
+      IMC::load(action, bfr__ + 2);
+      return 3;
     }
 
     uint16_t
     CameraZoom::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(zoom, bfr__, size__);
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 3) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(zoom, bfr__ + 1);
+      IMC::load(action, bfr__ + 2);
+      return 3;
     }
 
     uint16_t
@@ -8811,28 +8750,27 @@ namespace DUNE
     uint8_t*
     SetThrusterActuation::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(id, bfr__ + 0);
+      IMC::store(value, bfr__ + 1);
+      return bfr__ + 5;
     }
 
     uint16_t
     SetThrusterActuation::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(value, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
     SetThrusterActuation::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::reverseLoad(value, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
@@ -8898,28 +8836,27 @@ namespace DUNE
     uint8_t*
     SetServoPosition::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(id, bfr__ + 0);
+      IMC::store(value, bfr__ + 1);
+      return bfr__ + 5;
     }
 
     uint16_t
     SetServoPosition::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(value, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
     SetServoPosition::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::reverseLoad(value, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
@@ -8984,28 +8921,27 @@ namespace DUNE
     uint8_t*
     SetControlSurfaceDeflection::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(angle, ptr__);
-      return ptr__;
+      IMC::store(id, bfr__ + 0);
+      IMC::store(angle, bfr__ + 1);
+      return bfr__ + 5;
     }
 
     uint16_t
     SetControlSurfaceDeflection::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(angle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(angle, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
     SetControlSurfaceDeflection::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(angle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::reverseLoad(angle, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
@@ -9176,28 +9112,27 @@ namespace DUNE
     uint8_t*
     ButtonEvent::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(button, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(button, bfr__ + 0);
+      IMC::store(value, bfr__ + 1);
+      return bfr__ + 2;
     }
 
     uint16_t
     ButtonEvent::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(button, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 2) throw BufferTooShort();
+      IMC::load(button, bfr__ + 0);
+      IMC::load(value, bfr__ + 1);
+      return 2;
     }
 
     uint16_t
     ButtonEvent::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(button, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 2) throw BufferTooShort();
+      IMC::load(button, bfr__ + 0);
+      IMC::load(value, bfr__ + 1);
+      return 2;
     }
 
     fp64_t
@@ -9314,31 +9249,30 @@ namespace DUNE
     uint8_t*
     PowerOperation::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(time_remain, ptr__);
-      ptr__ += IMC::serialize(sched_time, ptr__);
-      return ptr__;
+      IMC::store(op, bfr__ + 0);
+      IMC::store(time_remain, bfr__ + 1);
+      IMC::store(sched_time, bfr__ + 5);
+      return bfr__ + 13;
     }
 
     uint16_t
     PowerOperation::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(time_remain, bfr__, size__);
-      bfr__ += IMC::deserialize(sched_time, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 13) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      IMC::load(time_remain, bfr__ + 1);
+      IMC::load(sched_time, bfr__ + 5);
+      return 13;
     }
 
     uint16_t
     PowerOperation::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_remain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sched_time, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 13) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      IMC::reverseLoad(time_remain, bfr__ + 1);
+      IMC::reverseLoad(sched_time, bfr__ + 5);
+      return 13;
     }
 
     void
@@ -9756,31 +9690,30 @@ namespace DUNE
     uint8_t*
     SetPWM::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(period, ptr__);
-      ptr__ += IMC::serialize(duty_cycle, ptr__);
-      return ptr__;
+      IMC::store(id, bfr__ + 0);
+      IMC::store(period, bfr__ + 1);
+      IMC::store(duty_cycle, bfr__ + 5);
+      return bfr__ + 9;
     }
 
     uint16_t
     SetPWM::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(period, bfr__, size__);
-      bfr__ += IMC::deserialize(duty_cycle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(period, bfr__ + 1);
+      IMC::load(duty_cycle, bfr__ + 5);
+      return 9;
     }
 
     uint16_t
     SetPWM::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(period, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duty_cycle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::reverseLoad(period, bfr__ + 1);
+      IMC::reverseLoad(duty_cycle, bfr__ + 5);
+      return 9;
     }
 
     uint16_t
@@ -9836,31 +9769,30 @@ namespace DUNE
     uint8_t*
     PWM::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(period, ptr__);
-      ptr__ += IMC::serialize(duty_cycle, ptr__);
-      return ptr__;
+      IMC::store(id, bfr__ + 0);
+      IMC::store(period, bfr__ + 1);
+      IMC::store(duty_cycle, bfr__ + 5);
+      return bfr__ + 9;
     }
 
     uint16_t
     PWM::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(period, bfr__, size__);
-      bfr__ += IMC::deserialize(duty_cycle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(period, bfr__ + 1);
+      IMC::load(duty_cycle, bfr__ + 5);
+      return 9;
     }
 
     uint16_t
     PWM::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(period, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duty_cycle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::reverseLoad(period, bfr__ + 1);
+      IMC::reverseLoad(duty_cycle, bfr__ + 5);
+      return 9;
     }
 
     uint16_t
@@ -9916,31 +9848,30 @@ namespace DUNE
     uint8_t*
     EstimatedStreamVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::store(x, bfr__ + 0);
+      IMC::store(y, bfr__ + 8);
+      IMC::store(z, bfr__ + 16);
+      return bfr__ + 24;
     }
 
     uint16_t
     EstimatedStreamVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24) throw BufferTooShort();
+      IMC::load(x, bfr__ + 0);
+      IMC::load(y, bfr__ + 8);
+      IMC::load(z, bfr__ + 16);
+      return 24;
     }
 
     uint16_t
     EstimatedStreamVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24) throw BufferTooShort();
+      IMC::reverseLoad(x, bfr__ + 0);
+      IMC::reverseLoad(y, bfr__ + 8);
+      IMC::reverseLoad(z, bfr__ + 16);
+      return 24;
     }
 
     void
@@ -9980,25 +9911,24 @@ namespace DUNE
     uint8_t*
     IndicatedSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     IndicatedSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     IndicatedSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -10048,25 +9978,24 @@ namespace DUNE
     uint8_t*
     TrueSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     TrueSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     TrueSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -10142,64 +10071,63 @@ namespace DUNE
     uint8_t*
     NavigationUncertainty::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(q, ptr__);
-      ptr__ += IMC::serialize(r, ptr__);
-      ptr__ += IMC::serialize(u, ptr__);
-      ptr__ += IMC::serialize(v, ptr__);
-      ptr__ += IMC::serialize(w, ptr__);
-      ptr__ += IMC::serialize(bias_psi, ptr__);
-      ptr__ += IMC::serialize(bias_r, ptr__);
-      return ptr__;
+      IMC::store(x, bfr__ + 0);
+      IMC::store(y, bfr__ + 4);
+      IMC::store(z, bfr__ + 8);
+      IMC::store(phi, bfr__ + 12);
+      IMC::store(theta, bfr__ + 16);
+      IMC::store(psi, bfr__ + 20);
+      IMC::store(p, bfr__ + 24);
+      IMC::store(q, bfr__ + 28);
+      IMC::store(r, bfr__ + 32);
+      IMC::store(u, bfr__ + 36);
+      IMC::store(v, bfr__ + 40);
+      IMC::store(w, bfr__ + 44);
+      IMC::store(bias_psi, bfr__ + 48);
+      IMC::store(bias_r, bfr__ + 52);
+      return bfr__ + 56;
     }
 
     uint16_t
     NavigationUncertainty::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(q, bfr__, size__);
-      bfr__ += IMC::deserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(u, bfr__, size__);
-      bfr__ += IMC::deserialize(v, bfr__, size__);
-      bfr__ += IMC::deserialize(w, bfr__, size__);
-      bfr__ += IMC::deserialize(bias_psi, bfr__, size__);
-      bfr__ += IMC::deserialize(bias_r, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 56) throw BufferTooShort();
+      IMC::load(x, bfr__ + 0);
+      IMC::load(y, bfr__ + 4);
+      IMC::load(z, bfr__ + 8);
+      IMC::load(phi, bfr__ + 12);
+      IMC::load(theta, bfr__ + 16);
+      IMC::load(psi, bfr__ + 20);
+      IMC::load(p, bfr__ + 24);
+      IMC::load(q, bfr__ + 28);
+      IMC::load(r, bfr__ + 32);
+      IMC::load(u, bfr__ + 36);
+      IMC::load(v, bfr__ + 40);
+      IMC::load(w, bfr__ + 44);
+      IMC::load(bias_psi, bfr__ + 48);
+      IMC::load(bias_r, bfr__ + 52);
+      return 56;
     }
 
     uint16_t
     NavigationUncertainty::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(r, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(u, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(w, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bias_psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bias_r, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 56) throw BufferTooShort();
+      IMC::reverseLoad(x, bfr__ + 0);
+      IMC::reverseLoad(y, bfr__ + 4);
+      IMC::reverseLoad(z, bfr__ + 8);
+      IMC::reverseLoad(phi, bfr__ + 12);
+      IMC::reverseLoad(theta, bfr__ + 16);
+      IMC::reverseLoad(psi, bfr__ + 20);
+      IMC::reverseLoad(p, bfr__ + 24);
+      IMC::reverseLoad(q, bfr__ + 28);
+      IMC::reverseLoad(r, bfr__ + 32);
+      IMC::reverseLoad(u, bfr__ + 36);
+      IMC::reverseLoad(v, bfr__ + 40);
+      IMC::reverseLoad(w, bfr__ + 44);
+      IMC::reverseLoad(bias_psi, bfr__ + 48);
+      IMC::reverseLoad(bias_r, bfr__ + 52);
+      return 56;
     }
 
     void
@@ -10266,49 +10194,48 @@ namespace DUNE
     uint8_t*
     NavigationData::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(bias_psi, ptr__);
-      ptr__ += IMC::serialize(bias_r, ptr__);
-      ptr__ += IMC::serialize(cog, ptr__);
-      ptr__ += IMC::serialize(cyaw, ptr__);
-      ptr__ += IMC::serialize(lbl_rej_level, ptr__);
-      ptr__ += IMC::serialize(gps_rej_level, ptr__);
-      ptr__ += IMC::serialize(custom_x, ptr__);
-      ptr__ += IMC::serialize(custom_y, ptr__);
-      ptr__ += IMC::serialize(custom_z, ptr__);
-      return ptr__;
+      IMC::store(bias_psi, bfr__ + 0);
+      IMC::store(bias_r, bfr__ + 4);
+      IMC::store(cog, bfr__ + 8);
+      IMC::store(cyaw, bfr__ + 12);
+      IMC::store(lbl_rej_level, bfr__ + 16);
+      IMC::store(gps_rej_level, bfr__ + 20);
+      IMC::store(custom_x, bfr__ + 24);
+      IMC::store(custom_y, bfr__ + 28);
+      IMC::store(custom_z, bfr__ + 32);
+      return bfr__ + 36;
     }
 
     uint16_t
     NavigationData::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(bias_psi, bfr__, size__);
-      bfr__ += IMC::deserialize(bias_r, bfr__, size__);
-      bfr__ += IMC::deserialize(cog, bfr__, size__);
-      bfr__ += IMC::deserialize(cyaw, bfr__, size__);
-      bfr__ += IMC::deserialize(lbl_rej_level, bfr__, size__);
-      bfr__ += IMC::deserialize(gps_rej_level, bfr__, size__);
-      bfr__ += IMC::deserialize(custom_x, bfr__, size__);
-      bfr__ += IMC::deserialize(custom_y, bfr__, size__);
-      bfr__ += IMC::deserialize(custom_z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 36) throw BufferTooShort();
+      IMC::load(bias_psi, bfr__ + 0);
+      IMC::load(bias_r, bfr__ + 4);
+      IMC::load(cog, bfr__ + 8);
+      IMC::load(cyaw, bfr__ + 12);
+      IMC::load(lbl_rej_level, bfr__ + 16);
+      IMC::load(gps_rej_level, bfr__ + 20);
+      IMC::load(custom_x, bfr__ + 24);
+      IMC::load(custom_y, bfr__ + 28);
+      IMC::load(custom_z, bfr__ + 32);
+      return 36;
     }
 
     uint16_t
     NavigationData::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(bias_psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bias_r, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(cog, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(cyaw, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lbl_rej_level, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(gps_rej_level, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(custom_x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(custom_y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(custom_z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 36) throw BufferTooShort();
+      IMC::reverseLoad(bias_psi, bfr__ + 0);
+      IMC::reverseLoad(bias_r, bfr__ + 4);
+      IMC::reverseLoad(cog, bfr__ + 8);
+      IMC::reverseLoad(cyaw, bfr__ + 12);
+      IMC::reverseLoad(lbl_rej_level, bfr__ + 16);
+      IMC::reverseLoad(gps_rej_level, bfr__ + 20);
+      IMC::reverseLoad(custom_x, bfr__ + 24);
+      IMC::reverseLoad(custom_y, bfr__ + 28);
+      IMC::reverseLoad(custom_z, bfr__ + 32);
+      return 36;
     }
 
     void
@@ -10356,28 +10283,27 @@ namespace DUNE
     uint8_t*
     GpsFixRejection::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(utc_time, ptr__);
-      ptr__ += IMC::serialize(reason, ptr__);
-      return ptr__;
+      IMC::store(utc_time, bfr__ + 0);
+      IMC::store(reason, bfr__ + 4);
+      return bfr__ + 5;
     }
 
     uint16_t
     GpsFixRejection::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(utc_time, bfr__, size__);
-      bfr__ += IMC::deserialize(reason, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(utc_time, bfr__ + 0);
+      IMC::load(reason, bfr__ + 4);
+      return 5;
     }
 
     uint16_t
     GpsFixRejection::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(utc_time, bfr__, size__);
-      bfr__ += IMC::deserialize(reason, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::reverseLoad(utc_time, bfr__ + 0);
+      IMC::load(reason, bfr__ + 4);
+      return 5;
     }
 
     void
@@ -10420,31 +10346,30 @@ namespace DUNE
     uint8_t*
     LblRangeAcceptance::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(range, ptr__);
-      ptr__ += IMC::serialize(acceptance, ptr__);
-      return ptr__;
+      IMC::store(id, bfr__ + 0);
+      IMC::store(range, bfr__ + 1);
+      IMC::store(acceptance, bfr__ + 5);
+      return bfr__ + 6;
     }
 
     uint16_t
     LblRangeAcceptance::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(range, bfr__, size__);
-      bfr__ += IMC::deserialize(acceptance, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 6) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::load(range, bfr__ + 1);
+      IMC::load(acceptance, bfr__ + 5);
+      return 6;
     }
 
     uint16_t
     LblRangeAcceptance::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(range, bfr__, size__);
-      bfr__ += IMC::deserialize(acceptance, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 6) throw BufferTooShort();
+      IMC::load(id, bfr__ + 0);
+      IMC::reverseLoad(range, bfr__ + 1);
+      IMC::load(acceptance, bfr__ + 5);
+      return 6;
     }
 
     uint16_t
@@ -10502,34 +10427,33 @@ namespace DUNE
     uint8_t*
     DvlRejection::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(type, ptr__);
-      ptr__ += IMC::serialize(reason, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(timestep, ptr__);
-      return ptr__;
+      IMC::store(type, bfr__ + 0);
+      IMC::store(reason, bfr__ + 1);
+      IMC::store(value, bfr__ + 2);
+      IMC::store(timestep, bfr__ + 6);
+      return bfr__ + 10;
     }
 
     uint16_t
     DvlRejection::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(reason, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(timestep, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 10) throw BufferTooShort();
+      IMC::load(type, bfr__ + 0);
+      IMC::load(reason, bfr__ + 1);
+      IMC::load(value, bfr__ + 2);
+      IMC::load(timestep, bfr__ + 6);
+      return 10;
     }
 
     uint16_t
     DvlRejection::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(reason, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(timestep, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 10) throw BufferTooShort();
+      IMC::load(type, bfr__ + 0);
+      IMC::load(reason, bfr__ + 1);
+      IMC::reverseLoad(value, bfr__ + 2);
+      IMC::reverseLoad(timestep, bfr__ + 6);
+      return 10;
     }
 
     fp64_t
@@ -10714,25 +10638,24 @@ namespace DUNE
     uint8_t*
     AlignmentState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(state, ptr__);
-      return ptr__;
+      IMC::store(state, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     AlignmentState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1) throw BufferTooShort();
+      IMC::load(state, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     AlignmentState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1) throw BufferTooShort();
+      IMC::load(state, bfr__ + 0);
+      return 1;
     }
 
     void
@@ -10774,31 +10697,30 @@ namespace DUNE
     uint8_t*
     GroupStreamVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::store(x, bfr__ + 0);
+      IMC::store(y, bfr__ + 8);
+      IMC::store(z, bfr__ + 16);
+      return bfr__ + 24;
     }
 
     uint16_t
     GroupStreamVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24) throw BufferTooShort();
+      IMC::load(x, bfr__ + 0);
+      IMC::load(y, bfr__ + 8);
+      IMC::load(z, bfr__ + 16);
+      return 24;
     }
 
     uint16_t
     GroupStreamVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24) throw BufferTooShort();
+      IMC::reverseLoad(x, bfr__ + 0);
+      IMC::reverseLoad(y, bfr__ + 8);
+      IMC::reverseLoad(z, bfr__ + 16);
+      return 24;
     }
 
     void
@@ -10842,31 +10764,30 @@ namespace DUNE
     uint8_t*
     Airflow::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(va, ptr__);
-      ptr__ += IMC::serialize(aoa, ptr__);
-      ptr__ += IMC::serialize(ssa, ptr__);
-      return ptr__;
+      IMC::store(va, bfr__ + 0);
+      IMC::store(aoa, bfr__ + 4);
+      IMC::store(ssa, bfr__ + 8);
+      return bfr__ + 12;
     }
 
     uint16_t
     Airflow::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(va, bfr__, size__);
-      bfr__ += IMC::deserialize(aoa, bfr__, size__);
-      bfr__ += IMC::deserialize(ssa, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12) throw BufferTooShort();
+      IMC::load(va, bfr__ + 0);
+      IMC::load(aoa, bfr__ + 4);
+      IMC::load(ssa, bfr__ + 8);
+      return 12;
     }
 
     uint16_t
     Airflow::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(va, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(aoa, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ssa, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12) throw BufferTooShort();
+      IMC::reverseLoad(va, bfr__ + 0);
+      IMC::reverseLoad(aoa, bfr__ + 4);
+      IMC::reverseLoad(ssa, bfr__ + 8);
+      return 12;
     }
 
     void
@@ -10906,25 +10827,24 @@ namespace DUNE
     uint8_t*
     DesiredHeading::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     DesiredHeading::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     DesiredHeading::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -10976,28 +10896,27 @@ namespace DUNE
     uint8_t*
     DesiredZ::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(z_units, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      IMC::store(z_units, bfr__ + 4);
+      return bfr__ + 5;
     }
 
     uint16_t
     DesiredZ::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      IMC::load(z_units, bfr__ + 4);
+      return 5;
     }
 
     uint16_t
     DesiredZ::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      IMC::load(z_units, bfr__ + 4);
+      return 5;
     }
 
     fp64_t
@@ -11050,28 +10969,27 @@ namespace DUNE
     uint8_t*
     DesiredSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(speed_units, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      IMC::store(speed_units, bfr__ + 8);
+      return bfr__ + 9;
     }
 
     uint16_t
     DesiredSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      IMC::load(speed_units, bfr__ + 8);
+      return 9;
     }
 
     uint16_t
     DesiredSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      IMC::load(speed_units, bfr__ + 8);
+      return 9;
     }
 
     fp64_t
@@ -11122,25 +11040,24 @@ namespace DUNE
     uint8_t*
     DesiredRoll::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     DesiredRoll::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     DesiredRoll::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -11190,25 +11107,24 @@ namespace DUNE
     uint8_t*
     DesiredPitch::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     DesiredPitch::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     DesiredPitch::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -11258,25 +11174,24 @@ namespace DUNE
     uint8_t*
     DesiredVerticalRate::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     DesiredVerticalRate::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     DesiredVerticalRate::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -11354,61 +11269,60 @@ namespace DUNE
     uint8_t*
     DesiredPath::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(path_ref, ptr__);
-      ptr__ += IMC::serialize(start_lat, ptr__);
-      ptr__ += IMC::serialize(start_lon, ptr__);
-      ptr__ += IMC::serialize(start_z, ptr__);
-      ptr__ += IMC::serialize(start_z_units, ptr__);
-      ptr__ += IMC::serialize(end_lat, ptr__);
-      ptr__ += IMC::serialize(end_lon, ptr__);
-      ptr__ += IMC::serialize(end_z, ptr__);
-      ptr__ += IMC::serialize(end_z_units, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(speed_units, ptr__);
-      ptr__ += IMC::serialize(lradius, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      return ptr__;
+      IMC::store(path_ref, bfr__ + 0);
+      IMC::store(start_lat, bfr__ + 4);
+      IMC::store(start_lon, bfr__ + 12);
+      IMC::store(start_z, bfr__ + 20);
+      IMC::store(start_z_units, bfr__ + 24);
+      IMC::store(end_lat, bfr__ + 25);
+      IMC::store(end_lon, bfr__ + 33);
+      IMC::store(end_z, bfr__ + 41);
+      IMC::store(end_z_units, bfr__ + 45);
+      IMC::store(speed, bfr__ + 46);
+      IMC::store(speed_units, bfr__ + 50);
+      IMC::store(lradius, bfr__ + 51);
+      IMC::store(flags, bfr__ + 55);
+      return bfr__ + 56;
     }
 
     uint16_t
     DesiredPath::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(path_ref, bfr__, size__);
-      bfr__ += IMC::deserialize(start_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(start_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(end_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(end_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::deserialize(lradius, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 56) throw BufferTooShort();
+      IMC::load(path_ref, bfr__ + 0);
+      IMC::load(start_lat, bfr__ + 4);
+      IMC::load(start_lon, bfr__ + 12);
+      IMC::load(start_z, bfr__ + 20);
+      IMC::load(start_z_units, bfr__ + 24);
+      IMC::load(end_lat, bfr__ + 25);
+      IMC::load(end_lon, bfr__ + 33);
+      IMC::load(end_z, bfr__ + 41);
+      IMC::load(end_z_units, bfr__ + 45);
+      IMC::load(speed, bfr__ + 46);
+      IMC::load(speed_units, bfr__ + 50);
+      IMC::load(lradius, bfr__ + 51);
+      IMC::load(flags, bfr__ + 55);
+      return 56;
     }
 
     uint16_t
     DesiredPath::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(path_ref, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_z, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_z, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lradius, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 56) throw BufferTooShort();
+      IMC::reverseLoad(path_ref, bfr__ + 0);
+      IMC::reverseLoad(start_lat, bfr__ + 4);
+      IMC::reverseLoad(start_lon, bfr__ + 12);
+      IMC::reverseLoad(start_z, bfr__ + 20);
+      IMC::load(start_z_units, bfr__ + 24);
+      IMC::reverseLoad(end_lat, bfr__ + 25);
+      IMC::reverseLoad(end_lon, bfr__ + 33);
+      IMC::reverseLoad(end_z, bfr__ + 41);
+      IMC::load(end_z_units, bfr__ + 45);
+      IMC::reverseLoad(speed, bfr__ + 46);
+      IMC::load(speed_units, bfr__ + 50);
+      IMC::reverseLoad(lradius, bfr__ + 51);
+      IMC::load(flags, bfr__ + 55);
+      return 56;
     }
 
     void
@@ -11470,43 +11384,42 @@ namespace DUNE
     uint8_t*
     DesiredControl::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(k, ptr__);
-      ptr__ += IMC::serialize(m, ptr__);
-      ptr__ += IMC::serialize(n, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      return ptr__;
+      IMC::store(x, bfr__ + 0);
+      IMC::store(y, bfr__ + 8);
+      IMC::store(z, bfr__ + 16);
+      IMC::store(k, bfr__ + 24);
+      IMC::store(m, bfr__ + 32);
+      IMC::store(n, bfr__ + 40);
+      IMC::store(flags, bfr__ + 48);
+      return bfr__ + 49;
     }
 
     uint16_t
     DesiredControl::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(k, bfr__, size__);
-      bfr__ += IMC::deserialize(m, bfr__, size__);
-      bfr__ += IMC::deserialize(n, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 49) throw BufferTooShort();
+      IMC::load(x, bfr__ + 0);
+      IMC::load(y, bfr__ + 8);
+      IMC::load(z, bfr__ + 16);
+      IMC::load(k, bfr__ + 24);
+      IMC::load(m, bfr__ + 32);
+      IMC::load(n, bfr__ + 40);
+      IMC::load(flags, bfr__ + 48);
+      return 49;
     }
 
     uint16_t
     DesiredControl::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(k, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(m, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(n, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 49) throw BufferTooShort();
+      IMC::reverseLoad(x, bfr__ + 0);
+      IMC::reverseLoad(y, bfr__ + 8);
+      IMC::reverseLoad(z, bfr__ + 16);
+      IMC::reverseLoad(k, bfr__ + 24);
+      IMC::reverseLoad(m, bfr__ + 32);
+      IMC::reverseLoad(n, bfr__ + 40);
+      IMC::load(flags, bfr__ + 48);
+      return 49;
     }
 
     void
@@ -11550,25 +11463,24 @@ namespace DUNE
     uint8_t*
     DesiredHeadingRate::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     DesiredHeadingRate::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     DesiredHeadingRate::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -11630,43 +11542,42 @@ namespace DUNE
     uint8_t*
     DesiredVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(u, ptr__);
-      ptr__ += IMC::serialize(v, ptr__);
-      ptr__ += IMC::serialize(w, ptr__);
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(q, ptr__);
-      ptr__ += IMC::serialize(r, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      return ptr__;
+      IMC::store(u, bfr__ + 0);
+      IMC::store(v, bfr__ + 8);
+      IMC::store(w, bfr__ + 16);
+      IMC::store(p, bfr__ + 24);
+      IMC::store(q, bfr__ + 32);
+      IMC::store(r, bfr__ + 40);
+      IMC::store(flags, bfr__ + 48);
+      return bfr__ + 49;
     }
 
     uint16_t
     DesiredVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(u, bfr__, size__);
-      bfr__ += IMC::deserialize(v, bfr__, size__);
-      bfr__ += IMC::deserialize(w, bfr__, size__);
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(q, bfr__, size__);
-      bfr__ += IMC::deserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 49) throw BufferTooShort();
+      IMC::load(u, bfr__ + 0);
+      IMC::load(v, bfr__ + 8);
+      IMC::load(w, bfr__ + 16);
+      IMC::load(p, bfr__ + 24);
+      IMC::load(q, bfr__ + 32);
+      IMC::load(r, bfr__ + 40);
+      IMC::load(flags, bfr__ + 48);
+      return 49;
     }
 
     uint16_t
     DesiredVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(u, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(w, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 49) throw BufferTooShort();
+      IMC::reverseLoad(u, bfr__ + 0);
+      IMC::reverseLoad(v, bfr__ + 8);
+      IMC::reverseLoad(w, bfr__ + 16);
+      IMC::reverseLoad(p, bfr__ + 24);
+      IMC::reverseLoad(q, bfr__ + 32);
+      IMC::reverseLoad(r, bfr__ + 40);
+      IMC::load(flags, bfr__ + 48);
+      return 49;
     }
 
     void
@@ -11750,79 +11661,78 @@ namespace DUNE
     uint8_t*
     PathControlState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(path_ref, ptr__);
-      ptr__ += IMC::serialize(start_lat, ptr__);
-      ptr__ += IMC::serialize(start_lon, ptr__);
-      ptr__ += IMC::serialize(start_z, ptr__);
-      ptr__ += IMC::serialize(start_z_units, ptr__);
-      ptr__ += IMC::serialize(end_lat, ptr__);
-      ptr__ += IMC::serialize(end_lon, ptr__);
-      ptr__ += IMC::serialize(end_z, ptr__);
-      ptr__ += IMC::serialize(end_z_units, ptr__);
-      ptr__ += IMC::serialize(lradius, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(vx, ptr__);
-      ptr__ += IMC::serialize(vy, ptr__);
-      ptr__ += IMC::serialize(vz, ptr__);
-      ptr__ += IMC::serialize(course_error, ptr__);
-      ptr__ += IMC::serialize(eta, ptr__);
-      return ptr__;
+      IMC::store(path_ref, bfr__ + 0);
+      IMC::store(start_lat, bfr__ + 4);
+      IMC::store(start_lon, bfr__ + 12);
+      IMC::store(start_z, bfr__ + 20);
+      IMC::store(start_z_units, bfr__ + 24);
+      IMC::store(end_lat, bfr__ + 25);
+      IMC::store(end_lon, bfr__ + 33);
+      IMC::store(end_z, bfr__ + 41);
+      IMC::store(end_z_units, bfr__ + 45);
+      IMC::store(lradius, bfr__ + 46);
+      IMC::store(flags, bfr__ + 50);
+      IMC::store(x, bfr__ + 51);
+      IMC::store(y, bfr__ + 55);
+      IMC::store(z, bfr__ + 59);
+      IMC::store(vx, bfr__ + 63);
+      IMC::store(vy, bfr__ + 67);
+      IMC::store(vz, bfr__ + 71);
+      IMC::store(course_error, bfr__ + 75);
+      IMC::store(eta, bfr__ + 79);
+      return bfr__ + 81;
     }
 
     uint16_t
     PathControlState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(path_ref, bfr__, size__);
-      bfr__ += IMC::deserialize(start_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(start_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(end_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(end_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(lradius, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(vx, bfr__, size__);
-      bfr__ += IMC::deserialize(vy, bfr__, size__);
-      bfr__ += IMC::deserialize(vz, bfr__, size__);
-      bfr__ += IMC::deserialize(course_error, bfr__, size__);
-      bfr__ += IMC::deserialize(eta, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 81) throw BufferTooShort();
+      IMC::load(path_ref, bfr__ + 0);
+      IMC::load(start_lat, bfr__ + 4);
+      IMC::load(start_lon, bfr__ + 12);
+      IMC::load(start_z, bfr__ + 20);
+      IMC::load(start_z_units, bfr__ + 24);
+      IMC::load(end_lat, bfr__ + 25);
+      IMC::load(end_lon, bfr__ + 33);
+      IMC::load(end_z, bfr__ + 41);
+      IMC::load(end_z_units, bfr__ + 45);
+      IMC::load(lradius, bfr__ + 46);
+      IMC::load(flags, bfr__ + 50);
+      IMC::load(x, bfr__ + 51);
+      IMC::load(y, bfr__ + 55);
+      IMC::load(z, bfr__ + 59);
+      IMC::load(vx, bfr__ + 63);
+      IMC::load(vy, bfr__ + 67);
+      IMC::load(vz, bfr__ + 71);
+      IMC::load(course_error, bfr__ + 75);
+      IMC::load(eta, bfr__ + 79);
+      return 81;
     }
 
     uint16_t
     PathControlState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(path_ref, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_z, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_z, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lradius, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vx, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vy, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vz, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(course_error, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(eta, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 81) throw BufferTooShort();
+      IMC::reverseLoad(path_ref, bfr__ + 0);
+      IMC::reverseLoad(start_lat, bfr__ + 4);
+      IMC::reverseLoad(start_lon, bfr__ + 12);
+      IMC::reverseLoad(start_z, bfr__ + 20);
+      IMC::load(start_z_units, bfr__ + 24);
+      IMC::reverseLoad(end_lat, bfr__ + 25);
+      IMC::reverseLoad(end_lon, bfr__ + 33);
+      IMC::reverseLoad(end_z, bfr__ + 41);
+      IMC::load(end_z_units, bfr__ + 45);
+      IMC::reverseLoad(lradius, bfr__ + 46);
+      IMC::load(flags, bfr__ + 50);
+      IMC::reverseLoad(x, bfr__ + 51);
+      IMC::reverseLoad(y, bfr__ + 55);
+      IMC::reverseLoad(z, bfr__ + 59);
+      IMC::reverseLoad(vx, bfr__ + 63);
+      IMC::reverseLoad(vy, bfr__ + 67);
+      IMC::reverseLoad(vz, bfr__ + 71);
+      IMC::reverseLoad(course_error, bfr__ + 75);
+      IMC::reverseLoad(eta, bfr__ + 79);
+      return 81;
     }
 
     void
@@ -11882,31 +11792,30 @@ namespace DUNE
     uint8_t*
     AllocatedControlTorques::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(k, ptr__);
-      ptr__ += IMC::serialize(m, ptr__);
-      ptr__ += IMC::serialize(n, ptr__);
-      return ptr__;
+      IMC::store(k, bfr__ + 0);
+      IMC::store(m, bfr__ + 8);
+      IMC::store(n, bfr__ + 16);
+      return bfr__ + 24;
     }
 
     uint16_t
     AllocatedControlTorques::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(k, bfr__, size__);
-      bfr__ += IMC::deserialize(m, bfr__, size__);
-      bfr__ += IMC::deserialize(n, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24) throw BufferTooShort();
+      IMC::load(k, bfr__ + 0);
+      IMC::load(m, bfr__ + 8);
+      IMC::load(n, bfr__ + 16);
+      return 24;
     }
 
     uint16_t
     AllocatedControlTorques::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(k, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(m, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(n, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24) throw BufferTooShort();
+      IMC::reverseLoad(k, bfr__ + 0);
+      IMC::reverseLoad(m, bfr__ + 8);
+      IMC::reverseLoad(n, bfr__ + 16);
+      return 24;
     }
 
     void
@@ -11952,34 +11861,33 @@ namespace DUNE
     uint8_t*
     ControlParcel::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(i, ptr__);
-      ptr__ += IMC::serialize(d, ptr__);
-      ptr__ += IMC::serialize(a, ptr__);
-      return ptr__;
+      IMC::store(p, bfr__ + 0);
+      IMC::store(i, bfr__ + 4);
+      IMC::store(d, bfr__ + 8);
+      IMC::store(a, bfr__ + 12);
+      return bfr__ + 16;
     }
 
     uint16_t
     ControlParcel::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(i, bfr__, size__);
-      bfr__ += IMC::deserialize(d, bfr__, size__);
-      bfr__ += IMC::deserialize(a, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 16) throw BufferTooShort();
+      IMC::load(p, bfr__ + 0);
+      IMC::load(i, bfr__ + 4);
+      IMC::load(d, bfr__ + 8);
+      IMC::load(a, bfr__ + 12);
+      return 16;
     }
 
     uint16_t
     ControlParcel::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(i, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(d, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(a, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 16) throw BufferTooShort();
+      IMC::reverseLoad(p, bfr__ + 0);
+      IMC::reverseLoad(i, bfr__ + 4);
+      IMC::reverseLoad(d, bfr__ + 8);
+      IMC::reverseLoad(a, bfr__ + 12);
+      return 16;
     }
 
     void
@@ -12020,25 +11928,24 @@ namespace DUNE
     uint8_t*
     Brake::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      return ptr__;
+      IMC::store(op, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     Brake::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     Brake::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1) throw BufferTooShort();
+      IMC::load(op, bfr__ + 0);
+      return 1;
     }
 
     void
@@ -12091,55 +11998,54 @@ namespace DUNE
       return true;
     }
 
-    uint8_t*
-    DesiredLinearState::serializeFields(uint8_t* bfr__) const
-    {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(vx, ptr__);
-      ptr__ += IMC::serialize(vy, ptr__);
-      ptr__ += IMC::serialize(vz, ptr__);
-      ptr__ += IMC::serialize(ax, ptr__);
-      ptr__ += IMC::serialize(ay, ptr__);
-      ptr__ += IMC::serialize(az, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      return ptr__;
-    }
-
-    uint16_t
-    DesiredLinearState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
-    {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(vx, bfr__, size__);
-      bfr__ += IMC::deserialize(vy, bfr__, size__);
-      bfr__ += IMC::deserialize(vz, bfr__, size__);
-      bfr__ += IMC::deserialize(ax, bfr__, size__);
-      bfr__ += IMC::deserialize(ay, bfr__, size__);
-      bfr__ += IMC::deserialize(az, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+    uint8_t*
+    DesiredLinearState::serializeFields(uint8_t* bfr__) const
+    {
+      IMC::store(x, bfr__ + 0);
+      IMC::store(y, bfr__ + 8);
+      IMC::store(z, bfr__ + 16);
+      IMC::store(vx, bfr__ + 24);
+      IMC::store(vy, bfr__ + 32);
+      IMC::store(vz, bfr__ + 40);
+      IMC::store(ax, bfr__ + 48);
+      IMC::store(ay, bfr__ + 56);
+      IMC::store(az, bfr__ + 64);
+      IMC::store(flags, bfr__ + 72);
+      return bfr__ + 74;
+    }
+
+    uint16_t
+    DesiredLinearState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
+    {
+      if (size__ < 74) throw BufferTooShort();
+      IMC::load(x, bfr__ + 0);
+      IMC::load(y, bfr__ + 8);
+      IMC::load(z, bfr__ + 16);
+      IMC::load(vx, bfr__ + 24);
+      IMC::load(vy, bfr__ + 32);
+      IMC::load(vz, bfr__ + 40);
+      IMC::load(ax, bfr__ + 48);
+      IMC::load(ay, bfr__ + 56);
+      IMC::load(az, bfr__ + 64);
+      IMC::load(flags, bfr__ + 72);
+      return 74;
     }
 
     uint16_t
     DesiredLinearState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vx, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vy, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vz, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ax, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ay, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(az, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 74) throw BufferTooShort();
+      IMC::reverseLoad(x, bfr__ + 0);
+      IMC::reverseLoad(y, bfr__ + 8);
+      IMC::reverseLoad(z, bfr__ + 16);
+      IMC::reverseLoad(vx, bfr__ + 24);
+      IMC::reverseLoad(vy, bfr__ + 32);
+      IMC::reverseLoad(vz, bfr__ + 40);
+      IMC::reverseLoad(ax, bfr__ + 48);
+      IMC::reverseLoad(ay, bfr__ + 56);
+      IMC::reverseLoad(az, bfr__ + 64);
+      IMC::reverseLoad(flags, bfr__ + 72);
+      return 74;
     }
 
     void
@@ -12186,25 +12092,24 @@ namespace DUNE
     uint8_t*
     DesiredThrottle::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     DesiredThrottle::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     DesiredThrottle::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -13025,31 +12930,30 @@ namespace DUNE
     uint8_t*
     PathPoint::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::store(x, bfr__ + 0);
+      IMC::store(y, bfr__ + 4);
+      IMC::store(z, bfr__ + 8);
+      return bfr__ + 12;
     }
 
     uint16_t
     PathPoint::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12) throw BufferTooShort();
+      IMC::load(x, bfr__ + 0);
+      IMC::load(y, bfr__ + 4);
+      IMC::load(z, bfr__ + 8);
+      return 12;
     }
 
     uint16_t
     PathPoint::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12) throw BufferTooShort();
+      IMC::reverseLoad(x, bfr__ + 0);
+      IMC::reverseLoad(y, bfr__ + 4);
+      IMC::reverseLoad(z, bfr__ + 8);
+      return 12;
     }
 
     void
@@ -13615,34 +13519,33 @@ namespace DUNE
     uint8_t*
     TrajectoryPoint::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(t, ptr__);
-      return ptr__;
+      IMC::store(x, bfr__ + 0);
+      IMC::store(y, bfr__ + 4);
+      IMC::store(z, bfr__ + 8);
+      IMC::store(t, bfr__ + 12);
+      return bfr__ + 16;
     }
 
     uint16_t
     TrajectoryPoint::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(t, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 16) throw BufferTooShort();
+      IMC::load(x, bfr__ + 0);
+      IMC::load(y, bfr__ + 4);
+      IMC::load(z, bfr__ + 8);
+      IMC::load(t, bfr__ + 12);
+      return 16;
     }
 
     uint16_t
     TrajectoryPoint::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(t, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 16) throw BufferTooShort();
+      IMC::reverseLoad(x, bfr__ + 0);
+      IMC::reverseLoad(y, bfr__ + 4);
+      IMC::reverseLoad(z, bfr__ + 8);
+      IMC::reverseLoad(t, bfr__ + 12);
+      return 16;
     }
 
     void
@@ -13894,34 +13797,33 @@ namespace DUNE
     uint8_t*
     VehicleFormationParticipant::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(vid, ptr__);
-      ptr__ += IMC::serialize(off_x, ptr__);
-      ptr__ += IMC::serialize(off_y, ptr__);
-      ptr__ += IMC::serialize(off_z, ptr__);
-      return ptr__;
+      IMC::store(vid, bfr__ + 0);
+      IMC::store(off_x, bfr__ + 2);
+      IMC::store(off_y, bfr__ + 6);
+      IMC::store(off_z, bfr__ + 10);
+      return bfr__ + 14;
     }
 
     uint16_t
     VehicleFormationParticipant::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(vid, bfr__, size__);
-      bfr__ += IMC::deserialize(off_x, bfr__, size__);
-      bfr__ += IMC::deserialize(off_y, bfr__, size__);
-      bfr__ += IMC::deserialize(off_z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 14) throw BufferTooShort();
+      IMC::load(vid, bfr__ + 0);
+      IMC::load(off_x, bfr__ + 2);
+      IMC::load(off_y, bfr__ + 6);
+      IMC::load(off_z, bfr__ + 10);
+      return 14;
     }
 
     uint16_t
     VehicleFormationParticipant::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(vid, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(off_x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(off_y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(off_z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 14) throw BufferTooShort();
+      IMC::reverseLoad(vid, bfr__ + 0);
+      IMC::reverseLoad(off_x, bfr__ + 2);
+      IMC::reverseLoad(off_y, bfr__ + 6);
+      IMC::reverseLoad(off_z, bfr__ + 10);
+      return 14;
     }
 
     void
@@ -14155,25 +14057,24 @@ namespace DUNE
     uint8_t*
     RegisterManeuver::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(mid, ptr__);
-      return ptr__;
+      IMC::store(mid, bfr__ + 0);
+      return bfr__ + 2;
     }
 
     uint16_t
     RegisterManeuver::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(mid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 2) throw BufferTooShort();
+      IMC::load(mid, bfr__ + 0);
+      return 2;
     }
 
     uint16_t
     RegisterManeuver::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(mid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 2) throw BufferTooShort();
+      IMC::reverseLoad(mid, bfr__ + 0);
+      return 2;
     }
 
     void
@@ -14293,46 +14194,45 @@ namespace DUNE
     uint8_t*
     FollowSystem::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(system, ptr__);
-      ptr__ += IMC::serialize(duration, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(speed_units, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(z_units, ptr__);
-      return ptr__;
+      IMC::store(system, bfr__ + 0);
+      IMC::store(duration, bfr__ + 2);
+      IMC::store(speed, bfr__ + 4);
+      IMC::store(speed_units, bfr__ + 8);
+      IMC::store(x, bfr__ + 9);
+      IMC::store(y, bfr__ + 13);
+      IMC::store(z, bfr__ + 17);
+      IMC::store(z_units, bfr__ + 21);
+      return bfr__ + 22;
     }
 
     uint16_t
     FollowSystem::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(system, bfr__, size__);
-      bfr__ += IMC::deserialize(duration, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 22) throw BufferTooShort();
+      IMC::load(system, bfr__ + 0);
+      IMC::load(duration, bfr__ + 2);
+      IMC::load(speed, bfr__ + 4);
+      IMC::load(speed_units, bfr__ + 8);
+      IMC::load(x, bfr__ + 9);
+      IMC::load(y, bfr__ + 13);
+      IMC::load(z, bfr__ + 17);
+      IMC::load(z_units, bfr__ + 21);
+      return 22;
     }
 
     uint16_t
     FollowSystem::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(system, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duration, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 22) throw BufferTooShort();
+      IMC::reverseLoad(system, bfr__ + 0);
+      IMC::reverseLoad(duration, bfr__ + 2);
+      IMC::reverseLoad(speed, bfr__ + 4);
+      IMC::load(speed_units, bfr__ + 8);
+      IMC::reverseLoad(x, bfr__ + 9);
+      IMC::reverseLoad(y, bfr__ + 13);
+      IMC::reverseLoad(z, bfr__ + 17);
+      IMC::load(z_units, bfr__ + 21);
+      return 22;
     }
 
     void
@@ -14393,46 +14293,45 @@ namespace DUNE
     uint8_t*
     CommsRelay::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(speed_units, ptr__);
-      ptr__ += IMC::serialize(duration, ptr__);
-      ptr__ += IMC::serialize(sys_a, ptr__);
-      ptr__ += IMC::serialize(sys_b, ptr__);
-      ptr__ += IMC::serialize(move_threshold, ptr__);
-      return ptr__;
+      IMC::store(lat, bfr__ + 0);
+      IMC::store(lon, bfr__ + 8);
+      IMC::store(speed, bfr__ + 16);
+      IMC::store(speed_units, bfr__ + 20);
+      IMC::store(duration, bfr__ + 21);
+      IMC::store(sys_a, bfr__ + 23);
+      IMC::store(sys_b, bfr__ + 25);
+      IMC::store(move_threshold, bfr__ + 27);
+      return bfr__ + 31;
     }
 
     uint16_t
     CommsRelay::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::deserialize(duration, bfr__, size__);
-      bfr__ += IMC::deserialize(sys_a, bfr__, size__);
-      bfr__ += IMC::deserialize(sys_b, bfr__, size__);
-      bfr__ += IMC::deserialize(move_threshold, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 31) throw BufferTooShort();
+      IMC::load(lat, bfr__ + 0);
+      IMC::load(lon, bfr__ + 8);
+      IMC::load(speed, bfr__ + 16);
+      IMC::load(speed_units, bfr__ + 20);
+      IMC::load(duration, bfr__ + 21);
+      IMC::load(sys_a, bfr__ + 23);
+      IMC::load(sys_b, bfr__ + 25);
+      IMC::load(move_threshold, bfr__ + 27);
+      return 31;
     }
 
     uint16_t
     CommsRelay::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duration, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sys_a, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sys_b, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(move_threshold, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 31) throw BufferTooShort();
+      IMC::reverseLoad(lat, bfr__ + 0);
+      IMC::reverseLoad(lon, bfr__ + 8);
+      IMC::reverseLoad(speed, bfr__ + 16);
+      IMC::load(speed_units, bfr__ + 20);
+      IMC::reverseLoad(duration, bfr__ + 21);
+      IMC::reverseLoad(sys_a, bfr__ + 23);
+      IMC::reverseLoad(sys_b, bfr__ + 25);
+      IMC::reverseLoad(move_threshold, bfr__ + 27);
+      return 31;
     }
 
     void
@@ -14481,28 +14380,27 @@ namespace DUNE
     uint8_t*
     PolygonVertex::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      return ptr__;
+      IMC::store(lat, bfr__ + 0);
+      IMC::store(lon, bfr__ + 8);
+      return bfr__ + 16;
     }
 
     uint16_t
     PolygonVertex::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 16) throw BufferTooShort();
+      IMC::load(lat, bfr__ + 0);
+      IMC::load(lon, bfr__ + 8);
+      return 16;
     }
 
     uint16_t
     PolygonVertex::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 16) throw BufferTooShort();
+      IMC::reverseLoad(lat, bfr__ + 0);
+      IMC::reverseLoad(lon, bfr__ + 8);
+      return 16;
     }
 
     void
@@ -15052,37 +14950,36 @@ namespace DUNE
     uint8_t*
     FollowReference::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(control_src, ptr__);
-      ptr__ += IMC::serialize(control_ent, ptr__);
-      ptr__ += IMC::serialize(timeout, ptr__);
-      ptr__ += IMC::serialize(loiter_radius, ptr__);
-      ptr__ += IMC::serialize(altitude_interval, ptr__);
-      return ptr__;
+      IMC::store(control_src, bfr__ + 0);
+      IMC::store(control_ent, bfr__ + 2);
+      IMC::store(timeout, bfr__ + 3);
+      IMC::store(loiter_radius, bfr__ + 7);
+      IMC::store(altitude_interval, bfr__ + 11);
+      return bfr__ + 15;
     }
 
     uint16_t
     FollowReference::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(control_src, bfr__, size__);
-      bfr__ += IMC::deserialize(control_ent, bfr__, size__);
-      bfr__ += IMC::deserialize(timeout, bfr__, size__);
-      bfr__ += IMC::deserialize(loiter_radius, bfr__, size__);
-      bfr__ += IMC::deserialize(altitude_interval, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 15) throw BufferTooShort();
+      IMC::load(control_src, bfr__ + 0);
+      IMC::load(control_ent, bfr__ + 2);
+      IMC::load(timeout, bfr__ + 3);
+      IMC::load(loiter_radius, bfr__ + 7);
+      IMC::load(altitude_interval, bfr__ + 11);
+      return 15;
     }
 
     uint16_t
     FollowReference::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(control_src, bfr__, size__);
-      bfr__ += IMC::deserialize(control_ent, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(timeout, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(loiter_radius, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(altitude_interval, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 15) throw BufferTooShort();
+      IMC::reverseLoad(control_src, bfr__ + 0);
+      IMC::load(control_ent, bfr__ + 2);
+      IMC::reverseLoad(timeout, bfr__ + 3);
+      IMC::reverseLoad(loiter_radius, bfr__ + 7);
+      IMC::reverseLoad(altitude_interval, bfr__ + 11);
+      return 15;
     }
 
     void
@@ -16282,46 +16179,45 @@ namespace DUNE
     uint8_t*
     ScheduledGoto::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(arrival_time, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(z_units, ptr__);
-      ptr__ += IMC::serialize(travel_z, ptr__);
-      ptr__ += IMC::serialize(travel_z_units, ptr__);
-      ptr__ += IMC::serialize(delayed, ptr__);
-      return ptr__;
+      IMC::store(arrival_time, bfr__ + 0);
+      IMC::store(lat, bfr__ + 8);
+      IMC::store(lon, bfr__ + 16);
+      IMC::store(z, bfr__ + 24);
+      IMC::store(z_units, bfr__ + 28);
+      IMC::store(travel_z, bfr__ + 29);
+      IMC::store(travel_z_units, bfr__ + 33);
+      IMC::store(delayed, bfr__ + 34);
+      return bfr__ + 35;
     }
 
     uint16_t
     ScheduledGoto::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(arrival_time, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(travel_z, bfr__, size__);
-      bfr__ += IMC::deserialize(travel_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(delayed, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 35) throw BufferTooShort();
+      IMC::load(arrival_time, bfr__ + 0);
+      IMC::load(lat, bfr__ + 8);
+      IMC::load(lon, bfr__ + 16);
+      IMC::load(z, bfr__ + 24);
+      IMC::load(z_units, bfr__ + 28);
+      IMC::load(travel_z, bfr__ + 29);
+      IMC::load(travel_z_units, bfr__ + 33);
+      IMC::load(delayed, bfr__ + 34);
+      return 35;
     }
 
     uint16_t
     ScheduledGoto::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(arrival_time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(travel_z, bfr__, size__);
-      bfr__ += IMC::deserialize(travel_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(delayed, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 35) throw BufferTooShort();
+      IMC::reverseLoad(arrival_time, bfr__ + 0);
+      IMC::reverseLoad(lat, bfr__ + 8);
+      IMC::reverseLoad(lon, bfr__ + 16);
+      IMC::reverseLoad(z, bfr__ + 24);
+      IMC::load(z_units, bfr__ + 28);
+      IMC::reverseLoad(travel_z, bfr__ + 29);
+      IMC::load(travel_z_units, bfr__ + 33);
+      IMC::load(delayed, bfr__ + 34);
+      return 35;
     }
 
     void
@@ -17580,58 +17476,57 @@ namespace DUNE
     uint8_t*
     OperationalLimits::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(mask, ptr__);
-      ptr__ += IMC::serialize(max_depth, ptr__);
-      ptr__ += IMC::serialize(min_altitude, ptr__);
-      ptr__ += IMC::serialize(max_altitude, ptr__);
-      ptr__ += IMC::serialize(min_speed, ptr__);
-      ptr__ += IMC::serialize(max_speed, ptr__);
-      ptr__ += IMC::serialize(max_vrate, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(orientation, ptr__);
-      ptr__ += IMC::serialize(width, ptr__);
-      ptr__ += IMC::serialize(length, ptr__);
-      return ptr__;
+      IMC::store(mask, bfr__ + 0);
+      IMC::store(max_depth, bfr__ + 1);
+      IMC::store(min_altitude, bfr__ + 5);
+      IMC::store(max_altitude, bfr__ + 9);
+      IMC::store(min_speed, bfr__ + 13);
+      IMC::store(max_speed, bfr__ + 17);
+      IMC::store(max_vrate, bfr__ + 21);
+      IMC::store(lat, bfr__ + 25);
+      IMC::store(lon, bfr__ + 33);
+      IMC::store(orientation, bfr__ + 41);
+      IMC::store(width, bfr__ + 45);
+      IMC::store(length, bfr__ + 49);
+      return bfr__ + 53;
     }
 
     uint16_t
     OperationalLimits::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(mask, bfr__, size__);
-      bfr__ += IMC::deserialize(max_depth, bfr__, size__);
-      bfr__ += IMC::deserialize(min_altitude, bfr__, size__);
-      bfr__ += IMC::deserialize(max_altitude, bfr__, size__);
-      bfr__ += IMC::deserialize(min_speed, bfr__, size__);
-      bfr__ += IMC::deserialize(max_speed, bfr__, size__);
-      bfr__ += IMC::deserialize(max_vrate, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(orientation, bfr__, size__);
-      bfr__ += IMC::deserialize(width, bfr__, size__);
-      bfr__ += IMC::deserialize(length, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 53) throw BufferTooShort();
+      IMC::load(mask, bfr__ + 0);
+      IMC::load(max_depth, bfr__ + 1);
+      IMC::load(min_altitude, bfr__ + 5);
+      IMC::load(max_altitude, bfr__ + 9);
+      IMC::load(min_speed, bfr__ + 13);
+      IMC::load(max_speed, bfr__ + 17);
+      IMC::load(max_vrate, bfr__ + 21);
+      IMC::load(lat, bfr__ + 25);
+      IMC::load(lon, bfr__ + 33);
+      IMC::load(orientation, bfr__ + 41);
+      IMC::load(width, bfr__ + 45);
+      IMC::load(length, bfr__ + 49);
+      return 53;
     }
 
     uint16_t
     OperationalLimits::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(mask, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(max_depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(min_altitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(max_altitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(min_speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(max_speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(max_vrate, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(orientation, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(width, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(length, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 53) throw BufferTooShort();
+      IMC::load(mask, bfr__ + 0);
+      IMC::reverseLoad(max_depth, bfr__ + 1);
+      IMC::reverseLoad(min_altitude, bfr__ + 5);
+      IMC::reverseLoad(max_altitude, bfr__ + 9);
+      IMC::reverseLoad(min_speed, bfr__ + 13);
+      IMC::reverseLoad(max_speed, bfr__ + 17);
+      IMC::reverseLoad(max_vrate, bfr__ + 21);
+      IMC::reverseLoad(lat, bfr__ + 25);
+      IMC::reverseLoad(lon, bfr__ + 33);
+      IMC::reverseLoad(orientation, bfr__ + 41);
+      IMC::reverseLoad(width, bfr__ + 45);
+      IMC::reverseLoad(length, bfr__ + 49);
+      return 53;
     }
 
     void
@@ -17719,25 +17614,24 @@ namespace DUNE
     uint8_t*
     Calibration::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(duration, ptr__);
-      return ptr__;
+      IMC::store(duration, bfr__ + 0);
+      return bfr__ + 2;
     }
 
     uint16_t
     Calibration::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(duration, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 2) throw BufferTooShort();
+      IMC::load(duration, bfr__ + 0);
+      return 2;
     }
 
     uint16_t
     Calibration::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(duration, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 2) throw BufferTooShort();
+      IMC::reverseLoad(duration, bfr__ + 0);
+      return 2;
     }
 
     void
@@ -17779,31 +17673,30 @@ namespace DUNE
     uint8_t*
     ControlLoops::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(enable, ptr__);
-      ptr__ += IMC::serialize(mask, ptr__);
-      ptr__ += IMC::serialize(scope_ref, ptr__);
-      return ptr__;
+      IMC::store(enable, bfr__ + 0);
+      IMC::store(mask, bfr__ + 1);
+      IMC::store(scope_ref, bfr__ + 5);
+      return bfr__ + 9;
     }
 
     uint16_t
     ControlLoops::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(enable, bfr__, size__);
-      bfr__ += IMC::deserialize(mask, bfr__, size__);
-      bfr__ += IMC::deserialize(scope_ref, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9) throw BufferTooShort();
+      IMC::load(enable, bfr__ + 0);
+      IMC::load(mask, bfr__ + 1);
+      IMC::load(scope_ref, bfr__ + 5);
+      return 9;
     }
 
     uint16_t
     ControlLoops::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(enable, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(mask, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(scope_ref, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9) throw BufferTooShort();
+      IMC::load(enable, bfr__ + 0);
+      IMC::reverseLoad(mask, bfr__ + 1);
+      IMC::reverseLoad(scope_ref, bfr__ + 5);
+      return 9;
     }
 
     void
@@ -17843,25 +17736,24 @@ namespace DUNE
     uint8_t*
     VehicleMedium::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(medium, ptr__);
-      return ptr__;
+      IMC::store(medium, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     VehicleMedium::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(medium, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1) throw BufferTooShort();
+      IMC::load(medium, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     VehicleMedium::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(medium, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1) throw BufferTooShort();
+      IMC::load(medium, bfr__ + 0);
+      return 1;
     }
 
     void
@@ -17901,28 +17793,27 @@ namespace DUNE
     uint8_t*
     Collision::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(type, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      IMC::store(type, bfr__ + 4);
+      return bfr__ + 5;
     }
 
     uint16_t
     Collision::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      IMC::load(type, bfr__ + 4);
+      return 5;
     }
 
     uint16_t
     Collision::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      IMC::load(type, bfr__ + 4);
+      return 5;
     }
 
     fp64_t
@@ -17983,40 +17874,39 @@ namespace DUNE
     uint8_t*
     FormState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(possimerr, ptr__);
-      ptr__ += IMC::serialize(converg, ptr__);
-      ptr__ += IMC::serialize(turbulence, ptr__);
-      ptr__ += IMC::serialize(possimmon, ptr__);
-      ptr__ += IMC::serialize(commmon, ptr__);
-      ptr__ += IMC::serialize(convergmon, ptr__);
-      return ptr__;
+      IMC::store(possimerr, bfr__ + 0);
+      IMC::store(converg, bfr__ + 4);
+      IMC::store(turbulence, bfr__ + 8);
+      IMC::store(possimmon, bfr__ + 12);
+      IMC::store(commmon, bfr__ + 13);
+      IMC::store(convergmon, bfr__ + 14);
+      return bfr__ + 15;
     }
 
     uint16_t
     FormState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(possimerr, bfr__, size__);
-      bfr__ += IMC::deserialize(converg, bfr__, size__);
-      bfr__ += IMC::deserialize(turbulence, bfr__, size__);
-      bfr__ += IMC::deserialize(possimmon, bfr__, size__);
-      bfr__ += IMC::deserialize(commmon, bfr__, size__);
-      bfr__ += IMC::deserialize(convergmon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 15) throw BufferTooShort();
+      IMC::load(possimerr, bfr__ + 0);
+      IMC::load(converg, bfr__ + 4);
+      IMC::load(turbulence, bfr__ + 8);
+      IMC::load(possimmon, bfr__ + 12);
+      IMC::load(commmon, bfr__ + 13);
+      IMC::load(convergmon, bfr__ + 14);
+      return 15;
     }
 
     uint16_t
     FormState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(possimerr, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(converg, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(turbulence, bfr__, size__);
-      bfr__ += IMC::deserialize(possimmon, bfr__, size__);
-      bfr__ += IMC::deserialize(commmon, bfr__, size__);
-      bfr__ += IMC::deserialize(convergmon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 15) throw BufferTooShort();
+      IMC::reverseLoad(possimerr, bfr__ + 0);
+      IMC::reverseLoad(converg, bfr__ + 4);
+      IMC::reverseLoad(turbulence, bfr__ + 8);
+      IMC::load(possimmon, bfr__ + 12);
+      IMC::load(commmon, bfr__ + 13);
+      IMC::load(convergmon, bfr__ + 14);
+      return 15;
     }
 
     void
@@ -18135,46 +18025,45 @@ namespace DUNE
     uint8_t*
     FormationState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(type, ptr__);
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(possimerr, ptr__);
-      ptr__ += IMC::serialize(converg, ptr__);
-      ptr__ += IMC::serialize(turbulence, ptr__);
-      ptr__ += IMC::serialize(possimmon, ptr__);
-      ptr__ += IMC::serialize(commmon, ptr__);
-      ptr__ += IMC::serialize(convergmon, ptr__);
-      return ptr__;
+      IMC::store(type, bfr__ + 0);
+      IMC::store(op, bfr__ + 1);
+      IMC::store(possimerr, bfr__ + 2);
+      IMC::store(converg, bfr__ + 6);
+      IMC::store(turbulence, bfr__ + 10);
+      IMC::store(possimmon, bfr__ + 14);
+      IMC::store(commmon, bfr__ + 15);
+      IMC::store(convergmon, bfr__ + 16);
+      return bfr__ + 17;
     }
 
     uint16_t
     FormationState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(possimerr, bfr__, size__);
-      bfr__ += IMC::deserialize(converg, bfr__, size__);
-      bfr__ += IMC::deserialize(turbulence, bfr__, size__);
-      bfr__ += IMC::deserialize(possimmon, bfr__, size__);
-      bfr__ += IMC::deserialize(commmon, bfr__, size__);
-      bfr__ += IMC::deserialize(convergmon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 17) throw BufferTooShort();
+      IMC::load(type, bfr__ + 0);
+      IMC::load(op, bfr__ + 1);
+      IMC::load(possimerr, bfr__ + 2);
+      IMC::load(converg, bfr__ + 6);
+      IMC::load(turbulence, bfr__ + 10);
+      IMC::load(possimmon, bfr__ + 14);
+      IMC::load(commmon, bfr__ + 15);
+      IMC::load(convergmon, bfr__ + 16);
+      return 17;
     }
 
     uint16_t
     FormationState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(possimerr, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(converg, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(turbulence, bfr__, size__);
-      bfr__ += IMC::deserialize(possimmon, bfr__, size__);
-      bfr__ += IMC::deserialize(commmon, bfr__, size__);
-      bfr__ += IMC::deserialize(convergmon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 17) throw BufferTooShort();
+      IMC::load(type, bfr__ + 0);
+      IMC::load(op, bfr__ + 1);
+      IMC::reverseLoad(possimerr, bfr__ + 2);
+      IMC::reverseLoad(converg, bfr__ + 6);
+      IMC::reverseLoad(turbulence, bfr__ + 10);
+      IMC::load(possimmon, bfr__ + 14);
+      IMC::load(commmon, bfr__ + 15);
+      IMC::load(convergmon, bfr__ + 16);
+      return 17;
     }
 
     void
@@ -18311,52 +18200,51 @@ namespace DUNE
     uint8_t*
     StateReport::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(stime, ptr__);
-      ptr__ += IMC::serialize(latitude, ptr__);
-      ptr__ += IMC::serialize(longitude, ptr__);
-      ptr__ += IMC::serialize(altitude, ptr__);
-      ptr__ += IMC::serialize(depth, ptr__);
-      ptr__ += IMC::serialize(heading, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(fuel, ptr__);
-      ptr__ += IMC::serialize(exec_state, ptr__);
-      ptr__ += IMC::serialize(plan_checksum, ptr__);
-      return ptr__;
+      IMC::store(stime, bfr__ + 0);
+      IMC::store(latitude, bfr__ + 4);
+      IMC::store(longitude, bfr__ + 8);
+      IMC::store(altitude, bfr__ + 12);
+      IMC::store(depth, bfr__ + 14);
+      IMC::store(heading, bfr__ + 16);
+      IMC::store(speed, bfr__ + 18);
+      IMC::store(fuel, bfr__ + 20);
+      IMC::store(exec_state, bfr__ + 21);
+      IMC::store(plan_checksum, bfr__ + 22);
+      return bfr__ + 24;
     }
 
     uint16_t
     StateReport::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(stime, bfr__, size__);
-      bfr__ += IMC::deserialize(latitude, bfr__, size__);
-      bfr__ += IMC::deserialize(longitude, bfr__, size__);
-      bfr__ += IMC::deserialize(altitude, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::deserialize(heading, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(fuel, bfr__, size__);
-      bfr__ += IMC::deserialize(exec_state, bfr__, size__);
-      bfr__ += IMC::deserialize(plan_checksum, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24) throw BufferTooShort();
+      IMC::load(stime, bfr__ + 0);
+      IMC::load(latitude, bfr__ + 4);
+      IMC::load(longitude, bfr__ + 8);
+      IMC::load(altitude, bfr__ + 12);
+      IMC::load(depth, bfr__ + 14);
+      IMC::load(heading, bfr__ + 16);
+      IMC::load(speed, bfr__ + 18);
+      IMC::load(fuel, bfr__ + 20);
+      IMC::load(exec_state, bfr__ + 21);
+      IMC::load(plan_checksum, bfr__ + 22);
+      return 24;
     }
 
     uint16_t
     StateReport::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(stime, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(latitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(longitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(altitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(heading, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(fuel, bfr__, size__);
-      bfr__ += IMC::deserialize(exec_state, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(plan_checksum, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24) throw BufferTooShort();
+      IMC::reverseLoad(stime, bfr__ + 0);
+      IMC::reverseLoad(latitude, bfr__ + 4);
+      IMC::reverseLoad(longitude, bfr__ + 8);
+      IMC::reverseLoad(altitude, bfr__ + 12);
+      IMC::reverseLoad(depth, bfr__ + 14);
+      IMC::reverseLoad(heading, bfr__ + 16);
+      IMC::reverseLoad(speed, bfr__ + 18);
+      IMC::load(fuel, bfr__ + 20);
+      IMC::load(exec_state, bfr__ + 21);
+      IMC::reverseLoad(plan_checksum, bfr__ + 22);
+      return 24;
     }
 
     void
@@ -20452,31 +20340,30 @@ namespace DUNE
     uint8_t*
     MapPoint::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(alt, ptr__);
-      return ptr__;
+      IMC::store(lat, bfr__ + 0);
+      IMC::store(lon, bfr__ + 8);
+      IMC::store(alt, bfr__ + 16);
+      return bfr__ + 20;
     }
 
     uint16_t
     MapPoint::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 20) throw BufferTooShort();
+      IMC::load(lat, bfr__ + 0);
+      IMC::load(lon, bfr__ + 8);
+      IMC::load(alt, bfr__ + 16);
+      return 20;
     }
 
     uint16_t
     MapPoint::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 20) throw BufferTooShort();
+      IMC::reverseLoad(lat, bfr__ + 0);
+      IMC::reverseLoad(lon, bfr__ + 8);
+      IMC::reverseLoad(alt, bfr__ + 16);
+      return 20;
     }
 
     void
@@ -21579,34 +21466,33 @@ namespace DUNE
     uint8_t*
     ImageTxSettings::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(fps, ptr__);
-      ptr__ += IMC::serialize(quality, ptr__);
-      ptr__ += IMC::serialize(reps, ptr__);
-      ptr__ += IMC::serialize(tsize, ptr__);
-      return ptr__;
+      IMC::store(fps, bfr__ + 0);
+      IMC::store(quality, bfr__ + 1);
+      IMC::store(reps, bfr__ + 2);
+      IMC::store(tsize, bfr__ + 3);
+      return bfr__ + 4;
     }
 
     uint16_t
     ImageTxSettings::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(fps, bfr__, size__);
-      bfr__ += IMC::deserialize(quality, bfr__, size__);
-      bfr__ += IMC::deserialize(reps, bfr__, size__);
-      bfr__ += IMC::deserialize(tsize, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(fps, bfr__ + 0);
+      IMC::load(quality, bfr__ + 1);
+      IMC::load(reps, bfr__ + 2);
+      IMC::load(tsize, bfr__ + 3);
+      return 4;
     }
 
     uint16_t
     ImageTxSettings::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(fps, bfr__, size__);
-      bfr__ += IMC::deserialize(quality, bfr__, size__);
-      bfr__ += IMC::deserialize(reps, bfr__, size__);
-      bfr__ += IMC::deserialize(tsize, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(fps, bfr__ + 0);
+      IMC::load(quality, bfr__ + 1);
+      IMC::load(reps, bfr__ + 2);
+      IMC::load(tsize, bfr__ + 3);
+      return 4;
     }
 
     void
@@ -21657,37 +21543,36 @@ namespace DUNE
     uint8_t*
     RemoteState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(depth, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      return ptr__;
+      IMC::store(lat, bfr__ + 0);
+      IMC::store(lon, bfr__ + 4);
+      IMC::store(depth, bfr__ + 8);
+      IMC::store(speed, bfr__ + 9);
+      IMC::store(psi, bfr__ + 13);
+      return bfr__ + 17;
     }
 
     uint16_t
     RemoteState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 17) throw BufferTooShort();
+      IMC::load(lat, bfr__ + 0);
+      IMC::load(lon, bfr__ + 4);
+      IMC::load(depth, bfr__ + 8);
+      IMC::load(speed, bfr__ + 9);
+      IMC::load(psi, bfr__ + 13);
+      return 17;
     }
 
     uint16_t
     RemoteState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 17) throw BufferTooShort();
+      IMC::reverseLoad(lat, bfr__ + 0);
+      IMC::reverseLoad(lon, bfr__ + 4);
+      IMC::load(depth, bfr__ + 8);
+      IMC::reverseLoad(speed, bfr__ + 9);
+      IMC::reverseLoad(psi, bfr__ + 13);
+      return 17;
     }
 
     void
@@ -22195,25 +22080,24 @@ namespace DUNE
     uint8_t*
     CreateSession::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(timeout, ptr__);
-      return ptr__;
+      IMC::store(timeout, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     CreateSession::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(timeout, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(timeout, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     CreateSession::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(timeout, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(timeout, bfr__ + 0);
+      return 4;
     }
 
     void
@@ -22251,25 +22135,24 @@ namespace DUNE
     uint8_t*
     CloseSession::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(sessid, ptr__);
-      return ptr__;
+      IMC::store(sessid, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     CloseSession::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sessid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(sessid, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     CloseSession::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(sessid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(sessid, bfr__ + 0);
+      return 4;
     }
 
     void
@@ -22369,25 +22252,24 @@ namespace DUNE
     uint8_t*
     SessionKeepAlive::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(sessid, ptr__);
-      return ptr__;
+      IMC::store(sessid, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     SessionKeepAlive::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sessid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(sessid, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     SessionKeepAlive::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(sessid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(sessid, bfr__ + 0);
+      return 4;
     }
 
     void
@@ -22427,28 +22309,27 @@ namespace DUNE
     uint8_t*
     SessionStatus::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(sessid, ptr__);
-      ptr__ += IMC::serialize(status, ptr__);
-      return ptr__;
+      IMC::store(sessid, bfr__ + 0);
+      IMC::store(status, bfr__ + 4);
+      return bfr__ + 5;
     }
 
     uint16_t
     SessionStatus::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sessid, bfr__, size__);
-      bfr__ += IMC::deserialize(status, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(sessid, bfr__ + 0);
+      IMC::load(status, bfr__ + 4);
+      return 5;
     }
 
     uint16_t
     SessionStatus::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(sessid, bfr__, size__);
-      bfr__ += IMC::deserialize(status, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::reverseLoad(sessid, bfr__ + 0);
+      IMC::load(status, bfr__ + 4);
+      return 5;
     }
 
     void
@@ -22979,40 +22860,39 @@ namespace DUNE
     uint8_t*
     FormCtrlParam::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(action, ptr__);
-      ptr__ += IMC::serialize(longain, ptr__);
-      ptr__ += IMC::serialize(latgain, ptr__);
-      ptr__ += IMC::serialize(bondthick, ptr__);
-      ptr__ += IMC::serialize(leadgain, ptr__);
-      ptr__ += IMC::serialize(deconflgain, ptr__);
-      return ptr__;
+      IMC::store(action, bfr__ + 0);
+      IMC::store(longain, bfr__ + 1);
+      IMC::store(latgain, bfr__ + 5);
+      IMC::store(bondthick, bfr__ + 9);
+      IMC::store(leadgain, bfr__ + 13);
+      IMC::store(deconflgain, bfr__ + 17);
+      return bfr__ + 21;
     }
 
     uint16_t
     FormCtrlParam::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      bfr__ += IMC::deserialize(longain, bfr__, size__);
-      bfr__ += IMC::deserialize(latgain, bfr__, size__);
-      bfr__ += IMC::deserialize(bondthick, bfr__, size__);
-      bfr__ += IMC::deserialize(leadgain, bfr__, size__);
-      bfr__ += IMC::deserialize(deconflgain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 21) throw BufferTooShort();
+      IMC::load(action, bfr__ + 0);
+      IMC::load(longain, bfr__ + 1);
+      IMC::load(latgain, bfr__ + 5);
+      IMC::load(bondthick, bfr__ + 9);
+      IMC::load(leadgain, bfr__ + 13);
+      IMC::load(deconflgain, bfr__ + 17);
+      return 21;
     }
 
     uint16_t
     FormCtrlParam::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(longain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(latgain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bondthick, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(leadgain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(deconflgain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 21) throw BufferTooShort();
+      IMC::load(action, bfr__ + 0);
+      IMC::reverseLoad(longain, bfr__ + 1);
+      IMC::reverseLoad(latgain, bfr__ + 5);
+      IMC::reverseLoad(bondthick, bfr__ + 9);
+      IMC::reverseLoad(leadgain, bfr__ + 13);
+      IMC::reverseLoad(deconflgain, bfr__ + 17);
+      return 21;
     }
 
     void
@@ -23059,31 +22939,30 @@ namespace DUNE
     uint8_t*
     FormationEval::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(err_mean, ptr__);
-      ptr__ += IMC::serialize(dist_min_abs, ptr__);
-      ptr__ += IMC::serialize(dist_min_mean, ptr__);
-      return ptr__;
+      IMC::store(err_mean, bfr__ + 0);
+      IMC::store(dist_min_abs, bfr__ + 4);
+      IMC::store(dist_min_mean, bfr__ + 8);
+      return bfr__ + 12;
     }
 
     uint16_t
     FormationEval::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(err_mean, bfr__, size__);
-      bfr__ += IMC::deserialize(dist_min_abs, bfr__, size__);
-      bfr__ += IMC::deserialize(dist_min_mean, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12) throw BufferTooShort();
+      IMC::load(err_mean, bfr__ + 0);
+      IMC::load(dist_min_abs, bfr__ + 4);
+      IMC::load(dist_min_mean, bfr__ + 8);
+      return 12;
     }
 
     uint16_t
     FormationEval::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(err_mean, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(dist_min_abs, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(dist_min_mean, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12) throw BufferTooShort();
+      IMC::reverseLoad(err_mean, bfr__ + 0);
+      IMC::reverseLoad(dist_min_abs, bfr__ + 4);
+      IMC::reverseLoad(dist_min_mean, bfr__ + 8);
+      return 12;
     }
 
     void
@@ -23143,55 +23022,54 @@ namespace DUNE
     uint8_t*
     FormationControlParams::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(action, ptr__);
-      ptr__ += IMC::serialize(lon_gain, ptr__);
-      ptr__ += IMC::serialize(lat_gain, ptr__);
-      ptr__ += IMC::serialize(bond_thick, ptr__);
-      ptr__ += IMC::serialize(lead_gain, ptr__);
-      ptr__ += IMC::serialize(deconfl_gain, ptr__);
-      ptr__ += IMC::serialize(accel_switch_gain, ptr__);
-      ptr__ += IMC::serialize(safe_dist, ptr__);
-      ptr__ += IMC::serialize(deconflict_offset, ptr__);
-      ptr__ += IMC::serialize(accel_safe_margin, ptr__);
-      ptr__ += IMC::serialize(accel_lim_x, ptr__);
-      return ptr__;
+      IMC::store(action, bfr__ + 0);
+      IMC::store(lon_gain, bfr__ + 1);
+      IMC::store(lat_gain, bfr__ + 5);
+      IMC::store(bond_thick, bfr__ + 9);
+      IMC::store(lead_gain, bfr__ + 13);
+      IMC::store(deconfl_gain, bfr__ + 17);
+      IMC::store(accel_switch_gain, bfr__ + 21);
+      IMC::store(safe_dist, bfr__ + 25);
+      IMC::store(deconflict_offset, bfr__ + 29);
+      IMC::store(accel_safe_margin, bfr__ + 33);
+      IMC::store(accel_lim_x, bfr__ + 37);
+      return bfr__ + 41;
     }
 
     uint16_t
     FormationControlParams::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      bfr__ += IMC::deserialize(lon_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(lat_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(bond_thick, bfr__, size__);
-      bfr__ += IMC::deserialize(lead_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(deconfl_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(accel_switch_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(safe_dist, bfr__, size__);
-      bfr__ += IMC::deserialize(deconflict_offset, bfr__, size__);
-      bfr__ += IMC::deserialize(accel_safe_margin, bfr__, size__);
-      bfr__ += IMC::deserialize(accel_lim_x, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 41) throw BufferTooShort();
+      IMC::load(action, bfr__ + 0);
+      IMC::load(lon_gain, bfr__ + 1);
+      IMC::load(lat_gain, bfr__ + 5);
+      IMC::load(bond_thick, bfr__ + 9);
+      IMC::load(lead_gain, bfr__ + 13);
+      IMC::load(deconfl_gain, bfr__ + 17);
+      IMC::load(accel_switch_gain, bfr__ + 21);
+      IMC::load(safe_dist, bfr__ + 25);
+      IMC::load(deconflict_offset, bfr__ + 29);
+      IMC::load(accel_safe_margin, bfr__ + 33);
+      IMC::load(accel_lim_x, bfr__ + 37);
+      return 41;
     }
 
     uint16_t
     FormationControlParams::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bond_thick, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lead_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(deconfl_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(accel_switch_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(safe_dist, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(deconflict_offset, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(accel_safe_margin, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(accel_lim_x, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 41) throw BufferTooShort();
+      IMC::load(action, bfr__ + 0);
+      IMC::reverseLoad(lon_gain, bfr__ + 1);
+      IMC::reverseLoad(lat_gain, bfr__ + 5);
+      IMC::reverseLoad(bond_thick, bfr__ + 9);
+      IMC::reverseLoad(lead_gain, bfr__ + 13);
+      IMC::reverseLoad(deconfl_gain, bfr__ + 17);
+      IMC::reverseLoad(accel_switch_gain, bfr__ + 21);
+      IMC::reverseLoad(safe_dist, bfr__ + 25);
+      IMC::reverseLoad(deconflict_offset, bfr__ + 29);
+      IMC::reverseLoad(accel_safe_margin, bfr__ + 33);
+      IMC::reverseLoad(accel_lim_x, bfr__ + 37);
+      return 41;
     }
 
     void
@@ -23562,31 +23440,30 @@ namespace DUNE
     uint8_t*
     UsblAngles::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(target, ptr__);
-      ptr__ += IMC::serialize(bearing, ptr__);
-      ptr__ += IMC::serialize(elevation, ptr__);
-      return ptr__;
+      IMC::store(target, bfr__ + 0);
+      IMC::store(bearing, bfr__ + 2);
+      IMC::store(elevation, bfr__ + 6);
+      return bfr__ + 10;
     }
 
     uint16_t
     UsblAngles::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(target, bfr__, size__);
-      bfr__ += IMC::deserialize(bearing, bfr__, size__);
-      bfr__ += IMC::deserialize(elevation, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 10) throw BufferTooShort();
+      IMC::load(target, bfr__ + 0);
+      IMC::load(bearing, bfr__ + 2);
+      IMC::load(elevation, bfr__ + 6);
+      return 10;
     }
 
     uint16_t
     UsblAngles::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(target, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bearing, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(elevation, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 10) throw BufferTooShort();
+      IMC::reverseLoad(target, bfr__ + 0);
+      IMC::reverseLoad(bearing, bfr__ + 2);
+      IMC::reverseLoad(elevation, bfr__ + 6);
+      return 10;
     }
 
     void
@@ -23632,34 +23509,33 @@ namespace DUNE
     uint8_t*
     UsblPosition::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(target, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::store(target, bfr__ + 0);
+      IMC::store(x, bfr__ + 2);
+      IMC::store(y, bfr__ + 6);
+      IMC::store(z, bfr__ + 10);
+      return bfr__ + 14;
     }
 
     uint16_t
     UsblPosition::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(target, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 14) throw BufferTooShort();
+      IMC::load(target, bfr__ + 0);
+      IMC::load(x, bfr__ + 2);
+      IMC::load(y, bfr__ + 6);
+      IMC::load(z, bfr__ + 10);
+      return 14;
     }
 
     uint16_t
     UsblPosition::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(target, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 14) throw BufferTooShort();
+      IMC::reverseLoad(target, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 2);
+      IMC::reverseLoad(y, bfr__ + 6);
+      IMC::reverseLoad(z, bfr__ + 10);
+      return 14;
     }
 
     void
@@ -23710,37 +23586,36 @@ namespace DUNE
     uint8_t*
     UsblFix::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(target, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(z_units, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::store(target, bfr__ + 0);
+      IMC::store(lat, bfr__ + 2);
+      IMC::store(lon, bfr__ + 10);
+      IMC::store(z_units, bfr__ + 18);
+      IMC::store(z, bfr__ + 19);
+      return bfr__ + 23;
     }
 
     uint16_t
     UsblFix::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(target, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 23) throw BufferTooShort();
+      IMC::load(target, bfr__ + 0);
+      IMC::load(lat, bfr__ + 2);
+      IMC::load(lon, bfr__ + 10);
+      IMC::load(z_units, bfr__ + 18);
+      IMC::load(z, bfr__ + 19);
+      return 23;
     }
 
     uint16_t
     UsblFix::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(target, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 23) throw BufferTooShort();
+      IMC::reverseLoad(target, bfr__ + 0);
+      IMC::reverseLoad(lat, bfr__ + 2);
+      IMC::reverseLoad(lon, bfr__ + 10);
+      IMC::load(z_units, bfr__ + 18);
+      IMC::reverseLoad(z, bfr__ + 19);
+      return 23;
     }
 
     void
@@ -23887,31 +23762,30 @@ namespace DUNE
     uint8_t*
     SetImageCoords::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(camid, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      return ptr__;
+      IMC::store(camid, bfr__ + 0);
+      IMC::store(x, bfr__ + 1);
+      IMC::store(y, bfr__ + 3);
+      return bfr__ + 5;
     }
 
     uint16_t
     SetImageCoords::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(camid, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(camid, bfr__ + 0);
+      IMC::load(x, bfr__ + 1);
+      IMC::load(y, bfr__ + 3);
+      return 5;
     }
 
     uint16_t
     SetImageCoords::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(camid, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(camid, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 1);
+      IMC::reverseLoad(y, bfr__ + 3);
+      return 5;
     }
 
     void
@@ -23955,31 +23829,30 @@ namespace DUNE
     uint8_t*
     GetImageCoords::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(camid, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      return ptr__;
+      IMC::store(camid, bfr__ + 0);
+      IMC::store(x, bfr__ + 1);
+      IMC::store(y, bfr__ + 3);
+      return bfr__ + 5;
     }
 
     uint16_t
     GetImageCoords::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(camid, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(camid, bfr__ + 0);
+      IMC::load(x, bfr__ + 1);
+      IMC::load(y, bfr__ + 3);
+      return 5;
     }
 
     uint16_t
     GetImageCoords::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(camid, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(camid, bfr__ + 0);
+      IMC::reverseLoad(x, bfr__ + 1);
+      IMC::reverseLoad(y, bfr__ + 3);
+      return 5;
     }
 
     void
@@ -24029,40 +23902,39 @@ namespace DUNE
     uint8_t*
     GetWorldCoordinates::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(tracking, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::store(tracking, bfr__ + 0);
+      IMC::store(lat, bfr__ + 1);
+      IMC::store(lon, bfr__ + 9);
+      IMC::store(x, bfr__ + 17);
+      IMC::store(y, bfr__ + 21);
+      IMC::store(z, bfr__ + 25);
+      return bfr__ + 29;
     }
 
     uint16_t
     GetWorldCoordinates::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(tracking, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 29) throw BufferTooShort();
+      IMC::load(tracking, bfr__ + 0);
+      IMC::load(lat, bfr__ + 1);
+      IMC::load(lon, bfr__ + 9);
+      IMC::load(x, bfr__ + 17);
+      IMC::load(y, bfr__ + 21);
+      IMC::load(z, bfr__ + 25);
+      return 29;
     }
 
     uint16_t
     GetWorldCoordinates::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(tracking, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 29) throw BufferTooShort();
+      IMC::load(tracking, bfr__ + 0);
+      IMC::reverseLoad(lat, bfr__ + 1);
+      IMC::reverseLoad(lon, bfr__ + 9);
+      IMC::reverseLoad(x, bfr__ + 17);
+      IMC::reverseLoad(y, bfr__ + 21);
+      IMC::reverseLoad(z, bfr__ + 25);
+      return 29;
     }
 
     void
@@ -24599,28 +24471,27 @@ namespace DUNE
     uint8_t*
     DissolvedOrganicMatter::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(type, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      IMC::store(type, bfr__ + 4);
+      return bfr__ + 5;
     }
 
     uint16_t
     DissolvedOrganicMatter::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      IMC::load(type, bfr__ + 4);
+      return 5;
     }
 
     uint16_t
     DissolvedOrganicMatter::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      IMC::load(type, bfr__ + 4);
+      return 5;
     }
 
     fp64_t
@@ -24671,25 +24542,24 @@ namespace DUNE
     uint8_t*
     OpticalBackscatter::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::store(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     OpticalBackscatter::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::load(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     OpticalBackscatter::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4) throw BufferTooShort();
+      IMC::reverseLoad(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -24769,70 +24639,69 @@ namespace DUNE
     uint8_t*
     Tachograph::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(timestamp_last_service, ptr__);
-      ptr__ += IMC::serialize(time_next_service, ptr__);
-      ptr__ += IMC::serialize(time_motor_next_service, ptr__);
-      ptr__ += IMC::serialize(time_idle_ground, ptr__);
-      ptr__ += IMC::serialize(time_idle_air, ptr__);
-      ptr__ += IMC::serialize(time_idle_water, ptr__);
-      ptr__ += IMC::serialize(time_idle_underwater, ptr__);
-      ptr__ += IMC::serialize(time_idle_unknown, ptr__);
-      ptr__ += IMC::serialize(time_motor_ground, ptr__);
-      ptr__ += IMC::serialize(time_motor_air, ptr__);
-      ptr__ += IMC::serialize(time_motor_water, ptr__);
-      ptr__ += IMC::serialize(time_motor_underwater, ptr__);
-      ptr__ += IMC::serialize(time_motor_unknown, ptr__);
-      ptr__ += IMC::serialize(rpm_min, ptr__);
-      ptr__ += IMC::serialize(rpm_max, ptr__);
-      ptr__ += IMC::serialize(depth_max, ptr__);
-      return ptr__;
+      IMC::store(timestamp_last_service, bfr__ + 0);
+      IMC::store(time_next_service, bfr__ + 8);
+      IMC::store(time_motor_next_service, bfr__ + 12);
+      IMC::store(time_idle_ground, bfr__ + 16);
+      IMC::store(time_idle_air, bfr__ + 20);
+      IMC::store(time_idle_water, bfr__ + 24);
+      IMC::store(time_idle_underwater, bfr__ + 28);
+      IMC::store(time_idle_unknown, bfr__ + 32);
+      IMC::store(time_motor_ground, bfr__ + 36);
+      IMC::store(time_motor_air, bfr__ + 40);
+      IMC::store(time_motor_water, bfr__ + 44);
+      IMC::store(time_motor_underwater, bfr__ + 48);
+      IMC::store(time_motor_unknown, bfr__ + 52);
+      IMC::store(rpm_min, bfr__ + 56);
+      IMC::store(rpm_max, bfr__ + 58);
+      IMC::store(depth_max, bfr__ + 60);
+      return bfr__ + 64;
     }
 
     uint16_t
     Tachograph::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(timestamp_last_service, bfr__, size__);
-      bfr__ += IMC::deserialize(time_next_service, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_next_service, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_ground, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_air, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_water, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_underwater, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_unknown, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_ground, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_air, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_water, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_underwater, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_unknown, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_min, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_max, bfr__, size__);
-      bfr__ += IMC::deserialize(depth_max, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 64) throw BufferTooShort();
+      IMC::load(timestamp_last_service, bfr__ + 0);
+      IMC::load(time_next_service, bfr__ + 8);
+      IMC::load(time_motor_next_service, bfr__ + 12);
+      IMC::load(time_idle_ground, bfr__ + 16);
+      IMC::load(time_idle_air, bfr__ + 20);
+      IMC::load(time_idle_water, bfr__ + 24);
+      IMC::load(time_idle_underwater, bfr__ + 28);
+      IMC::load(time_idle_unknown, bfr__ + 32);
+      IMC::load(time_motor_ground, bfr__ + 36);
+      IMC::load(time_motor_air, bfr__ + 40);
+      IMC::load(time_motor_water, bfr__ + 44);
+      IMC::load(time_motor_underwater, bfr__ + 48);
+      IMC::load(time_motor_unknown, bfr__ + 52);
+      IMC::load(rpm_min, bfr__ + 56);
+      IMC::load(rpm_max, bfr__ + 58);
+      IMC::load(depth_max, bfr__ + 60);
+      return 64;
     }
 
     uint16_t
     Tachograph::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(timestamp_last_service, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_next_service, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_next_service, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_ground, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_air, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_water, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_underwater, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_unknown, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_ground, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_air, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_water, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_underwater, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_unknown, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(depth_max, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 64) throw BufferTooShort();
+      IMC::reverseLoad(timestamp_last_service, bfr__ + 0);
+      IMC::reverseLoad(time_next_service, bfr__ + 8);
+      IMC::reverseLoad(time_motor_next_service, bfr__ + 12);
+      IMC::reverseLoad(time_idle_ground, bfr__ + 16);
+      IMC::reverseLoad(time_idle_air, bfr__ + 20);
+      IMC::reverseLoad(time_idle_water, bfr__ + 24);
+      IMC::reverseLoad(time_idle_underwater, bfr__ + 28);
+      IMC::reverseLoad(time_idle_unknown, bfr__ + 32);
+      IMC::reverseLoad(time_motor_ground, bfr__ + 36);
+      IMC::reverseLoad(time_motor_air, bfr__ + 40);
+      IMC::reverseLoad(time_motor_water, bfr__ + 44);
+      IMC::reverseLoad(time_motor_underwater, bfr__ + 48);
+      IMC::reverseLoad(time_motor_unknown, bfr__ + 52);
+      IMC::reverseLoad(rpm_min, bfr__ + 56);
+      IMC::reverseLoad(rpm_max, bfr__ + 58);
+      IMC::reverseLoad(depth_max, bfr__ + 60);
+      return 64;
     }
 
     void
@@ -24952,31 +24821,30 @@ namespace DUNE
     uint8_t*
     SadcReadings::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(channel, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(gain, ptr__);
-      return ptr__;
+      IMC::store(channel, bfr__ + 0);
+      IMC::store(value, bfr__ + 1);
+      IMC::store(gain, bfr__ + 5);
+      return bfr__ + 6;
     }
 
     uint16_t
     SadcReadings::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(channel, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(gain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 6) throw BufferTooShort();
+      IMC::load(channel, bfr__ + 0);
+      IMC::load(value, bfr__ + 1);
+      IMC::load(gain, bfr__ + 5);
+      return 6;
     }
 
     uint16_t
     SadcReadings::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(channel, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(gain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 6) throw BufferTooShort();
+      IMC::load(channel, bfr__ + 0);
+      IMC::reverseLoad(value, bfr__ + 1);
+      IMC::load(gain, bfr__ + 5);
+      return 6;
     }
 
     fp64_t
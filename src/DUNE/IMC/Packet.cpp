@@ -239,7 +239,8 @@ namespace DUNE
         throw InvalidCrc();
 
       // Produce a message of the given type.
-      if (msg == NULL)
+      bool produced = (msg == NULL);
+      if (produced)
       {
         msg = Factory::produce(hdr.mgid);
         if (msg == 0)
@@ -261,7 +262,8 @@ namespace DUNE
       }
       catch (...)
       {
-        delete msg;
+        if (produced)
+          delete msg;
         throw;
       }
 
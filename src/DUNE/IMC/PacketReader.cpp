@@ -0,0 +1,184 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Algorithms/CRC16.hpp>
+#include <DUNE/Utils/ByteCopy.hpp>
+#include <DUNE/IMC/Constants.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/IMC/Factory.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/Packet.hpp>
+#include <DUNE/IMC/PacketReader.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Size of the largest packet.
+    static const unsigned c_max_packet_size = DUNE_IMC_CONST_HEADER_SIZE
+    + DUNE_IMC_CONST_MAX_SIZE + DUNE_IMC_CONST_FOOTER_SIZE;
+
+    PacketReader::PacketReader(std::istream& is, unsigned block_size):
+      m_is(is),
+      m_begin(0),
+      m_end(0)
+    {
+      if (block_size < c_max_packet_size)
+        block_size = c_max_packet_size;
+
+      m_bfr.resize(block_size);
+    }
+
+    PacketReader::~PacketReader(void)
+    {
+      std::map<uint16_t, Message*>::iterator itr = m_instances.begin();
+      for (; itr != m_instances.end(); ++itr)
+        delete itr->second;
+    }
+
+    void
+    PacketReader::accept(uint16_t id)
+    {
+      if (m_filter.empty())
+        m_filter.resize(DUNE_IMC_CONST_NULL_ID + 1, false);
+
+      m_filter[id] = true;
+    }
+
+    void
+    PacketReader::acceptAll(void)
+    {
+      m_filter.clear();
+    }
+
+    bool
+    PacketReader::nextPacket(Header& hdr, const uint8_t*& data, unsigned& size)
+    {
+      while (true)
+      {
+        // End of stream, possibly within a truncated header.
+        if (!fill(DUNE_IMC_CONST_HEADER_SIZE))
+          return false;
+
+        const uint8_t* ptr = &m_bfr[m_begin];
+        Packet::deserializeHeader(hdr, ptr, DUNE_IMC_CONST_HEADER_SIZE);
+
+        unsigned total = DUNE_IMC_CONST_HEADER_SIZE + hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+        if (!fill(total))
+          throw BufferTooShort();
+
+        // Buffer may have been compacted.
+        ptr = &m_bfr[m_begin];
+        m_begin += total;
+
+        if (!isAccepted(hdr.mgid))
+          continue;
+
+        data = ptr;
+        size = total;
+        return true;
+      }
+    }
+
+    Message*
+    PacketReader::next(void)
+    {
+      Header hdr;
+      const uint8_t* data = NULL;
+      unsigned size = 0;
+
+      if (!nextPacket(hdr, data, size))
+        return NULL;
+
+      // Inline messages and message lists are not overwritten when
+      // deserialized, hence the instance is cleared first.
+      Message* msg = getInstance(hdr.mgid);
+      msg->clear();
+
+      return Packet::deserializePayload(hdr, data, size, msg);
+    }
+
+    void
+    PacketReader::validate(const Header& hdr, const uint8_t* data)
+    {
+      uint16_t rcrc = 0;
+
+      if (hdr.sync == DUNE_IMC_CONST_SYNC_REV)
+        Utils::ByteCopy::rcopy(rcrc, data + DUNE_IMC_CONST_HEADER_SIZE + hdr.size);
+      else
+        Utils::ByteCopy::copy(rcrc, data + DUNE_IMC_CONST_HEADER_SIZE + hdr.size);
+
+      if (Algorithms::CRC16::compute(data, DUNE_IMC_CONST_HEADER_SIZE + hdr.size) != rcrc)
+        throw InvalidCrc();
+    }
+
+    bool
+    PacketReader::fill(unsigned size)
+    {
+      if (m_end - m_begin >= size)
+        return true;
+
+      // Move the partial packet to the start of the buffer.
+      if (m_begin > 0)
+      {
+        std::memmove(&m_bfr[0], &m_bfr[m_begin], m_end - m_begin);
+        m_end -= m_begin;
+        m_begin = 0;
+      }
+
+      while (m_end < size && m_is.good())
+      {
+        m_is.read((char*)&m_bfr[m_end], m_bfr.size() - m_end);
+        m_end += m_is.gcount();
+      }
+
+      return m_end >= size;
+    }
+
+    Message*
+    PacketReader::getInstance(uint16_t id)
+    {
+      std::map<uint16_t, Message*>::iterator itr = m_instances.find(id);
+      if (itr != m_instances.end())
+        return itr->second;
+
+      Message* msg = Factory::produce(id);
+      if (msg == NULL)
+        throw InvalidMessageId(id);
+
+      m_instances[id] = msg;
+      return msg;
+    }
+  }
+}
@@ -0,0 +1,163 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+#ifndef DUNE_IMC_PACKET_READER_HPP_INCLUDED_
+#define DUNE_IMC_PACKET_READER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <istream>
+#include <map>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Header.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM PacketReader;
+
+    // Forward declarations.
+    class Message;
+
+    //! Sequential reader of IMC packets stored in a stream, such as
+    //! an LSF log. Data is read from the stream in large blocks and
+    //! packets are framed in place. Messages are deserialized into a
+    //! per-type instance owned by the reader, which is reused for
+    //! every subsequent packet with the same identification number.
+    //! Packets not accepted by the filter are skipped without being
+    //! validated or deserialized.
+    class PacketReader
+    {
+    public:
+      //! Default size of blocks read from the stream.
+      static const unsigned c_block_size = 1 << 20;
+
+      //! Constructor.
+      //! @param[in] is input stream.
+      //! @param[in] block_size size of blocks read from the stream,
+      //! which is raised to the size of the largest packet if needed.
+      PacketReader(std::istream& is, unsigned block_size = c_block_size);
+
+      //! Destructor.
+      ~PacketReader(void);
+
+      //! Accept messages with a given identification number. Once a
+      //! message is accepted, messages not explicitly accepted are
+      //! skipped.
+      //! @param[in] id message identification number.
+      void
+      accept(uint16_t id);
+
+      //! Accept all messages.
+      void
+      acceptAll(void);
+
+      //! Test if a message is accepted by the filter.
+      //! @param[in] id message identification number.
+      //! @return true if the message is accepted, false otherwise.
+      bool
+      isAccepted(uint16_t id) const
+      {
+        return m_filter.empty() || m_filter[id];
+      }
+
+      //! Discard buffered data. Must be called after the position
+      //! of the input stream is changed.
+      void
+      reset(void)
+      {
+        m_begin = 0;
+        m_end = 0;
+      }
+
+      //! Frame the next accepted packet without deserializing it.
+      //! @param[out] hdr packet header.
+      //! @param[out] data pointer to the serialized packet, valid
+      //! until the next call to nextPacket() or next().
+      //! @param[out] size size of the serialized packet, which
+      //! may exceed 65535 bytes.
+      //! @return true if a packet was read, false at end of stream.
+      //! @throw BufferTooShort if the stream ends within a packet.
+      //! @throw InvalidSync if the stream is not synchronized.
+      bool
+      nextPacket(Header& hdr, const uint8_t*& data, unsigned& size);
+
+      //! Validate the CRC of a packet framed by nextPacket().
+      //! @param[in] hdr packet header.
+      //! @param[in] data serialized packet.
+      //! @throw InvalidCrc if the packet is corrupted.
+      static void
+      validate(const Header& hdr, const uint8_t* data);
+
+      //! Read and deserialize the next accepted message.
+      //! @return message object owned by the reader and valid until
+      //! the next message with the same identification number is
+      //! read, or NULL at end of stream.
+      //! @throw BufferTooShort if the stream ends within a packet.
+      //! @throw InvalidSync if the stream is not synchronized.
+      //! @throw InvalidCrc if the packet is corrupted.
+      //! @throw InvalidMessageId if the message is unknown.
+      Message*
+      next(void);
+
+    private:
+      //! Input stream.
+      std::istream& m_is;
+      //! Block buffer.
+      std::vector<uint8_t> m_bfr;
+      //! Offset of the first unread byte.
+      unsigned m_begin;
+      //! Offset past the last buffered byte.
+      unsigned m_end;
+      //! Accepted message identification numbers (empty if all).
+      std::vector<bool> m_filter;
+      //! Reusable message instances.
+      std::map<uint16_t, Message*> m_instances;
+
+      //! Make sure at least a given number of bytes are buffered.
+      //! @param[in] size number of bytes.
+      //! @return true if the bytes are available, false otherwise.
+      bool
+      fill(unsigned size);
+
+      //! Retrieve the reusable instance of a given message.
+      //! @param[in] id message identification number.
+      //! @return message instance.
+      Message*
+      getInstance(uint16_t id);
+    };
+  }
+}
+
+#endif
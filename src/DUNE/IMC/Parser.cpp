@@ -27,6 +27,9 @@
 // Author: Eduardo Marques                                                  *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <algorithm>
+
 // DUNE headers.
 #include <DUNE/IMC/Parser.hpp>
 #include <DUNE/IMC/Packet.hpp>
@@ -35,6 +38,28 @@ namespace DUNE
 {
   namespace IMC
   {
+    //! Test if a buffer starts with a synchronization number of
+    //! either byte order.
+    static inline bool
+    isSync(const uint8_t* bfr)
+    {
+      uint16_t sync = (bfr[0] << 8) | bfr[1];
+      return sync == DUNE_IMC_CONST_SYNC || sync == DUNE_IMC_CONST_SYNC_REV;
+    }
+
+    //! Find the next byte that may start a synchronization number.
+    static inline const uint8_t*
+    findSync(const uint8_t* bfr, const uint8_t* end)
+    {
+      for (; bfr != end; ++bfr)
+      {
+        if (*bfr == (DUNE_IMC_CONST_SYNC >> 8) || *bfr == (DUNE_IMC_CONST_SYNC_REV >> 8))
+          break;
+      }
+
+      return bfr;
+    }
+
     Parser::Parser(void)
     {
       reset();
@@ -132,5 +157,100 @@ namespace DUNE
 
       return m;
     }
+
+    size_t
+    Parser::parse(const uint8_t* data, size_t size, std::vector<Message*>& msgs)
+    {
+      size_t count = msgs.size();
+
+      // Drop data already handled by the byte oriented interface.
+      if (m_pos > 0)
+        m_buf.erase(m_buf.begin(), m_buf.begin() + m_pos);
+      m_stage = c_sync;
+      m_pos = 0;
+
+      // Complete the packet left over by the previous block, copying
+      // only the bytes it still needs.
+      while (!m_buf.empty() && size > 0)
+      {
+        size_t need = DUNE_IMC_CONST_HEADER_SIZE;
+
+        if (m_buf.size() >= DUNE_IMC_CONST_HEADER_SIZE && isSync(&m_buf[0]))
+        {
+          Packet::deserializeHeader(m_header, &m_buf[0], DUNE_IMC_CONST_HEADER_SIZE);
+          need += m_header.size + DUNE_IMC_CONST_FOOTER_SIZE;
+        }
+
+        if (m_buf.size() < need)
+        {
+          size_t n = std::min(need - m_buf.size(), size);
+          m_buf.insert(m_buf.end(), data, data + n);
+          data += n;
+          size -= n;
+
+          if (m_buf.size() < need)
+            break;
+
+          // Header completed, find out the packet size.
+          if (need == DUNE_IMC_CONST_HEADER_SIZE)
+            continue;
+        }
+
+        size_t n = scan(&m_buf[0], m_buf.size(), msgs);
+        m_buf.erase(m_buf.begin(), m_buf.begin() + n);
+      }
+
+      if (m_buf.empty())
+      {
+        // Parse packets in place and keep only the incomplete tail.
+        size_t n = scan(data, size, msgs);
+        m_buf.assign(data + n, data + size);
+      }
+
+      return msgs.size() - count;
+    }
+
+    size_t
+    Parser::scan(const uint8_t* bfr, size_t size, std::vector<Message*>& msgs)
+    {
+      const uint8_t* ptr = bfr;
+      const uint8_t* end = bfr + size;
+      Header hdr;
+
+      while (true)
+      {
+        ptr = findSync(ptr, end);
+        if (end - ptr < 2)
+          break;
+
+        if (!isSync(ptr))
+        {
+          ++ptr;
+          continue;
+        }
+
+        size_t n = end - ptr;
+        if (n < DUNE_IMC_CONST_HEADER_SIZE)
+          break; // need more data
+
+        Packet::deserializeHeader(hdr, ptr, DUNE_IMC_CONST_HEADER_SIZE);
+
+        size_t total = DUNE_IMC_CONST_HEADER_SIZE + hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+        if (n < total)
+          break; // need more data
+
+        try
+        {
+          msgs.push_back(Packet::deserializePayload(hdr, ptr, total, 0));
+          ptr += total;
+        }
+        catch (...)
+        {
+          ++ptr; // try to find sync again from next position
+        }
+      }
+
+      return ptr - bfr;
+    }
   }
 }
@@ -31,6 +31,7 @@
 #define DUNE_IMC_PARSER_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
+#include <cstddef>
 #include <vector>
 
 // DUNE headers.
@@ -63,6 +64,17 @@ namespace DUNE
       Message*
       parse(uint8_t byte);
 
+      //! Parse a block of data and append all messages it completes
+      //! to the given list. Incomplete packets at the end of the block
+      //! are kept and completed by subsequent calls.
+      //! @param data data buffer.
+      //! @param size number of bytes in data buffer.
+      //! @param msgs list where parsed messages are appended (the
+      //! caller takes ownership of them).
+      //! @return number of messages appended to the list.
+      size_t
+      parse(const uint8_t* data, size_t size, std::vector<Message*>& msgs);
+
     private:
       //! Parser stage constants.
       enum ParserStage
@@ -76,6 +88,15 @@ namespace DUNE
       std::vector<uint8_t> m_buf; //!< Internal buffer.
       unsigned int m_pos; //!< Buffer position.
       Header m_header; //!< Holds parsed header (c_payload stage).
+
+      //! Parse all packets of a contiguous buffer.
+      //! @param bfr data buffer.
+      //! @param size number of bytes in data buffer.
+      //! @param msgs list where parsed messages are appended.
+      //! @return number of bytes consumed, i.e., the offset of the
+      //! first byte that may belong to an incomplete packet.
+      static size_t
+      scan(const uint8_t* bfr, size_t size, std::vector<Message*>& msgs);
     };
   }
 }
@@ -174,6 +174,50 @@ namespace DUNE
 
     uint16_t
     reverseDeserialize(std::vector<char>& t, const uint8_t* bfr, uint16_t& length);
+
+    //! Serialize a scalar at a known offset of a buffer. Used by
+    //! messages whose fields have fixed size, after the buffer size
+    //! has been checked once for all fields.
+    //! @param t scalar to serialize.
+    //! @param bfr buffer where to place the serialized bytes.
+    template <typename Type>
+    inline void
+    store(const Type t, uint8_t* bfr)
+    {
+      std::memcpy(bfr, &t, sizeof(Type));
+    }
+
+    //! Serialize a floating point value (double precision) at a
+    //! known offset of a buffer.
+    //! @param t floating point value to serialize.
+    //! @param bfr buffer where to place the serialized bytes.
+    inline void
+    store(const fp64_t t, uint8_t* bfr)
+    {
+      serialize(t, bfr);
+    }
+
+    //! Deserialize a scalar from a known offset of a buffer without
+    //! bounds checking.
+    //! @param t scalar where to place the deserialized bytes.
+    //! @param bfr buffer where to read the serialized bytes.
+    template <typename Type>
+    inline void
+    load(Type& t, const uint8_t* bfr)
+    {
+      std::memcpy(&t, bfr, sizeof(Type));
+    }
+
+    //! Deserialize a scalar with the opposite byte order from a known
+    //! offset of a buffer without bounds checking.
+    //! @param t scalar where to place the deserialized bytes.
+    //! @param bfr buffer where to read the serialized bytes.
+    template <typename Type>
+    inline void
+    reverseLoad(Type& t, const uint8_t* bfr)
+    {
+      Utils::reverseCopy(t, (char*)bfr);
+    }
   }
 }
 
@@ -0,0 +1,116 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+#ifndef DUNE_IMC_SHARED_MESSAGE_HPP_INCLUDED_
+#define DUNE_IMC_SHARED_MESSAGE_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
+#include <DUNE/IMC/Message.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM SharedMessage;
+
+    //! Immutable, reference-counted message used to deliver a single
+    //! copy of a dispatched message to all recipients of the bus.
+    //! Every holder must call acquire() before storing a pointer to
+    //! the object and release() when done with it. The object is
+    //! destroyed when the last reference is released.
+    class SharedMessage
+    {
+    public:
+      //! Create a shared copy of a message. The caller holds the
+      //! first reference.
+      //! @param[in] msg message to copy.
+      explicit SharedMessage(const Message* msg):
+        m_msg(msg->clone()),
+        m_refs(1)
+      { }
+
+      //! Retrieve the shared message.
+      //! @return message object.
+      inline const Message*
+      get(void) const
+      {
+        return m_msg;
+      }
+
+      //! Retrieve the identification number of the shared message.
+      //! @return message identification number.
+      inline uint16_t
+      getId(void) const
+      {
+        return m_msg->getId();
+      }
+
+      //! Add a reference to this object.
+      inline void
+      acquire(void)
+      {
+        m_refs.add(1);
+      }
+
+      //! Drop a reference to this object, destroying it if this
+      //! was the last one.
+      inline void
+      release(void)
+      {
+        if (m_refs.sub(1) == 0)
+          delete this;
+      }
+
+    private:
+      //! Message.
+      Message* m_msg;
+      //! Reference count.
+      Concurrency::AtomicCounter m_refs;
+
+      //! Destructor is private, use release().
+      ~SharedMessage(void)
+      {
+        delete m_msg;
+      }
+
+      //! Non - copyable.
+      SharedMessage(const SharedMessage&);
+
+      //! Non - assignable.
+      SharedMessage&
+      operator=(const SharedMessage&);
+    };
+  }
+}
+
+#endif
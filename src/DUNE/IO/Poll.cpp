@@ -29,6 +29,8 @@
 
 // ISO C++ 98 headers.
 #include <algorithm>
+#include <climits>
+#include <cmath>
 #include <cstring>
 
 // DUNE headers.
@@ -38,6 +40,15 @@
 #include <DUNE/Time/Utils.hpp>
 #include <DUNE/IO/Poll.hpp>
 
+// POSIX headers.
+#if defined(DUNE_SYS_HAS_POLL_H)
+#  include <poll.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
 namespace DUNE
 {
   namespace IO
@@ -45,10 +56,113 @@ namespace DUNE
     using std::memset;
     using System::Error;
 
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+    //! Convert events to epoll events.
+    static uint32_t
+    toEpoll(unsigned events)
+    {
+      uint32_t rv = 0;
+
+      if (events & Poll::EV_READ)
+        rv |= EPOLLIN;
+
+      if (events & Poll::EV_WRITE)
+        rv |= EPOLLOUT;
+
+      if (events & Poll::EV_EDGE)
+        rv |= EPOLLET;
+
+      return rv;
+    }
+
+    //! Convert epoll events to events. Errors and hang-ups are
+    //! reported as read readiness, as select() does.
+    static unsigned
+    fromEpoll(uint32_t events)
+    {
+      unsigned rv = 0;
+
+      if (events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+        rv |= Poll::EV_READ;
+
+      if (events & (EPOLLOUT | EPOLLERR))
+        rv |= Poll::EV_WRITE;
+
+      return rv;
+    }
+#endif
+
+    Poll::Poll(void)
+    {
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      m_epfd = epoll_create1(EPOLL_CLOEXEC);
+      if (m_epfd == -1)
+        throw Error("creating epoll instance", Error::getLastMessage());
+
+#elif defined(DUNE_OS_POSIX)
+      FD_ZERO(&m_rfd);
+      FD_ZERO(&m_wfd);
+
+#elif defined(DUNE_OS_WINDOWS)
+      m_rv = WAIT_TIMEOUT;
+#endif
+    }
+
+    Poll::~Poll(void)
+    {
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      close(m_epfd);
+#endif
+    }
+
     void
-    Poll::add(const NativeHandle& handle)
+    Poll::add(const NativeHandle& handle, unsigned events)
     {
-      m_handles.push_back(handle);
+      std::vector<NativeHandle>::iterator itr;
+      itr = std::find(m_handles.begin(), m_handles.end(), handle);
+      bool exists = (itr != m_handles.end());
+
+      if (exists)
+      {
+        m_events[itr - m_handles.begin()] = events;
+      }
+      else
+      {
+        m_handles.push_back(handle);
+        m_events.push_back(events);
+      }
+
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      if (std::find(m_always.begin(), m_always.end(), handle) != m_always.end())
+        return;
+
+      epoll_event ev;
+      memset(&ev, 0, sizeof(ev));
+      ev.events = toEpoll(events);
+      ev.data.fd = handle;
+
+      if (epoll_ctl(m_epfd, exists ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, handle, &ev) == 0)
+        return;
+
+      // The descriptor was closed and reused without being removed,
+      // or is still registered through a duplicate.
+      if (errno == ENOENT && epoll_ctl(m_epfd, EPOLL_CTL_ADD, handle, &ev) == 0)
+        return;
+
+      if (errno == EEXIST && epoll_ctl(m_epfd, EPOLL_CTL_MOD, handle, &ev) == 0)
+        return;
+
+      // Regular files are not supported by epoll but never block.
+      if (errno == EPERM)
+      {
+        m_always.push_back(handle);
+        return;
+      }
+
+      Error e("adding handle to poll", Error::getLastMessage());
+      remove(handle);
+      throw e;
+#endif
     }
 
     void
@@ -57,17 +171,46 @@ namespace DUNE
       std::vector<NativeHandle>::iterator itr;
       itr = std::find(m_handles.begin(), m_handles.end(), handle);
       if (itr != m_handles.end())
+      {
+        m_events.erase(m_events.begin() + (itr - m_handles.begin()));
         m_handles.erase(itr);
+      }
+
+      itr = std::find(m_triggered.begin(), m_triggered.end(), handle);
+      if (itr != m_triggered.end())
+        m_triggered.erase(itr);
+
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      itr = std::find(m_always.begin(), m_always.end(), handle);
+      if (itr != m_always.end())
+        m_always.erase(itr);
+      else
+        epoll_ctl(m_epfd, EPOLL_CTL_DEL, handle, NULL);
+
+      if (handle >= 0 && (size_t)handle < m_revents.size())
+        m_revents[handle] = 0;
+#endif
     }
 
     bool
-    Poll::wasTriggered(const NativeHandle& handle)
+    Poll::wasTriggered(const NativeHandle& handle, unsigned events) const
     {
-#if defined(DUNE_OS_POSIX)
-      // Only the triggered fd's remain in the set after select() exits.
-      return FD_ISSET(handle, &m_rfd) != 0;
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      if (handle < 0 || (size_t)handle >= m_revents.size())
+        return false;
+
+      return (m_revents[handle] & events) != 0;
+
+#elif defined(DUNE_OS_POSIX)
+      // Only the triggered fd's remain in the sets after select() exits.
+      if ((events & EV_READ) && FD_ISSET(handle, const_cast<fd_set*>(&m_rfd)))
+        return true;
+
+      if ((events & EV_WRITE) && FD_ISSET(handle, const_cast<fd_set*>(&m_wfd)))
+        return true;
 
 #elif defined(DUNE_OS_WINDOWS)
+      (void)events;
       size_t idx = m_rv - WAIT_OBJECT_0;
       if (idx < m_handles.size())
       {
@@ -82,12 +225,61 @@ namespace DUNE
     bool
     Poll::poll(double timeout)
     {
-#if defined(DUNE_OS_WINDOWS)
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      for (size_t i = 0; i < m_triggered.size(); ++i)
+        m_revents[m_triggered[i]] = 0;
+      m_triggered.clear();
+
+      int ms = -1;
+      if (!m_always.empty())
+        ms = 0;
+      else if (timeout >= 0.0)
+        ms = (timeout * 1000.0 >= INT_MAX) ? INT_MAX : (int)std::ceil(timeout * 1000.0);
+
+      m_ready.resize(std::max(m_handles.size(), (size_t)1));
+      int rv = epoll_wait(m_epfd, &m_ready[0], (int)m_ready.size(), ms);
+
+      if (rv == -1)
+      {
+        //! Workaround for when we are interrupted by a signal.
+        if (errno == EINTR)
+          return false;
+        else
+          throw Error("polling handle", Error::getLastMessage());
+      }
+
+      for (int i = 0; i < rv; ++i)
+      {
+        int fd = m_ready[i].data.fd;
+        if ((size_t)fd >= m_revents.size())
+          m_revents.resize(fd + 1, 0);
+
+        m_revents[fd] = fromEpoll(m_ready[i].events);
+        m_triggered.push_back(fd);
+      }
+
+      for (size_t i = 0; i < m_always.size(); ++i)
+      {
+        int fd = m_always[i];
+        if ((size_t)fd >= m_revents.size())
+          m_revents.resize(fd + 1, 0);
+
+        size_t idx = std::find(m_handles.begin(), m_handles.end(), fd) - m_handles.begin();
+        m_revents[fd] = m_events[idx] & (EV_READ | EV_WRITE);
+        m_triggered.push_back(fd);
+      }
+
+      return !m_triggered.empty();
+
+#elif defined(DUNE_OS_WINDOWS)
+      m_triggered.clear();
+
       DWORD count = m_handles.size();
       m_rv = WaitForMultipleObjects(count, &m_handles[0], FALSE, timeout * 1000);
 
       if (m_rv < count)
       {
+        m_triggered.push_back(m_handles[m_rv - WAIT_OBJECT_0]);
         return true;
       }
 
@@ -105,22 +297,29 @@ namespace DUNE
       int rv = 0;
       NativeHandle max = 0;
       FD_ZERO(&m_rfd);
+      FD_ZERO(&m_wfd);
+      m_triggered.clear();
 
-      for (std::vector<NativeHandle>::iterator itr = m_handles.begin(); itr != m_handles.end(); ++itr)
+      for (size_t i = 0; i < m_handles.size(); ++i)
       {
-        if (*itr > max)
-          max = *itr;
-        FD_SET(*itr, &m_rfd);
+        if (m_handles[i] > max)
+          max = m_handles[i];
+
+        if (m_events[i] & EV_READ)
+          FD_SET(m_handles[i], &m_rfd);
+
+        if (m_events[i] & EV_WRITE)
+          FD_SET(m_handles[i], &m_wfd);
       }
 
       if (timeout < 0.0)
       {
-        rv = select(max + 1, &m_rfd, NULL, NULL, NULL);
+        rv = select(max + 1, &m_rfd, &m_wfd, NULL, NULL);
       }
       else
       {
         timeval tv = DUNE_TIMEVAL_INIT_SEC_FP(timeout);
-        rv = select(max + 1, &m_rfd, NULL, NULL, &tv);
+        rv = select(max + 1, &m_rfd, &m_wfd, NULL, &tv);
       }
 
       if (rv == -1)
@@ -132,6 +331,12 @@ namespace DUNE
           throw Error("polling handle", Error::getLastMessage());
       }
 
+      for (size_t i = 0; rv > 0 && i < m_handles.size(); ++i)
+      {
+        if (wasTriggered(m_handles[i], EV_READ | EV_WRITE))
+          m_triggered.push_back(m_handles[i]);
+      }
+
       return rv > 0;
 #endif
     }
@@ -143,6 +348,30 @@ namespace DUNE
       DWORD rv = WaitForSingleObjectEx(handle, timeout * 1000, FALSE);
       return rv == WAIT_OBJECT_0;
 
+#elif defined(DUNE_SYS_HAS_POLL_H)
+      // poll() is not limited to descriptors below FD_SETSIZE.
+      pollfd pfd;
+      pfd.fd = handle;
+      pfd.events = POLLIN;
+      pfd.revents = 0;
+
+      int ms = -1;
+      if (timeout >= 0.0)
+        ms = (timeout * 1000.0 >= INT_MAX) ? INT_MAX : (int)std::ceil(timeout * 1000.0);
+
+      int rv = ::poll(&pfd, 1, ms);
+
+      if (rv == -1)
+      {
+        //! Workaround for when we are interrupted by a signal.
+        if (errno == EINTR)
+          return false;
+        else
+          throw Error("polling handle", Error::getLastMessage());
+      }
+
+      return rv > 0;
+
 #elif defined(DUNE_OS_POSIX)
       fd_set rfd;
       FD_ZERO(&rfd);
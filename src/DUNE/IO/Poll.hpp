@@ -38,7 +38,9 @@
 #include <DUNE/IO/Handle.hpp>
 
 // POSIX headers.
-#if defined(DUNE_OS_POSIX)
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+#  include <sys/epoll.h>
+#elif defined(DUNE_OS_POSIX)
 #  include <sys/select.h>
 #endif
 
@@ -49,9 +51,28 @@ namespace DUNE
     // Export symbol.
     class DUNE_DLL_SYM Poll;
 
+    //! Wait for I/O readiness on a pool of handles. On Linux the
+    //! pool is backed by epoll, so the cost of a wakeup depends on
+    //! the number of ready handles and not on the size of the pool.
+    //! Other POSIX systems use select() and are limited to
+    //! FD_SETSIZE descriptors.
     class Poll
     {
     public:
+      //! Readiness events.
+      enum Events
+      {
+        //! Handle is ready for reading.
+        EV_READ = 0x01,
+        //! Handle is ready for writing.
+        EV_WRITE = 0x02,
+        //! Report readiness only when it changes (edge-triggered).
+        //! The handle must then be read or written until it would
+        //! block, otherwise the remaining data is not reported
+        //! again. Ignored where epoll is not available.
+        EV_EDGE = 0x04
+      };
+
       static bool
       poll(const NativeHandle& handle, double timeout);
 
@@ -61,17 +82,46 @@ namespace DUNE
         return poll(handle.getNative(), timeout);
       }
 
-      //! Add native I/O handle to the polling pool.
+      //! Constructor.
+      Poll(void);
+
+      //! Destructor.
+      ~Poll(void);
+
+      //! Add native I/O handle to the polling pool. If the handle
+      //! is already in the pool its events are replaced.
       //! @param[in] handle native I/O handle.
+      //! @param[in] events events to wait for (see Events).
       void
-      add(const NativeHandle& handle);
+      add(const NativeHandle& handle, unsigned events = EV_READ);
 
       //! Add I/O handle to the polling pool.
       //! @param[in] handle I/O handle.
+      //! @param[in] events events to wait for (see Events).
+      void
+      add(const Handle& handle, unsigned events = EV_READ)
+      {
+        add(handle.getNative(), events);
+      }
+
+      //! Change the events to wait for on a native I/O handle
+      //! already in the polling pool, e.g., to wait for write
+      //! readiness only while there is data to send.
+      //! @param[in] handle native I/O handle.
+      //! @param[in] events events to wait for (see Events).
+      void
+      modify(const NativeHandle& handle, unsigned events)
+      {
+        add(handle, events);
+      }
+
+      //! Change the events to wait for on an I/O handle.
+      //! @param[in] handle I/O handle.
+      //! @param[in] events events to wait for (see Events).
       void
-      add(const Handle& handle)
+      modify(const Handle& handle, unsigned events)
       {
-        add(handle.getNative());
+        add(handle.getNative(), events);
       }
 
       //! Remove native I/O handle from the polling pool.
@@ -90,23 +140,59 @@ namespace DUNE
       bool
       poll(double timeout);
 
+      //! Test if a native I/O handle was reported ready by the last
+      //! call to poll().
+      //! @param[in] handle native I/O handle.
+      //! @param[in] events events to test (see Events).
+      //! @return true if any of the events was triggered.
       bool
-      wasTriggered(const NativeHandle& handle);
+      wasTriggered(const NativeHandle& handle, unsigned events = EV_READ) const;
 
       bool
-      wasTriggered(const Handle& handle)
+      wasTriggered(const Handle& handle, unsigned events = EV_READ) const
       {
-        return wasTriggered(handle.getNative());
+        return wasTriggered(handle.getNative(), events);
+      }
+
+      //! Get the native I/O handles reported ready by the last call
+      //! to poll().
+      //! @return list of ready handles.
+      const std::vector<NativeHandle>&
+      getTriggered(void) const
+      {
+        return m_triggered;
       }
 
     private:
       //! List of native I/O handles.
       std::vector<NativeHandle> m_handles;
-#if defined(DUNE_OS_POSIX)
+      //! Events of each handle in m_handles.
+      std::vector<unsigned> m_events;
+      //! Handles reported ready by the last poll.
+      std::vector<NativeHandle> m_triggered;
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      //! epoll instance.
+      int m_epfd;
+      //! Events returned by epoll_wait().
+      std::vector<epoll_event> m_ready;
+      //! Triggered events indexed by descriptor.
+      std::vector<unsigned> m_revents;
+      //! Handles that epoll does not support (regular files), which
+      //! are always ready.
+      std::vector<NativeHandle> m_always;
+#elif defined(DUNE_OS_POSIX)
       fd_set m_rfd;
+      fd_set m_wfd;
 #elif defined(DUNE_OS_WINDOWS)
       DWORD m_rv;
 #endif
+
+      //! Non-copyable.
+      Poll(const Poll&);
+
+      //! Non-assignable.
+      Poll&
+      operator=(const Poll&);
     };
   }
 }
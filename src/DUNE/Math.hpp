@@ -41,6 +41,7 @@ namespace DUNE
 #include <DUNE/Math/Derivative.hpp>
 #include <DUNE/Math/General.hpp>
 #include <DUNE/Math/Matrix.hpp>
+#include <DUNE/Math/FixedMatrix.hpp>
 #include <DUNE/Math/Angles.hpp>
 #include <DUNE/Math/Random.hpp>
 #include <DUNE/Math/Optimization.hpp>
@@ -0,0 +1,516 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_MATH_FIXED_MATRIX_HPP_INCLUDED_
+#define DUNE_MATH_FIXED_MATRIX_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Math/Matrix.hpp>
+
+namespace DUNE
+{
+  namespace Math
+  {
+    //! Base of all fixed size matrix expressions. Sums, differences,
+    //! scaling and transposition are evaluated lazily, element by
+    //! element, when assigned to a FixedMatrix. Products are evaluated
+    //! into temporaries on the stack, so no expression ever allocates
+    //! memory from the heap.
+    //! @tparam E expression type.
+    //! @tparam R number of rows.
+    //! @tparam C number of columns.
+    template <typename E, unsigned R, unsigned C>
+    class FixedExpression
+    {
+    public:
+      //! Get the number of rows.
+      //! @return number of rows.
+      static unsigned
+      rows(void)
+      {
+        return R;
+      }
+
+      //! Get the number of columns.
+      //! @return number of columns.
+      static unsigned
+      columns(void)
+      {
+        return C;
+      }
+
+      //! Evaluate one element of the expression.
+      //! @param[in] i row index.
+      //! @param[in] j column index.
+      //! @return element value.
+      double
+      get(unsigned i, unsigned j) const
+      {
+        return static_cast<const E&>(*this).get(i, j);
+      }
+    };
+
+    //! Matrix with dimensions known at compile time. Elements are
+    //! stored in row-major order inside the object.
+    //! @tparam R number of rows.
+    //! @tparam C number of columns.
+    template <unsigned R, unsigned C>
+    class FixedMatrix: public FixedExpression<FixedMatrix<R, C>, R, C>
+    {
+    public:
+      //! Create a matrix filled with zeros.
+      FixedMatrix(void)
+      {
+        fill(0.0);
+      }
+
+      //! Create a matrix filled with a given value.
+      //! @param[in] value value of all elements.
+      explicit FixedMatrix(double value)
+      {
+        fill(value);
+      }
+
+      //! Create a matrix from an expression.
+      //! @param[in] e expression.
+      template <typename E>
+      FixedMatrix(const FixedExpression<E, R, C>& e)
+      {
+        assign(e);
+      }
+
+      //! Create a matrix from a dynamic matrix of the same dimensions.
+      //! @param[in] m dynamic matrix.
+      explicit FixedMatrix(const Matrix& m)
+      {
+        if ((unsigned)m.rows() != R || (unsigned)m.columns() != C)
+          throw Matrix::Error("Incompatible dimensions!");
+
+        for (unsigned i = 0; i < R; ++i)
+          for (unsigned j = 0; j < C; ++j)
+            m_data[i * C + j] = m(i, j);
+      }
+
+      //! Assign an expression, which may refer to this matrix.
+      //! @param[in] e expression.
+      //! @return reference to this matrix.
+      template <typename E>
+      FixedMatrix&
+      operator=(const FixedExpression<E, R, C>& e)
+      {
+        FixedMatrix tmp(e);
+        *this = tmp;
+        return *this;
+      }
+
+      //! Add an expression to this matrix.
+      //! @param[in] e expression.
+      //! @return reference to this matrix.
+      template <typename E>
+      FixedMatrix&
+      operator+=(const FixedExpression<E, R, C>& e)
+      {
+        FixedMatrix tmp(e);
+        for (unsigned k = 0; k < R * C; ++k)
+          m_data[k] += tmp.m_data[k];
+        return *this;
+      }
+
+      //! Subtract an expression from this matrix.
+      //! @param[in] e expression.
+      //! @return reference to this matrix.
+      template <typename E>
+      FixedMatrix&
+      operator-=(const FixedExpression<E, R, C>& e)
+      {
+        FixedMatrix tmp(e);
+        for (unsigned k = 0; k < R * C; ++k)
+          m_data[k] -= tmp.m_data[k];
+        return *this;
+      }
+
+      //! Multiply all elements by a scalar.
+      //! @param[in] x scalar.
+      //! @return reference to this matrix.
+      FixedMatrix&
+      operator*=(double x)
+      {
+        for (unsigned k = 0; k < R * C; ++k)
+          m_data[k] *= x;
+        return *this;
+      }
+
+      //! Set all elements to a given value.
+      //! @param[in] value value of all elements.
+      void
+      fill(double value)
+      {
+        for (unsigned k = 0; k < R * C; ++k)
+          m_data[k] = value;
+      }
+
+      //! Turn this matrix into the identity matrix.
+      void
+      identity(void)
+      {
+        fill(0.0);
+        for (unsigned k = 0; k < R && k < C; ++k)
+          m_data[k * C + k] = 1.0;
+      }
+
+      //! Get the number of elements.
+      //! @return number of elements.
+      static unsigned
+      size(void)
+      {
+        return R * C;
+      }
+
+      //! Access an element.
+      //! @param[in] i row index.
+      //! @param[in] j column index.
+      //! @return reference to element.
+      double&
+      operator()(unsigned i, unsigned j)
+      {
+        return m_data[i * C + j];
+      }
+
+      //! Access an element.
+      //! @param[in] i row index.
+      //! @param[in] j column index.
+      //! @return element value.
+      double
+      operator()(unsigned i, unsigned j) const
+      {
+        return m_data[i * C + j];
+      }
+
+      //! Access an element in row-major order, mostly useful for
+      //! vectors.
+      //! @param[in] k element index.
+      //! @return reference to element.
+      double&
+      operator()(unsigned k)
+      {
+        return m_data[k];
+      }
+
+      //! Access an element in row-major order, mostly useful for
+      //! vectors.
+      //! @param[in] k element index.
+      //! @return element value.
+      double
+      operator()(unsigned k) const
+      {
+        return m_data[k];
+      }
+
+      //! Evaluate one element.
+      //! @param[in] i row index.
+      //! @param[in] j column index.
+      //! @return element value.
+      double
+      get(unsigned i, unsigned j) const
+      {
+        return m_data[i * C + j];
+      }
+
+      //! Convert to a dynamic matrix.
+      //! @return dynamic matrix.
+      Matrix
+      toMatrix(void) const
+      {
+        return Matrix(const_cast<double*>(m_data), R, C);
+      }
+
+    private:
+      //! Elements in row-major order.
+      double m_data[R * C];
+
+      template <typename E>
+      void
+      assign(const FixedExpression<E, R, C>& e)
+      {
+        for (unsigned i = 0; i < R; ++i)
+          for (unsigned j = 0; j < C; ++j)
+            m_data[i * C + j] = e.get(i, j);
+      }
+    };
+
+    //! Fixed size column vector.
+    //! @tparam N number of elements.
+    template <unsigned N>
+    class FixedVector: public FixedMatrix<N, 1>
+    {
+    public:
+      //! Create a vector filled with zeros.
+      FixedVector(void)
+      { }
+
+      //! Create a vector from an expression.
+      //! @param[in] e expression.
+      template <typename E>
+      FixedVector(const FixedExpression<E, N, 1>& e):
+        FixedMatrix<N, 1>(e)
+      { }
+    };
+
+    //! Lazy sum of two expressions.
+    template <typename A, typename B, unsigned R, unsigned C>
+    class FixedSum: public FixedExpression<FixedSum<A, B, R, C>, R, C>
+    {
+    public:
+      FixedSum(const A& a, const B& b):
+        m_a(a),
+        m_b(b)
+      { }
+
+      double
+      get(unsigned i, unsigned j) const
+      {
+        return m_a.get(i, j) + m_b.get(i, j);
+      }
+
+    private:
+      const A& m_a;
+      const B& m_b;
+    };
+
+    //! Lazy difference of two expressions.
+    template <typename A, typename B, unsigned R, unsigned C>
+    class FixedDifference: public FixedExpression<FixedDifference<A, B, R, C>, R, C>
+    {
+    public:
+      FixedDifference(const A& a, const B& b):
+        m_a(a),
+        m_b(b)
+      { }
+
+      double
+      get(unsigned i, unsigned j) const
+      {
+        return m_a.get(i, j) - m_b.get(i, j);
+      }
+
+    private:
+      const A& m_a;
+      const B& m_b;
+    };
+
+    //! Lazy product of an expression and a scalar.
+    template <typename A, unsigned R, unsigned C>
+    class FixedScaled: public FixedExpression<FixedScaled<A, R, C>, R, C>
+    {
+    public:
+      FixedScaled(const A& a, double x):
+        m_a(a),
+        m_x(x)
+      { }
+
+      double
+      get(unsigned i, unsigned j) const
+      {
+        return m_a.get(i, j) * m_x;
+      }
+
+    private:
+      const A& m_a;
+      double m_x;
+    };
+
+    //! Lazy transpose of an expression.
+    template <typename A, unsigned R, unsigned C>
+    class FixedTranspose: public FixedExpression<FixedTranspose<A, R, C>, R, C>
+    {
+    public:
+      FixedTranspose(const A& a):
+        m_a(a)
+      { }
+
+      double
+      get(unsigned i, unsigned j) const
+      {
+        return m_a.get(j, i);
+      }
+
+    private:
+      const A& m_a;
+    };
+
+    template <typename A, typename B, unsigned R, unsigned C>
+    inline FixedSum<A, B, R, C>
+    operator+(const FixedExpression<A, R, C>& a, const FixedExpression<B, R, C>& b)
+    {
+      return FixedSum<A, B, R, C>(static_cast<const A&>(a), static_cast<const B&>(b));
+    }
+
+    template <typename A, typename B, unsigned R, unsigned C>
+    inline FixedDifference<A, B, R, C>
+    operator-(const FixedExpression<A, R, C>& a, const FixedExpression<B, R, C>& b)
+    {
+      return FixedDifference<A, B, R, C>(static_cast<const A&>(a), static_cast<const B&>(b));
+    }
+
+    template <typename A, unsigned R, unsigned C>
+    inline FixedScaled<A, R, C>
+    operator*(double x, const FixedExpression<A, R, C>& a)
+    {
+      return FixedScaled<A, R, C>(static_cast<const A&>(a), x);
+    }
+
+    template <typename A, unsigned R, unsigned C>
+    inline FixedScaled<A, R, C>
+    operator*(const FixedExpression<A, R, C>& a, double x)
+    {
+      return FixedScaled<A, R, C>(static_cast<const A&>(a), x);
+    }
+
+    template <typename A, unsigned R, unsigned C>
+    inline FixedTranspose<A, C, R>
+    transpose(const FixedExpression<A, R, C>& a)
+    {
+      return FixedTranspose<A, C, R>(static_cast<const A&>(a));
+    }
+
+    //! Matrix product. Products are always evaluated, since lazily
+    //! evaluating a chain of products would recompute inner products
+    //! once per element.
+    template <unsigned R, unsigned K, unsigned C>
+    inline FixedMatrix<R, C>
+    operator*(const FixedMatrix<R, K>& a, const FixedMatrix<K, C>& b)
+    {
+      FixedMatrix<R, C> rv;
+
+      for (unsigned i = 0; i < R; ++i)
+      {
+        for (unsigned k = 0; k < K; ++k)
+        {
+          double aik = a(i, k);
+          if (aik == 0.0)
+            continue;
+
+          for (unsigned j = 0; j < C; ++j)
+            rv(i, j) += aik * b(k, j);
+        }
+      }
+
+      return rv;
+    }
+
+    template <typename A, unsigned R, unsigned K, unsigned C>
+    inline FixedMatrix<R, C>
+    operator*(const FixedExpression<A, R, K>& a, const FixedMatrix<K, C>& b)
+    {
+      return FixedMatrix<R, K>(a) * b;
+    }
+
+    template <typename B, unsigned R, unsigned K, unsigned C>
+    inline FixedMatrix<R, C>
+    operator*(const FixedMatrix<R, K>& a, const FixedExpression<B, K, C>& b)
+    {
+      return a * FixedMatrix<K, C>(b);
+    }
+
+    template <typename A, typename B, unsigned R, unsigned K, unsigned C>
+    inline FixedMatrix<R, C>
+    operator*(const FixedExpression<A, R, K>& a, const FixedExpression<B, K, C>& b)
+    {
+      return FixedMatrix<R, K>(a) * FixedMatrix<K, C>(b);
+    }
+
+    //! Invert a square matrix using Gauss-Jordan elimination with
+    //! partial pivoting.
+    //! @param[in] a matrix to invert.
+    //! @return inverse matrix.
+    //! @throw Matrix::Error if the matrix is singular.
+    template <typename A, unsigned N>
+    inline FixedMatrix<N, N>
+    inverse(const FixedExpression<A, N, N>& a)
+    {
+      FixedMatrix<N, N> m(a);
+      FixedMatrix<N, N> rv;
+      rv.identity();
+
+      for (unsigned c = 0; c < N; ++c)
+      {
+        unsigned p = c;
+        for (unsigned i = c + 1; i < N; ++i)
+        {
+          if (std::fabs(m(i, c)) > std::fabs(m(p, c)))
+            p = i;
+        }
+
+        if (std::fabs(m(p, c)) <= Matrix::get_precision())
+          throw Matrix::Error("Inversion error!");
+
+        if (p != c)
+        {
+          for (unsigned j = 0; j < N; ++j)
+          {
+            std::swap(m(p, j), m(c, j));
+            std::swap(rv(p, j), rv(c, j));
+          }
+        }
+
+        double d = 1.0 / m(c, c);
+        for (unsigned j = 0; j < N; ++j)
+        {
+          m(c, j) *= d;
+          rv(c, j) *= d;
+        }
+
+        for (unsigned i = 0; i < N; ++i)
+        {
+          if (i == c)
+            continue;
+
+          double f = m(i, c);
+          if (f == 0.0)
+            continue;
+
+          for (unsigned j = 0; j < N; ++j)
+          {
+            m(i, j) -= f * m(c, j);
+            rv(i, j) -= f * rv(c, j);
+          }
+        }
+      }
+
+      return rv;
+    }
+  }
+}
+
+#endif
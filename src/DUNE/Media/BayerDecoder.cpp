@@ -29,15 +29,369 @@
 // Based on libdc1394.                                                      *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <cstring>
+#include <vector>
+
 // DUNE headers.
 #include <DUNE/Config.hpp>
 #include <DUNE/Media/BayerDecoder.hpp>
 
+// SIMD headers.
+#if defined(__SSE2__)
+#  include <emmintrin.h>
+#  define DUNE_MEDIA_BAYER_SIMD
+#endif
+
 namespace DUNE
 {
   namespace Media
   {
-    BayerDecoder::BayerDecoder(Tile tile, Method method)
+    //! Luma coefficients (8 bit fixed-point).
+    static const int c_luma_r = 77;
+    static const int c_luma_g = 150;
+    static const int c_luma_b = 29;
+    //! Chroma scale factors (7 bit fixed-point).
+    static const int c_chroma_b = 72;
+    static const int c_chroma_r = 91;
+    //! Chroma offset (128) and rounding (7 bit fixed-point).
+    static const int c_chroma_bias = (128 << 7) + 64;
+
+    //! Compute luma.
+    static inline int
+    luma(int r, int g, int b)
+    {
+      return (c_luma_r * r + c_luma_g * g + c_luma_b * b + 128) >> 8;
+    }
+
+    //! Compute chroma from a color component and luma.
+    static inline uint8_t
+    chroma(int c, int y, int scale)
+    {
+      return (uint8_t)(((c - y) * scale + c_chroma_bias) >> 7);
+    }
+
+#if defined(DUNE_MEDIA_BAYER_SIMD)
+    // Vectors of eight 16-bit lanes. Arithmetic wraps around, values
+    // are narrowed to 8 bits with unsigned saturation.
+    typedef __m128i Vector;
+
+    //! Load eight bytes.
+    static inline Vector
+    vload(const uint8_t* p)
+    {
+      return _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)p), _mm_setzero_si128());
+    }
+
+    //! Load sixteen bytes and add adjacent pairs.
+    static inline Vector
+    vloadPairs(const uint8_t* p)
+    {
+      __m128i v = _mm_loadu_si128((const __m128i*)p);
+      return _mm_add_epi16(_mm_and_si128(v, _mm_set1_epi16(0x00ff)), _mm_srli_epi16(v, 8));
+    }
+
+    //! Load eight lanes.
+    static inline Vector
+    vload16(const int16_t* p)
+    {
+      return _mm_loadu_si128((const __m128i*)p);
+    }
+
+    //! Narrow and store eight bytes.
+    static inline void
+    vstore(uint8_t* p, Vector v)
+    {
+      _mm_storel_epi64((__m128i*)p, _mm_packus_epi16(v, v));
+    }
+
+    static inline Vector
+    vset(int16_t v)
+    {
+      return _mm_set1_epi16(v);
+    }
+
+    static inline Vector
+    vadd(Vector a, Vector b)
+    {
+      return _mm_add_epi16(a, b);
+    }
+
+    static inline Vector
+    vsub(Vector a, Vector b)
+    {
+      return _mm_sub_epi16(a, b);
+    }
+
+    static inline Vector
+    vmul(Vector a, int16_t k)
+    {
+      return _mm_mullo_epi16(a, _mm_set1_epi16(k));
+    }
+
+    template <int N>
+    static inline Vector
+    vshl(Vector a)
+    {
+      return _mm_slli_epi16(a, N);
+    }
+
+    //! Arithmetic shift right.
+    template <int N>
+    static inline Vector
+    vsra(Vector a)
+    {
+      return _mm_srai_epi16(a, N);
+    }
+
+    //! Logical shift right.
+    template <int N>
+    static inline Vector
+    vsrl(Vector a)
+    {
+      return _mm_srli_epi16(a, N);
+    }
+
+    //! Select lanes of a where mask is set and of b elsewhere.
+    static inline Vector
+    vselect(Vector mask, Vector a, Vector b)
+    {
+      return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+
+    //! Clip value to fit in 8 bits.
+    static inline uint8_t
+    clip8(int v)
+    {
+      return (uint8_t)((v < 0) ? 0 : ((v > 255) ? 255 : v));
+    }
+
+    //! Build a mask of the lanes that hold green pixels.
+    //! @param[in] green_even true if green pixels have even columns.
+    static inline Vector
+    greenMask(bool green_even)
+    {
+      int16_t lanes[8];
+      for (int i = 0; i < 8; ++i)
+        lanes[i] = (((i & 1) == 0) == green_even) ? -1 : 0;
+      return vload16(lanes);
+    }
+
+    //! Bilinear interpolation of row 'p[1]' in the range [x, end).
+    //! Outputs are the color of the non-green pixels of the row
+    //! ('c'), the other color ('o') and green ('g').
+    static void
+    rowBilinear(const uint8_t* const* p, int x, int end, bool green_even,
+                uint8_t* c, uint8_t* o, uint8_t* g)
+    {
+      const uint8_t* u = p[0];
+      const uint8_t* m = p[1];
+      const uint8_t* d = p[2];
+      Vector green = greenMask(((x & 1) == 0) == green_even);
+
+      for (; x + 8 <= end; x += 8)
+      {
+        Vector vu = vload(u + x);
+        Vector vd = vload(d + x);
+        Vector vl = vload(m + x - 1);
+        Vector vr = vload(m + x + 1);
+        Vector vc = vload(m + x);
+        Vector diag = vadd(vadd(vload(u + x - 1), vload(u + x + 1)),
+                           vadd(vload(d + x - 1), vload(d + x + 1)));
+        Vector vert = vsrl<1>(vadd(vadd(vu, vd), vset(1)));
+        Vector horz = vsrl<1>(vadd(vadd(vl, vr), vset(1)));
+        Vector cross = vsrl<2>(vadd(vadd(vadd(vu, vd), vadd(vl, vr)), vset(2)));
+        diag = vsrl<2>(vadd(diag, vset(2)));
+
+        vstore(c + x, vselect(green, horz, vc));
+        vstore(o + x, vselect(green, vert, diag));
+        vstore(g + x, vselect(green, vc, cross));
+      }
+
+      for (; x < end; ++x)
+      {
+        if (((x & 1) == 0) == green_even)
+        {
+          c[x] = (uint8_t)((m[x - 1] + m[x + 1] + 1) >> 1);
+          o[x] = (uint8_t)((u[x] + d[x] + 1) >> 1);
+          g[x] = m[x];
+        }
+        else
+        {
+          c[x] = m[x];
+          o[x] = (uint8_t)((u[x - 1] + u[x + 1] + d[x - 1] + d[x + 1] + 2) >> 2);
+          g[x] = (uint8_t)((u[x] + d[x] + m[x - 1] + m[x + 1] + 2) >> 2);
+        }
+      }
+    }
+
+    //! High-quality linear interpolation of row 'p[2]' in the range
+    //! [x, end). Outputs are the same as rowBilinear().
+    static void
+    rowHQLinear(const uint8_t* const* p, int x, int end, bool green_even,
+                uint8_t* c, uint8_t* o, uint8_t* g)
+    {
+      const uint8_t* uu = p[0];
+      const uint8_t* u = p[1];
+      const uint8_t* m = p[2];
+      const uint8_t* d = p[3];
+      const uint8_t* dd = p[4];
+      Vector green = greenMask(((x & 1) == 0) == green_even);
+
+      for (; x + 8 <= end; x += 8)
+      {
+        Vector vc = vload(m + x);
+        Vector vu = vload(u + x);
+        Vector vd = vload(d + x);
+        Vector vl = vload(m + x - 1);
+        Vector vr = vload(m + x + 1);
+        Vector vuu = vload(uu + x);
+        Vector vdd = vload(dd + x);
+        Vector vll = vload(m + x - 2);
+        Vector vrr = vload(m + x + 2);
+        Vector diag = vadd(vadd(vload(u + x - 1), vload(u + x + 1)),
+                           vadd(vload(d + x - 1), vload(d + x + 1)));
+        Vector vert = vadd(vu, vd);
+        Vector horz = vadd(vl, vr);
+        Vector far_v = vadd(vuu, vdd);
+        Vector far_h = vadd(vll, vrr);
+        Vector outer = vadd(far_v, far_h);
+        Vector round = vset(4);
+
+        // Green pixels.
+        Vector g5 = vsub(vadd(vmul(vc, 5), round), diag);
+        Vector gv = vadd(vsub(vadd(g5, vshl<2>(vert)), far_v),
+                         vsrl<1>(vadd(far_h, vset(1))));
+        Vector gh = vadd(vsub(vadd(g5, vshl<2>(horz)), far_h),
+                         vsrl<1>(vadd(far_v, vset(1))));
+
+        // Red and blue pixels.
+        Vector co = vadd(vsub(vshl<1>(diag), vsrl<1>(vadd(vmul(outer, 3), vset(1)))),
+                         vadd(vmul(vc, 6), round));
+        Vector cg = vadd(vsub(vshl<1>(vadd(vert, horz)), outer),
+                         vadd(vshl<2>(vc), round));
+
+        vstore(c + x, vselect(green, vsra<3>(gh), vc));
+        vstore(o + x, vselect(green, vsra<3>(gv), vsra<3>(co)));
+        vstore(g + x, vselect(green, vc, vsra<3>(cg)));
+      }
+
+      for (; x < end; ++x)
+      {
+        int diag = u[x - 1] + u[x + 1] + d[x - 1] + d[x + 1];
+
+        if (((x & 1) == 0) == green_even)
+        {
+          int t0 = m[x] * 5 + ((u[x] + d[x]) << 2) - uu[x] - dd[x] - diag
+          + ((m[x - 2] + m[x + 2] + 1) >> 1);
+          int t1 = m[x] * 5 + ((m[x - 1] + m[x + 1]) << 2) - m[x - 2] - m[x + 2] - diag
+          + ((uu[x] + dd[x] + 1) >> 1);
+          c[x] = clip8((t1 + 4) >> 3);
+          o[x] = clip8((t0 + 4) >> 3);
+          g[x] = m[x];
+        }
+        else
+        {
+          int outer = uu[x] + dd[x] + m[x - 2] + m[x + 2];
+          int t0 = (diag << 1) - ((outer * 3 + 1) >> 1) + m[x] * 6;
+          int t1 = ((u[x] + d[x] + m[x - 1] + m[x + 1]) << 1) - outer + (m[x] << 2);
+          c[x] = m[x];
+          o[x] = clip8((t0 + 4) >> 3);
+          g[x] = clip8((t1 + 4) >> 3);
+        }
+      }
+    }
+
+    //! Interleave planar RGB rows into a RGB24 row.
+    static void
+    rowInterleave(const uint8_t* r, const uint8_t* g, const uint8_t* b, int width, uint8_t* rgb)
+    {
+      int x = 0;
+
+      // Pixels are widened to 32 bits and pairs of pixels are packed
+      // in 48 bits. Each 8 byte store writes 2 bytes past the pair,
+      // which are overwritten by the next store, so the last pixel
+      // of the row is left to the scalar loop.
+      const __m128i zero = _mm_setzero_si128();
+      const __m128i even = _mm_set_epi32(0, 0x00ffffff, 0, 0x00ffffff);
+      const __m128i odd = _mm_set_epi32(0x00ffffff, 0, 0x00ffffff, 0);
+
+      for (; x + 16 < width; x += 16)
+      {
+        __m128i vr = _mm_loadu_si128((const __m128i*)(r + x));
+        __m128i vg = _mm_loadu_si128((const __m128i*)(g + x));
+        __m128i vb = _mm_loadu_si128((const __m128i*)(b + x));
+        __m128i rg[2] = {_mm_unpacklo_epi8(vr, vg), _mm_unpackhi_epi8(vr, vg)};
+        __m128i bz[2] = {_mm_unpacklo_epi8(vb, zero), _mm_unpackhi_epi8(vb, zero)};
+        uint8_t* dst = rgb + x * 3;
+
+        for (int i = 0; i < 4; ++i, dst += 12)
+        {
+          __m128i p = (i & 1) ? _mm_unpackhi_epi16(rg[i / 2], bz[i / 2])
+            : _mm_unpacklo_epi16(rg[i / 2], bz[i / 2]);
+          p = _mm_or_si128(_mm_and_si128(p, even), _mm_srli_epi64(_mm_and_si128(p, odd), 8));
+          _mm_storel_epi64((__m128i*)dst, p);
+          _mm_storel_epi64((__m128i*)(dst + 6), _mm_srli_si128(p, 8));
+        }
+      }
+
+      for (; x < width; ++x)
+      {
+        rgb[x * 3] = r[x];
+        rgb[x * 3 + 1] = g[x];
+        rgb[x * 3 + 2] = b[x];
+      }
+    }
+
+    //! Convert planar RGB rows to a luma row.
+    static void
+    rowLuma(const uint8_t* r, const uint8_t* g, const uint8_t* b, int width, uint8_t* y)
+    {
+      int x = 0;
+      for (; x + 8 <= width; x += 8)
+      {
+        Vector v = vadd(vadd(vmul(vload(r + x), c_luma_r), vmul(vload(g + x), c_luma_g)),
+                        vadd(vmul(vload(b + x), c_luma_b), vset(128)));
+        vstore(y + x, vsrl<8>(v));
+      }
+
+      for (; x < width; ++x)
+        y[x] = (uint8_t)luma(r[x], g[x], b[x]);
+    }
+
+    //! Convert two rows of planar RGB to a row of each chroma plane.
+    static void
+    rowChroma(const uint8_t* const* r, const uint8_t* const* g, const uint8_t* const* b,
+              int width, uint8_t* cb, uint8_t* cr)
+    {
+      int x = 0;
+      for (; x + 16 <= width; x += 16)
+      {
+        Vector round = vset(2);
+        Vector vr = vsrl<2>(vadd(vadd(vloadPairs(r[0] + x), vloadPairs(r[1] + x)), round));
+        Vector vg = vsrl<2>(vadd(vadd(vloadPairs(g[0] + x), vloadPairs(g[1] + x)), round));
+        Vector vb = vsrl<2>(vadd(vadd(vloadPairs(b[0] + x), vloadPairs(b[1] + x)), round));
+        Vector vy = vsrl<8>(vadd(vadd(vmul(vr, c_luma_r), vmul(vg, c_luma_g)),
+                                 vadd(vmul(vb, c_luma_b), vset(128))));
+        Vector bias = vset(c_chroma_bias);
+        vstore(cb + x / 2, vsrl<7>(vadd(vmul(vsub(vb, vy), c_chroma_b), bias)));
+        vstore(cr + x / 2, vsrl<7>(vadd(vmul(vsub(vr, vy), c_chroma_r), bias)));
+      }
+
+      for (; x < width; x += 2)
+      {
+        int vr = (r[0][x] + r[0][x + 1] + r[1][x] + r[1][x + 1] + 2) >> 2;
+        int vg = (g[0][x] + g[0][x + 1] + g[1][x] + g[1][x + 1] + 2) >> 2;
+        int vb = (b[0][x] + b[0][x + 1] + b[1][x] + b[1][x + 1] + 2) >> 2;
+        int vy = luma(vr, vg, vb);
+        cb[x / 2] = chroma(vb, vy, c_chroma_b);
+        cr[x / 2] = chroma(vr, vy, c_chroma_r);
+      }
+    }
+#endif
+
+    BayerDecoder::BayerDecoder(Tile tile, Method method):
+      m_accelerate(isAccelerationAvailable())
     {
       m_blue_line = (tile == TILE_BGGR || tile == TILE_GBRG) ? -1 : 1;
       m_start_with_green = (tile == TILE_GBRG || tile == TILE_GRBG);
@@ -48,6 +402,40 @@ namespace DUNE
     BayerDecoder::setMethod(Method method)
     {
       switch (method)
+      {
+        case METHOD_NEAREST:
+        case METHOD_HQLINEAR:
+          m_method = method;
+          break;
+        default:
+          m_method = METHOD_BILINEAR;
+          break;
+      }
+
+      updateDecoders();
+    }
+
+    void
+    BayerDecoder::setAcceleration(bool enabled)
+    {
+      m_accelerate = enabled && isAccelerationAvailable();
+      updateDecoders();
+    }
+
+    bool
+    BayerDecoder::isAccelerationAvailable(void)
+    {
+#if defined(DUNE_MEDIA_BAYER_SIMD)
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    void
+    BayerDecoder::updateDecoders(void)
+    {
+      switch (m_method)
       {
         case METHOD_NEAREST:
           m_decoder = &BayerDecoder::decodeNearest;
@@ -59,7 +447,132 @@ namespace DUNE
           m_decoder = &BayerDecoder::decodeBilinear;
           break;
       }
+
+      m_yuv_decoder = &BayerDecoder::decodeReferenceYUV420;
+
+#if defined(DUNE_MEDIA_BAYER_SIMD)
+      if (m_accelerate && m_method != METHOD_NEAREST)
+      {
+        m_decoder = &BayerDecoder::decodeVectorRGB24;
+        m_yuv_decoder = &BayerDecoder::decodeVectorYUV420;
+      }
+#endif
+    }
+
+    void
+    BayerDecoder::convertToYUV420(const uint8_t* rgb, uint8_t* yuv, int width, int height)
+    {
+      uint8_t* y = yuv;
+      uint8_t* cb = yuv + width * height;
+      uint8_t* cr = cb + (width / 2) * (height / 2);
+
+      for (int i = 0; i < width * height; ++i)
+        y[i] = (uint8_t)luma(rgb[3 * i], rgb[3 * i + 1], rgb[3 * i + 2]);
+
+      const int step = width * 3;
+      for (int j = 0; j < height; j += 2)
+      {
+        const uint8_t* p = rgb + j * step;
+
+        for (int i = 0; i < width; i += 2, p += 6, ++cb, ++cr)
+        {
+          int r = (p[0] + p[3] + p[step] + p[step + 3] + 2) >> 2;
+          int g = (p[1] + p[4] + p[step + 1] + p[step + 4] + 2) >> 2;
+          int b = (p[2] + p[5] + p[step + 2] + p[step + 5] + 2) >> 2;
+          int l = luma(r, g, b);
+          *cb = chroma(b, l, c_chroma_b);
+          *cr = chroma(r, l, c_chroma_r);
+        }
+      }
+    }
+
+    void
+    BayerDecoder::decodeReferenceYUV420(const uint8_t* bayer, uint8_t* yuv, int width, int height) const
+    {
+      m_rgb.resize(width * height * 3);
+      ((*this).*(m_decoder))(bayer, &m_rgb[0], width, height);
+      convertToYUV420(&m_rgb[0], yuv, width, height);
+    }
+
+#if defined(DUNE_MEDIA_BAYER_SIMD)
+    void
+    BayerDecoder::decodeRow(const uint8_t* bayer, int width, int height, int y,
+                            uint8_t* r, uint8_t* g, uint8_t* b) const
+    {
+      int margin = (m_method == METHOD_HQLINEAR) ? 2 : 1;
+
+      if (y < margin || y >= height - margin)
+      {
+        std::memset(r, 0, width);
+        std::memset(g, 0, width);
+        std::memset(b, 0, width);
+        return;
+      }
+
+      // Pixel (x, y) is green if x + y is even and the mosaic starts
+      // with green, or if it is odd and the mosaic does not.
+      bool green_even = (m_start_with_green == ((y & 1) == 0));
+      // Color of the non-green pixels of this row.
+      bool blue_row = ((((y - 1) & 1) == 0) ? m_blue_line : -m_blue_line) > 0;
+      uint8_t* c = blue_row ? b : r;
+      uint8_t* o = blue_row ? r : b;
+
+      const uint8_t* rows[5];
+      for (int i = 0; i < 2 * margin + 1; ++i)
+        rows[i] = bayer + (y - margin + i) * width;
+
+      if (margin == 2)
+        rowHQLinear(rows, margin, width - margin, green_even, c, o, g);
+      else
+        rowBilinear(rows, margin, width - margin, green_even, c, o, g);
+
+      for (int i = 0; i < margin; ++i)
+      {
+        r[i] = g[i] = b[i] = 0;
+        r[width - 1 - i] = g[width - 1 - i] = b[width - 1 - i] = 0;
+      }
+    }
+
+    void
+    BayerDecoder::decodeVectorRGB24(const uint8_t* bayer, uint8_t* rgb, int width, int height) const
+    {
+      m_planes.resize(width * 3);
+      uint8_t* r = &m_planes[0];
+      uint8_t* g = r + width;
+      uint8_t* b = g + width;
+
+      for (int y = 0; y < height; ++y)
+      {
+        decodeRow(bayer, width, height, y, r, g, b);
+        rowInterleave(r, g, b, width, rgb + y * width * 3);
+      }
+    }
+
+    void
+    BayerDecoder::decodeVectorYUV420(const uint8_t* bayer, uint8_t* yuv, int width, int height) const
+    {
+      m_planes.resize(width * 6);
+      const uint8_t* r[2] = {&m_planes[0], &m_planes[width * 3]};
+      const uint8_t* g[2] = {r[0] + width, r[1] + width};
+      const uint8_t* b[2] = {g[0] + width, g[1] + width};
+
+      uint8_t* py = yuv;
+      uint8_t* cb = yuv + width * height;
+      uint8_t* cr = cb + (width / 2) * (height / 2);
+
+      for (int y = 0; y < height; y += 2)
+      {
+        for (int i = 0; i < 2; ++i)
+        {
+          uint8_t* pr = &m_planes[width * 3 * i];
+          decodeRow(bayer, width, height, y + i, pr, pr + width, pr + width * 2);
+          rowLuma(r[i], g[i], b[i], width, py + (y + i) * width);
+        }
+
+        rowChroma(r, g, b, width, cb + (y / 2) * (width / 2), cr + (y / 2) * (width / 2));
+      }
     }
+#endif
 
     void
     BayerDecoder::decodeNearest(const uint8_t* bayer, uint8_t* rgb, int sx, int sy) const
@@ -30,6 +30,9 @@
 #ifndef DUNE_MEDIA_BAYER_DECODER_HPP_INCLUDED_
 #define DUNE_MEDIA_BAYER_DECODER_HPP_INCLUDED_
 
+// ISO C++ 98 headers.
+#include <vector>
+
 // DUNE headers.
 #include <DUNE/Config.hpp>
 
@@ -38,6 +41,14 @@ namespace DUNE
   namespace Media
   {
     //! Bayer decoder (demosaicing).
+    //!
+    //! Bilinear and high-quality linear interpolation have vectorized
+    //! (SSE2) implementations that are selected at runtime when
+    //! available. They produce exactly the same output as the scalar
+    //! implementations, which remain as reference.
+    //!
+    //! Decoders keep scratch buffers between calls, hence an instance
+    //! must not be used by several threads at the same time.
     class BayerDecoder
     {
     public:
@@ -75,6 +86,18 @@ namespace DUNE
       void
       setMethod(Method method);
 
+      //! Enable or disable the vectorized implementations. They are
+      //! enabled by default if available.
+      //! @param[in] enabled true to use vectorized implementations,
+      //! false to use the scalar reference implementations.
+      void
+      setAcceleration(bool enabled);
+
+      //! Check if vectorized implementations are available.
+      //! @return true if available, false otherwise.
+      static bool
+      isAccelerationAvailable(void);
+
       //! Convert Bayer mosaic to RGB24.
       //! @param[in] bayer bayer mosaic.
       //! @param[out] rgb RGB24 image.
@@ -86,11 +109,46 @@ namespace DUNE
         ((*this).*(m_decoder))(bayer, rgb, width, height);
       }
 
+      //! Convert Bayer mosaic to planar YUV 4:2:0 (I420) with JPEG
+      //! (full range) coefficients. The luma plane is followed by
+      //! the Cb and Cr planes, each with a quarter of the
+      //! samples. The result is the same as decoding to RGB24 and
+      //! calling convertToYUV420(), but no intermediate RGB24 image
+      //! is created.
+      //! @param[in] bayer bayer mosaic.
+      //! @param[out] yuv YUV420 image (width * height * 3 / 2 bytes).
+      //! @param[in] width width of bayer mosaic (must be even).
+      //! @param[in] height height of bayer mosaic (must be even).
+      void
+      decodeToYUV420(const uint8_t* bayer, uint8_t* yuv, int width, int height) const
+      {
+        ((*this).*(m_yuv_decoder))(bayer, yuv, width, height);
+      }
+
+      //! Convert RGB24 to planar YUV 4:2:0 (I420). Chroma samples
+      //! are computed from the mean of each 2x2 block.
+      //! @param[in] rgb RGB24 image.
+      //! @param[out] yuv YUV420 image (width * height * 3 / 2 bytes).
+      //! @param[in] width image width (must be even).
+      //! @param[in] height image height (must be even).
+      static void
+      convertToYUV420(const uint8_t* rgb, uint8_t* yuv, int width, int height);
+
     private:
       //! Type of decoder functions.
       typedef void (BayerDecoder::*Decoder)(const uint8_t*, uint8_t*, int, int) const;
-      //! Pointer to decoder.
+      //! Pointer to RGB24 decoder.
       Decoder m_decoder;
+      //! Pointer to YUV420 decoder.
+      Decoder m_yuv_decoder;
+      //! Decoding method.
+      Method m_method;
+      //! True to use vectorized implementations.
+      bool m_accelerate;
+      //! Intermediate RGB24 image of YUV420 reference decoding.
+      mutable std::vector<uint8_t> m_rgb;
+      //! Color planes of the rows being decoded.
+      mutable std::vector<uint8_t> m_planes;
       //! True if tile starts with a green pixel.
       bool m_start_with_green;
       int m_blue_line;
@@ -120,6 +178,47 @@ namespace DUNE
       void
       decodeHQLinear(const uint8_t* bayer, uint8_t* rgb, int width, int height) const;
 
+      //! Convert Bayer mosaic to YUV420 by decoding to RGB24 first.
+      //! @param[in] bayer bayer mosaic.
+      //! @param[out] yuv YUV420 image.
+      //! @param[in] width width of bayer mosaic.
+      //! @param[in] height height of bayer mosaic.
+      void
+      decodeReferenceYUV420(const uint8_t* bayer, uint8_t* yuv, int width, int height) const;
+
+      //! Convert Bayer mosaic to RGB24 using vectorized row kernels.
+      //! @param[in] bayer bayer mosaic.
+      //! @param[out] rgb RGB24 image.
+      //! @param[in] width width of bayer mosaic.
+      //! @param[in] height height of bayer mosaic.
+      void
+      decodeVectorRGB24(const uint8_t* bayer, uint8_t* rgb, int width, int height) const;
+
+      //! Convert Bayer mosaic to YUV420 using vectorized row kernels.
+      //! @param[in] bayer bayer mosaic.
+      //! @param[out] yuv YUV420 image.
+      //! @param[in] width width of bayer mosaic.
+      //! @param[in] height height of bayer mosaic.
+      void
+      decodeVectorYUV420(const uint8_t* bayer, uint8_t* yuv, int width, int height) const;
+
+      //! Decode one row of the Bayer mosaic to planar R, G and B
+      //! rows. Border pixels are set to zero.
+      //! @param[in] bayer bayer mosaic.
+      //! @param[in] width width of bayer mosaic.
+      //! @param[in] height height of bayer mosaic.
+      //! @param[in] y row index.
+      //! @param[out] r red row.
+      //! @param[out] g green row.
+      //! @param[out] b blue row.
+      void
+      decodeRow(const uint8_t* bayer, int width, int height, int y,
+                uint8_t* r, uint8_t* g, uint8_t* b) const;
+
+      //! Select decoder functions.
+      void
+      updateDecoders(void);
+
       //! Clear image borders.
       //! @param[in] rgb RGB24 image.
       //! @param[in] width image width.
@@ -0,0 +1,373 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// DUNE headers.
+#include <DUNE/Media/FramePipeline.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/Delay.hpp>
+
+namespace DUNE
+{
+  namespace Media
+  {
+    using Concurrency::BoundedQueue;
+    using Concurrency::ScopedMutex;
+
+    //! Maximum amount of time a worker waits before checking if it
+    //! should stop.
+    static const double c_wait_timeout = 0.1;
+
+    //! Stage, its queue, workers and counters.
+    struct FramePipeline::StageSlot
+    {
+      //! Stage name.
+      std::string name;
+      //! Stage object.
+      Stage* stage;
+      //! Number of workers.
+      unsigned workers;
+      //! Input queue.
+      BoundedQueue<Frame*>* queue;
+      //! Worker threads.
+      std::vector<Worker*> threads;
+      //! Lock for counters.
+      Concurrency::Mutex lock;
+      //! Frames processed.
+      unsigned long frames;
+      //! Frames dropped.
+      unsigned long drops;
+      //! Accumulated latency.
+      double latency_sum;
+      //! Maximum latency.
+      double latency_max;
+      //! Accumulated processing time.
+      double processing_sum;
+
+      StageSlot(const std::string& n, Stage* s, unsigned w, unsigned capacity):
+        name(n),
+        stage(s),
+        workers(w),
+        queue(new BoundedQueue<Frame*>(capacity))
+      {
+        reset();
+      }
+
+      ~StageSlot(void)
+      {
+        delete queue;
+        delete stage;
+      }
+
+      void
+      reset(void)
+      {
+        frames = 0;
+        drops = 0;
+        latency_sum = 0;
+        latency_max = 0;
+        processing_sum = 0;
+      }
+    };
+
+    //! Worker thread of a stage.
+    class FramePipeline::Worker: public Concurrency::Thread
+    {
+    public:
+      Worker(FramePipeline& pipeline, unsigned stage, unsigned index):
+        m_pipeline(pipeline),
+        m_stage(stage),
+        m_index(index)
+      { }
+
+    private:
+      //! Pipeline.
+      FramePipeline& m_pipeline;
+      //! Stage index.
+      unsigned m_stage;
+      //! Worker index within the stage.
+      unsigned m_index;
+
+      void
+      run(void)
+      {
+        BoundedQueue<Frame*>* queue = m_pipeline.m_stages[m_stage]->queue;
+
+        while (!isStopping())
+        {
+          if (!m_pipeline.step(m_stage, m_index, this))
+            queue->waitForItems(c_wait_timeout);
+        }
+      }
+    };
+
+    FramePipeline::FramePipeline(unsigned frames, unsigned capacity):
+      m_free(frames),
+      m_capacity(capacity),
+      m_running(false)
+    {
+      for (unsigned i = 0; i < frames; ++i)
+      {
+        m_frames.push_back(new Frame);
+        m_free.push(m_frames.back());
+      }
+    }
+
+    FramePipeline::~FramePipeline(void)
+    {
+      stop();
+
+      for (unsigned i = 0; i < m_stages.size(); ++i)
+        delete m_stages[i];
+
+      for (unsigned i = 0; i < m_frames.size(); ++i)
+        delete m_frames[i];
+    }
+
+    void
+    FramePipeline::addStage(const std::string& name, Stage* stage, unsigned workers)
+    {
+      if (workers == 0)
+        workers = 1;
+
+      m_stages.push_back(new StageSlot(name, stage, workers, m_capacity));
+    }
+
+    void
+    FramePipeline::start(void)
+    {
+      if (m_running)
+        return;
+
+      for (unsigned i = 0; i < m_stages.size(); ++i)
+      {
+        for (unsigned j = 0; j < m_stages[i]->workers; ++j)
+        {
+          Worker* worker = new Worker(*this, i, j);
+          m_stages[i]->threads.push_back(worker);
+          worker->start();
+        }
+      }
+
+      m_running = true;
+    }
+
+    void
+    FramePipeline::stop(void)
+    {
+      if (!m_running)
+        return;
+
+      for (unsigned i = 0; i < m_stages.size(); ++i)
+      {
+        for (unsigned j = 0; j < m_stages[i]->threads.size(); ++j)
+          m_stages[i]->threads[j]->stop();
+      }
+
+      for (unsigned i = 0; i < m_stages.size(); ++i)
+      {
+        for (unsigned j = 0; j < m_stages[i]->threads.size(); ++j)
+        {
+          m_stages[i]->threads[j]->join();
+          delete m_stages[i]->threads[j];
+        }
+
+        m_stages[i]->threads.clear();
+      }
+
+      drain();
+      m_running = false;
+    }
+
+    FramePipeline::Frame*
+    FramePipeline::acquire(double timeout)
+    {
+      Frame* frame = NULL;
+      if (m_free.pop(frame))
+        return frame;
+
+      if (timeout != 0 && m_free.waitForItems(timeout) && m_free.pop(frame))
+        return frame;
+
+      // The pool is empty because the pipeline is full.
+      if (!m_stages.empty())
+      {
+        ScopedMutex l(m_stages[0]->lock);
+        ++m_stages[0]->drops;
+      }
+
+      return NULL;
+    }
+
+    void
+    FramePipeline::release(Frame* frame)
+    {
+      m_free.push(frame);
+    }
+
+    bool
+    FramePipeline::submit(Frame* frame)
+    {
+      if (m_stages.empty())
+      {
+        release(frame);
+        return false;
+      }
+
+      StageSlot* slot = m_stages[0];
+      frame->m_entry = Time::Clock::get();
+      if (slot->queue->push(frame))
+        return true;
+
+      {
+        ScopedMutex l(slot->lock);
+        ++slot->drops;
+      }
+
+      release(frame);
+      return false;
+    }
+
+    bool
+    FramePipeline::flush(double timeout)
+    {
+      double deadline = Time::Clock::get() + timeout;
+
+      while (m_free.size() < m_frames.size())
+      {
+        if (Time::Clock::get() >= deadline)
+          return false;
+
+        Time::Delay::wait(0.001);
+      }
+
+      return true;
+    }
+
+    void
+    FramePipeline::getStatistics(std::vector<Statistics>& stats)
+    {
+      stats.resize(m_stages.size());
+
+      for (unsigned i = 0; i < m_stages.size(); ++i)
+      {
+        StageSlot* slot = m_stages[i];
+        Statistics& s = stats[i];
+        ScopedMutex l(slot->lock);
+
+        s.name = slot->name;
+        s.workers = slot->workers;
+        s.queued = slot->queue->size();
+        s.frames = slot->frames;
+        s.drops = slot->drops;
+        s.latency_max = slot->latency_max;
+        s.latency_mean = 0;
+        s.processing_mean = 0;
+
+        if (slot->frames > 0)
+        {
+          s.latency_mean = slot->latency_sum / slot->frames;
+          s.processing_mean = slot->processing_sum / slot->frames;
+        }
+      }
+    }
+
+    void
+    FramePipeline::resetStatistics(void)
+    {
+      for (unsigned i = 0; i < m_stages.size(); ++i)
+      {
+        ScopedMutex l(m_stages[i]->lock);
+        m_stages[i]->reset();
+      }
+    }
+
+    bool
+    FramePipeline::step(unsigned index, unsigned worker, Worker* thread)
+    {
+      StageSlot* slot = m_stages[index];
+
+      Frame* frame = NULL;
+      if (!slot->queue->pop(frame))
+        return false;
+
+      double start = Time::Clock::get();
+      bool pass = slot->stage->process(*frame, worker);
+      double end = Time::Clock::get();
+      double latency = end - frame->m_entry;
+
+      {
+        ScopedMutex l(slot->lock);
+        ++slot->frames;
+        slot->latency_sum += latency;
+        slot->processing_sum += end - start;
+        if (latency > slot->latency_max)
+          slot->latency_max = latency;
+      }
+
+      if (pass && (index + 1 < m_stages.size()))
+        forward(index + 1, frame, thread);
+      else
+        release(frame);
+
+      return true;
+    }
+
+    void
+    FramePipeline::forward(unsigned index, Frame* frame, Worker* thread)
+    {
+      BoundedQueue<Frame*>* queue = m_stages[index]->queue;
+      frame->m_entry = Time::Clock::get();
+
+      while (!queue->push(frame))
+      {
+        if (thread->isStopping())
+        {
+          release(frame);
+          return;
+        }
+
+        queue->waitForSpace(c_wait_timeout);
+      }
+    }
+
+    void
+    FramePipeline::drain(void)
+    {
+      for (unsigned i = 0; i < m_stages.size(); ++i)
+      {
+        Frame* frame = NULL;
+        while (m_stages[i]->queue->pop(frame))
+          release(frame);
+      }
+    }
+  }
+}
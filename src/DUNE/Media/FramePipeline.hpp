@@ -0,0 +1,244 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+#ifndef DUNE_MEDIA_FRAME_PIPELINE_HPP_INCLUDED_
+#define DUNE_MEDIA_FRAME_PIPELINE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/BoundedQueue.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+
+namespace DUNE
+{
+  namespace Media
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM FramePipeline;
+
+    //! Multi-stage frame processing pipeline. Frames are taken from
+    //! a fixed pool, handed to the first stage with submit() and
+    //! then flow through each stage in the order they were added.
+    //! Every stage has a bounded input queue and one or more worker
+    //! threads, so that a slow stage (e.g., JPEG encoding) can be
+    //! spread over several cores while capture keeps going.
+    //!
+    //! Frames are only dropped when entering the pipeline: if the
+    //! pool is empty acquire() fails, and if the first stage has no
+    //! room submit() fails immediately. Both are counted as drops of
+    //! the first stage. Between
+    //! stages workers block until there is room in the next queue,
+    //! which throttles the producer through the frame pool.
+    //!
+    //! Stages must be added before start() and are deleted by the
+    //! pipeline.
+    class FramePipeline
+    {
+    public:
+      //! Frame buffer. Buffers keep their capacity when the frame
+      //! returns to the pool, so memory is only allocated while the
+      //! pipeline warms up.
+      struct Frame
+      {
+        //! Capture time.
+        double timestamp;
+        //! Sequence number.
+        unsigned sequence;
+        //! Label assigned by the producer (e.g., output file name).
+        std::string label;
+        //! Raw data as captured.
+        std::vector<uint8_t> raw;
+        //! Decoded image.
+        std::vector<uint8_t> image;
+        //! Encoded image.
+        std::vector<uint8_t> encoded;
+
+        Frame(void):
+          timestamp(0),
+          sequence(0),
+          m_entry(0)
+        { }
+
+      private:
+        //! Time at which the frame entered the current stage queue.
+        double m_entry;
+
+        friend class FramePipeline;
+      };
+
+      //! Processing stage.
+      class Stage
+      {
+      public:
+        virtual
+        ~Stage(void)
+        { }
+
+        //! Process a frame. When the stage has more than one worker
+        //! this function is called concurrently.
+        //! @param[in] frame frame.
+        //! @param[in] worker index of the calling worker, in the
+        //! range [0, workers).
+        //! @return true to pass the frame to the next stage, false
+        //! to return it to the pool.
+        virtual bool
+        process(Frame& frame, unsigned worker) = 0;
+      };
+
+      //! Stage statistics.
+      struct Statistics
+      {
+        //! Stage name.
+        std::string name;
+        //! Number of workers.
+        unsigned workers;
+        //! Frames waiting in the stage queue.
+        unsigned queued;
+        //! Frames processed.
+        unsigned long frames;
+        //! Frames dropped at the stage input.
+        unsigned long drops;
+        //! Mean latency (queue wait plus processing) in seconds.
+        double latency_mean;
+        //! Maximum latency in seconds.
+        double latency_max;
+        //! Mean processing time in seconds.
+        double processing_mean;
+      };
+
+      //! Constructor.
+      //! @param[in] frames number of frames in the pool.
+      //! @param[in] capacity capacity of each stage queue.
+      FramePipeline(unsigned frames, unsigned capacity);
+
+      //! Destructor. Stops the pipeline and deletes all stages.
+      ~FramePipeline(void);
+
+      //! Append a stage to the pipeline.
+      //! @param[in] name stage name.
+      //! @param[in] stage stage object, owned by the pipeline.
+      //! @param[in] workers number of worker threads.
+      void
+      addStage(const std::string& name, Stage* stage, unsigned workers = 1);
+
+      //! Start the worker threads of all stages.
+      void
+      start(void);
+
+      //! Stop and join all worker threads. Frames still in flight
+      //! are returned to the pool.
+      void
+      stop(void);
+
+      //! Take a frame from the pool. On failure a drop is counted in
+      //! the first stage.
+      //! @param[in] timeout maximum amount of time to wait for a free
+      //! frame in seconds, use a negative number to wait forever.
+      //! @return frame or NULL if none is available.
+      Frame*
+      acquire(double timeout = 0.0);
+
+      //! Return an unused frame to the pool.
+      //! @param[in] frame frame obtained with acquire().
+      void
+      release(Frame* frame);
+
+      //! Hand a frame to the first stage. On failure the frame is
+      //! counted as a drop and returned to the pool.
+      //! @param[in] frame frame obtained with acquire().
+      //! @return true if the frame was queued, false otherwise.
+      bool
+      submit(Frame* frame);
+
+      //! Wait until all frames are back in the pool.
+      //! @param[in] timeout timeout in seconds.
+      //! @return true if the pool is full, false otherwise.
+      bool
+      flush(double timeout);
+
+      //! Retrieve per-stage statistics.
+      //! @param[out] stats statistics, one entry per stage.
+      void
+      getStatistics(std::vector<Statistics>& stats);
+
+      //! Reset per-stage counters.
+      void
+      resetStatistics(void);
+
+    private:
+      class Worker;
+      struct StageSlot;
+
+      //! Pool of frames.
+      std::vector<Frame*> m_frames;
+      //! Free frames.
+      Concurrency::BoundedQueue<Frame*> m_free;
+      //! Stages.
+      std::vector<StageSlot*> m_stages;
+      //! Capacity of stage queues.
+      unsigned m_capacity;
+      //! True if worker threads are running.
+      bool m_running;
+
+      //! Process one frame in a stage and forward it.
+      //! @param[in] index stage index.
+      //! @param[in] worker worker index.
+      //! @param[in] thread calling thread.
+      //! @return true if a frame was processed, false if the stage
+      //! queue was empty.
+      bool
+      step(unsigned index, unsigned worker, Worker* thread);
+
+      //! Move a frame to the input queue of a stage.
+      //! @param[in] index stage index.
+      //! @param[in] frame frame.
+      //! @param[in] thread calling thread, used to abort waiting.
+      void
+      forward(unsigned index, Frame* frame, Worker* thread);
+
+      //! Return frames in stage queues to the pool.
+      void
+      drain(void);
+
+      //! Non - copyable.
+      FramePipeline(const FramePipeline&);
+
+      //! Non - assignable.
+      FramePipeline&
+      operator=(const FramePipeline&);
+    };
+  }
+}
+
+#endif
@@ -31,6 +31,7 @@
 #include <DUNE/Media/JPEGCompressor.hpp>
 
 // ISO C++ 98 headers.
+#include <algorithm>
 #include <cstdlib>
 #include <cstdio>
 #include <cstring>
@@ -84,7 +85,10 @@ namespace DUNE
 {
   namespace Media
   {
-    JPEGCompressor::JPEGCompressor(void)
+    JPEGCompressor::JPEGCompressor(void):
+      m_planar(false),
+      m_rows(NULL),
+      m_rows_size(0)
     {
       // Initialize destination manager.
       m_mgr = new DestinationManager;
@@ -113,6 +117,7 @@ namespace DUNE
       delete m_jcinfo;
       delete m_jerror;
       std::free(m_mgr->bfr);
+      std::free(m_rows);
       delete m_mgr;
     }
 
@@ -134,6 +139,8 @@ namespace DUNE
     JPEGCompressor&
     JPEGCompressor::setInputColorSpace(ColorSpace cspace)
     {
+      m_planar = (cspace == CS_YUV420);
+
       switch (cspace)
       {
         case CS_GRAYSCALE:
@@ -152,6 +159,7 @@ namespace DUNE
           break;
 
         case CS_YUV:
+        case CS_YUV420:
           m_jcinfo->in_color_space = JCS_YCbCr;
           m_jcinfo->input_components = 3;
           break;
@@ -178,6 +186,7 @@ namespace DUNE
           break;
 
         case CS_YUV:
+        case CS_YUV420:
           jpeg_set_colorspace(m_jcinfo, JCS_YCbCr);
           break;
       }
@@ -189,6 +198,14 @@ namespace DUNE
     JPEGCompressor::compress(uint8_t* raw, uint8_t quality)
     {
       jpeg_set_quality(m_jcinfo, quality, TRUE);
+
+      if (m_planar)
+      {
+        compressPlanar(raw);
+        return true;
+      }
+
+      m_jcinfo->raw_data_in = FALSE;
       jpeg_start_compress(m_jcinfo, TRUE);
 
       JSAMPROW row_pointer[1];
@@ -203,6 +220,79 @@ namespace DUNE
       return true;
     }
 
+    void
+    JPEGCompressor::compressPlanar(uint8_t* raw)
+    {
+      // Planar data bypasses color conversion and downsampling.
+      jpeg_set_colorspace(m_jcinfo, JCS_YCbCr);
+      m_jcinfo->raw_data_in = TRUE;
+#if JPEG_LIB_VERSION >= 70
+      // Otherwise chroma is downsampled by DCT scaling, which
+      // expects full resolution input.
+      m_jcinfo->do_fancy_downsampling = FALSE;
+#endif
+      m_jcinfo->comp_info[0].h_samp_factor = 2;
+      m_jcinfo->comp_info[0].v_samp_factor = 2;
+      m_jcinfo->comp_info[1].h_samp_factor = 1;
+      m_jcinfo->comp_info[1].v_samp_factor = 1;
+      m_jcinfo->comp_info[2].h_samp_factor = 1;
+      m_jcinfo->comp_info[2].v_samp_factor = 1;
+      jpeg_start_compress(m_jcinfo, TRUE);
+
+      uint32_t width = m_jcinfo->image_width;
+      uint32_t height = m_jcinfo->image_height;
+      uint32_t cwidth = width / 2;
+      uint32_t cheight = height / 2;
+      uint8_t* planes[3] = {raw, raw + width * height, raw + width * height + cwidth * cheight};
+
+      // The encoder reads whole blocks, rows must be padded to a
+      // multiple of 16 luma samples.
+      uint32_t pwidth = (width + 15) & ~15u;
+      bool pad = (pwidth != width);
+      if (pad && m_rows_size < pwidth * 3 * DCTSIZE)
+      {
+        m_rows_size = pwidth * 3 * DCTSIZE;
+        m_rows = (uint8_t*)std::realloc(m_rows, m_rows_size);
+      }
+
+      JSAMPROW rows[3][2 * DCTSIZE];
+      JSAMPARRAY image[3] = {rows[0], rows[1], rows[2]};
+
+      for (uint32_t line = 0; line < height; line += 2 * DCTSIZE)
+      {
+        for (unsigned c = 0; c < 3; ++c)
+        {
+          uint32_t count = (c == 0) ? 2 * DCTSIZE : DCTSIZE;
+          uint32_t first = (c == 0) ? line : line / 2;
+          uint32_t cols = (c == 0) ? width : cwidth;
+          uint32_t lines = (c == 0) ? height : cheight;
+          uint32_t stride = (c == 0) ? pwidth : pwidth / 2;
+
+          for (uint32_t i = 0; i < count; ++i)
+          {
+            // Rows past the end of the image repeat the last row.
+            uint8_t* src = planes[c] + std::min(first + i, lines - 1) * cols;
+            if (!pad)
+            {
+              rows[c][i] = src;
+              continue;
+            }
+
+            uint8_t* dst = m_rows + i * stride;
+            if (c > 0)
+              dst += 2 * DCTSIZE * pwidth + (c - 1) * DCTSIZE * stride;
+            std::memcpy(dst, src, cols);
+            std::memset(dst + cols, src[cols - 1], stride - cols);
+            rows[c][i] = dst;
+          }
+        }
+
+        jpeg_write_raw_data(m_jcinfo, image, 2 * DCTSIZE);
+      }
+
+      jpeg_finish_compress(m_jcinfo);
+    }
+
     const uint8_t*
     JPEGCompressor::imageData(void) const
     {
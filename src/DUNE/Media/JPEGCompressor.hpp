@@ -58,7 +58,10 @@ namespace DUNE
         //! Cyan, Magenta, Yellow and Black.
         CS_CMYK,
         //! YCbCr
-        CS_YUV
+        CS_YUV,
+        //! Planar YCbCr 4:2:0 (I420), input only. Image width and
+        //! height must be even.
+        CS_YUV420
       };
 
       //! Construct a JPEGCompressor object.
@@ -116,6 +119,12 @@ namespace DUNE
       jpeg_compress_struct* m_jcinfo;
       //! JPEG compression error.
       jpeg_error_mgr* m_jerror;
+      //! True if input is planar YCbCr 4:2:0.
+      bool m_planar;
+      //! Padded rows of planar input.
+      uint8_t* m_rows;
+      //! Size of padded rows buffer.
+      uint32_t m_rows_size;
       //! Default buffer size.
       const static uint32_t c_default_bfr_size = 102400;
       //! Default image width.
@@ -128,6 +137,11 @@ namespace DUNE
       const static ColorSpace c_default_icspace = CS_RGB;
       //! Default output color space.
       const static ColorSpace c_default_ocspace = CS_RGB;
+
+      //! Compress planar YCbCr 4:2:0 data.
+      //! @param raw raw image.
+      void
+      compressPlanar(uint8_t* raw);
     };
   }
 }
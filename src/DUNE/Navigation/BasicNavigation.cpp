@@ -217,6 +217,15 @@ namespace DUNE
       .defaultValue("1.0")
       .description("Exponential moving average filter gain used in altitude");
 
+      param("Kalman Filter - Correction Method", m_kal_correction)
+      .defaultValue("Batch")
+      .values("Batch, Sequential")
+      .description("Correct all outputs at once or one at a time, skipping inactive outputs");
+
+      param("Kalman Filter - Joseph Form", m_kal_joseph)
+      .defaultValue("false")
+      .description("Use the Joseph form of the covariance update");
+
       // Do not use the declination offset when simulating.
       m_use_declination = !m_ctx.profiles.isSelected("Simulation");
       m_declination_defined = false;
@@ -268,6 +277,16 @@ namespace DUNE
       m_time_without_euler.setTop(m_without_euler_timeout);
       m_dvl_sanity_timer.setTop(m_dvl_sanity_timeout);
 
+      if (m_kal_correction == "Sequential")
+        m_kal.setCorrectionMethod(KalmanFilter::CM_SEQUENTIAL);
+      else
+        m_kal.setCorrectionMethod(KalmanFilter::CM_BATCH);
+
+      if (m_kal_joseph)
+        m_kal.setCovarianceForm(KalmanFilter::CF_JOSEPH);
+      else
+        m_kal.setCovarianceForm(KalmanFilter::CF_STANDARD);
+
       // Distance DVL to vehicle Center of Gravity is 0 in Simulation.
       if (m_ctx.profiles.isSelected("Simulation"))
       {
@@ -667,6 +667,10 @@ namespace DUNE
       bool m_alt_attitude_compensation;
       //! Altitude Exponential Moving Average filter gain.
       float m_alt_ema_gain;
+      //! Kalman filter correction method.
+      std::string m_kal_correction;
+      //! Use Joseph form of the Kalman filter covariance update.
+      bool m_kal_joseph;
       //! Altitude data sanity;
       bool m_alt_sanity;
       //! Maximum horizontal dilution of precision.
@@ -0,0 +1,477 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: José Braga                                                       *
+//***************************************************************************
+
+#ifndef DUNE_NAVIGATION_FIXED_KALMAN_FILTER_HPP_INCLUDED_
+#define DUNE_NAVIGATION_FIXED_KALMAN_FILTER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/I18N.hpp>
+#include <DUNE/Math/FixedMatrix.hpp>
+
+namespace DUNE
+{
+  namespace Navigation
+  {
+    //! Kalman filter with the number of states and outputs known at
+    //! compile time. It implements the same model as KalmanFilter but
+    //! keeps all matrices, including the temporaries of each step,
+    //! on the stack, so predict() and update() never allocate memory.
+    //! @tparam N number of states.
+    //! @tparam M number of outputs.
+    template <unsigned N, unsigned M>
+    class FixedKalmanFilter
+    {
+    public:
+      //! State vector type.
+      typedef Math::FixedMatrix<N, 1> StateVector;
+      //! Output vector type.
+      typedef Math::FixedMatrix<M, 1> OutputVector;
+      //! State matrix type.
+      typedef Math::FixedMatrix<N, N> StateMatrix;
+      //! Observation matrix type.
+      typedef Math::FixedMatrix<M, N> ObservationMatrix;
+      //! Output matrix type.
+      typedef Math::FixedMatrix<M, M> OutputMatrix;
+
+      //! Constructor. Transition matrices are initialized to the
+      //! identity and all other matrices to zero.
+      FixedKalmanFilter(void)
+      {
+        reset();
+      }
+
+      //! Reset all matrices.
+      void
+      reset(void)
+      {
+        m_x.fill(0.0);
+        m_y.fill(0.0);
+        m_ax.identity();
+        m_ap.identity();
+        m_c.fill(0.0);
+        m_p.fill(0.0);
+        m_q.fill(0.0);
+        m_r.fill(0.0);
+        m_innov.fill(0.0);
+      }
+
+      //! Set initial conditions (state and covariance matrix).
+      //! @param x0 state.
+      //! @param P0 covariance.
+      void
+      initialize(const StateVector& x0, const StateMatrix& P0)
+      {
+        m_x = x0;
+        m_p = P0;
+      }
+
+      //! Keep the state covariance matrix symmetric.
+      void
+      normalize(void)
+      {
+        m_p = 0.5 * (m_p + transpose(m_p));
+      }
+
+      //! Predict the state at the next timestep subject to control input.
+      //! @param b control input matrix.
+      //! @param u input vector.
+      template <unsigned U>
+      void
+      predict(const Math::FixedMatrix<N, U>& b, const Math::FixedMatrix<U, 1>& u)
+      {
+        m_x = m_ax * m_x + b * u;
+        m_p = m_ap * m_p * transpose(m_ap) + m_q;
+      }
+
+      //! Predict the state at the next timestep assuming no input.
+      void
+      predict(void)
+      {
+        m_x = m_ax * m_x;
+        m_p = m_ap * m_p * transpose(m_ap) + m_q;
+      }
+
+      //! Kalman Filter update function.
+      //! @param threshold threshold to reject large state innovations.
+      //! @return 0 if update is successful, -1 otherwise.
+      int
+      update(float threshold)
+      {
+        // Measurement prediction covariance.
+        ObservationMatrix CP = m_c * m_p;
+        OutputMatrix S = CP * transpose(m_c) + m_r;
+        OutputMatrix S_1;
+
+        // Inverse of the measurement prediction covariance.
+        try
+        {
+          S_1 = Math::inverse(S);
+        }
+        catch (...)
+        {
+          throw std::runtime_error(DTR("matrix inversion error"));
+        }
+
+        // Check if innovation is above a threshold value.
+        // Set threshold to 0 to accept everything.
+        if (threshold != 0)
+        {
+          double level = (transpose(m_innov) * S_1 * m_innov)(0);
+          if (level >= threshold)
+            return -1;
+        }
+
+        // Kalman Gain.
+        Math::FixedMatrix<N, M> K = m_p * transpose(m_c) * S_1;
+
+        // State update.
+        m_x += K * m_innov;
+
+        // State Covariance update.
+        m_p -= K * CP;
+
+        return 0;
+      }
+
+      //! Get filter state value.
+      //! @param pos matrix index.
+      //! @return state matrix value.
+      double
+      getState(unsigned pos) const
+      {
+        checkIndex(pos, N);
+        return m_x(pos);
+      }
+
+      //! Get state vector.
+      //! @return state vector.
+      const StateVector&
+      getState(void) const
+      {
+        return m_x;
+      }
+
+      //! Set state matrix value.
+      //! @param pos matrix index.
+      //! @param value state matrix value.
+      void
+      setState(unsigned pos, double value)
+      {
+        checkIndex(pos, N);
+        m_x(pos) = value;
+      }
+
+      //! Reset state matrix.
+      void
+      resetState(void)
+      {
+        m_x.fill(0.0);
+      }
+
+      //! Get state transition matrix.
+      //! @return state transition matrix.
+      const StateMatrix&
+      getStateTransition(void) const
+      {
+        return m_ax;
+      }
+
+      //! Set state transition matrix.
+      //! @param a state transition matrix.
+      void
+      setStateTransition(const StateMatrix& a)
+      {
+        m_ax = a;
+      }
+
+      //! Get state covariance transition matrix.
+      //! @return state covariance transition matrix.
+      const StateMatrix&
+      getCovarianceTransition(void) const
+      {
+        return m_ap;
+      }
+
+      //! Set state covariance transition matrix.
+      //! @param a state covariance transition matrix.
+      void
+      setCovarianceTransition(const StateMatrix& a)
+      {
+        m_ap = a;
+      }
+
+      //! Set transition matrices.
+      //! @param a state transition matrix.
+      void
+      setTransitions(const StateMatrix& a)
+      {
+        m_ax = a;
+        m_ap = a;
+      }
+
+      //! Reset output matrices.
+      void
+      resetOutputs(void)
+      {
+        m_y.fill(0.0);
+        m_innov.fill(0.0);
+        m_c.fill(0.0);
+      }
+
+      //! Get output matrix value.
+      //! @param pos matrix index.
+      //! @return output matrix value.
+      double
+      getOutput(unsigned pos) const
+      {
+        checkIndex(pos, M);
+        return m_y(pos);
+      }
+
+      //! Set output matrix value.
+      //! @param pos matrix index.
+      //! @param value output matrix value.
+      void
+      setOutput(unsigned pos, double value)
+      {
+        checkIndex(pos, M);
+        m_y(pos) = value;
+      }
+
+      //! Get innovation matrix value.
+      //! @param pos matrix index.
+      //! @return innovation matrix value.
+      double
+      getInnovation(unsigned pos) const
+      {
+        checkIndex(pos, M);
+        return m_innov(pos);
+      }
+
+      //! Set innovation matrix value.
+      //! @param pos matrix index.
+      //! @param value innovation matrix value.
+      void
+      setInnovation(unsigned pos, double value)
+      {
+        checkIndex(pos, M);
+        m_innov(pos) = value;
+      }
+
+      //! Get output transition matrix.
+      //! @return output transition matrix.
+      const ObservationMatrix&
+      getObservation(void) const
+      {
+        return m_c;
+      }
+
+      //! Set observation model matrix value.
+      //! @param ln row index.
+      //! @param cl column index.
+      //! @param value output transition matrix value.
+      void
+      setObservation(unsigned ln, unsigned cl, double value)
+      {
+        checkIndex(ln, M);
+        checkIndex(cl, N);
+        m_c(ln, cl) = value;
+      }
+
+      //! Get covariance matrix value.
+      //! @param ln row index.
+      //! @param cl column index.
+      //! @return covariance matrix value.
+      double
+      getCovariance(unsigned ln, unsigned cl) const
+      {
+        checkIndex(ln, N);
+        checkIndex(cl, N);
+        return m_p(ln, cl);
+      }
+
+      //! Get covariance matrix value.
+      //! @param in row and column index.
+      //! @return covariance matrix value.
+      double
+      getCovariance(unsigned in) const
+      {
+        checkIndex(in, N);
+        return m_p(in, in);
+      }
+
+      //! Get state covariance matrix.
+      //! @return state covariance matrix.
+      const StateMatrix&
+      getCovariance(void) const
+      {
+        return m_p;
+      }
+
+      //! Set state covariance matrix value.
+      //! @param ln row index.
+      //! @param cl column index.
+      //! @param value state covariance matrix value.
+      void
+      setCovariance(unsigned ln, unsigned cl, double value)
+      {
+        checkIndex(ln, N);
+        checkIndex(cl, N);
+        m_p(ln, cl) = value;
+      }
+
+      //! Set state covariance matrix value.
+      //! @param in row and column index.
+      //! @param value state covariance matrix value.
+      void
+      setCovariance(unsigned in, double value)
+      {
+        checkIndex(in, N);
+        m_p(in, in) = value;
+      }
+
+      //! Set state covariance matrix value.
+      //! @param value state covariance matrix value.
+      void
+      setCovariance(double value)
+      {
+        for (unsigned i = 0; i < N; ++i)
+          m_p(i, i) = value;
+      }
+
+      //! Reset covariance values of one state.
+      //! @param in state index.
+      void
+      resetCovariance(unsigned in)
+      {
+        checkIndex(in, N);
+        for (unsigned i = 0; i < N; ++i)
+        {
+          m_p(i, in) = 0.0;
+          m_p(in, i) = 0.0;
+        }
+      }
+
+      //! Set process noise covariance matrix value.
+      //! @param ln row index.
+      //! @param cl column index.
+      //! @param value process noise covariance matrix value.
+      void
+      setProcessNoise(unsigned ln, unsigned cl, double value)
+      {
+        checkIndex(ln, N);
+        checkIndex(cl, N);
+        m_q(ln, cl) = value;
+      }
+
+      //! Set process noise covariance matrix value.
+      //! @param in row and column index.
+      //! @param value process noise covariance matrix value.
+      void
+      setProcessNoise(unsigned in, double value)
+      {
+        checkIndex(in, N);
+        m_q(in, in) = value;
+      }
+
+      //! Set process noise covariance matrix value.
+      //! @param value process noise covariance matrix value.
+      void
+      setProcessNoise(double value)
+      {
+        for (unsigned i = 0; i < N; ++i)
+          m_q(i, i) = value;
+      }
+
+      //! Set measurement noise covariance matrix value.
+      //! @param ln row index.
+      //! @param cl column index.
+      //! @param value measurement noise covariance matrix value.
+      void
+      setMeasurementNoise(unsigned ln, unsigned cl, double value)
+      {
+        checkIndex(ln, M);
+        checkIndex(cl, M);
+        m_r(ln, cl) = value;
+      }
+
+      //! Set measurement noise covariance matrix value.
+      //! @param in row and column index.
+      //! @param value measurement noise covariance matrix value.
+      void
+      setMeasurementNoise(unsigned in, double value)
+      {
+        checkIndex(in, M);
+        m_r(in, in) = value;
+      }
+
+      //! Set measurement noise covariance matrix value.
+      //! @param value measurement noise covariance matrix value.
+      void
+      setMeasurementNoise(double value)
+      {
+        for (unsigned i = 0; i < M; ++i)
+          m_r(i, i) = value;
+      }
+
+    private:
+      //! State vector.
+      StateVector m_x;
+      //! Output vector.
+      OutputVector m_y;
+      //! State transition matrix.
+      StateMatrix m_ax;
+      //! State covariance transition matrix.
+      StateMatrix m_ap;
+      //! Output transition matrix.
+      ObservationMatrix m_c;
+      //! State covariance matrix.
+      StateMatrix m_p;
+      //! Process noise covariance matrix
+      StateMatrix m_q;
+      //! Measurement noise covariance matrix
+      OutputMatrix m_r;
+      //! Innovation vector.
+      OutputVector m_innov;
+
+      static void
+      checkIndex(unsigned index, unsigned size)
+      {
+        if (index >= size)
+          throw std::runtime_error(DTR("invalid index"));
+      }
+    };
+  }
+}
+
+#endif
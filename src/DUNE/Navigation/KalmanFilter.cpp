@@ -35,7 +35,9 @@ namespace DUNE
 {
   namespace Navigation
   {
-    KalmanFilter::KalmanFilter(void)
+    KalmanFilter::KalmanFilter(void):
+      m_method(CM_BATCH),
+      m_form(CF_STANDARD)
     {
       m_state_count = 1;
       Math::Matrix I(1);
@@ -43,7 +45,9 @@ namespace DUNE
       m_x = m_y = m_ax = m_ap = m_c = m_p = m_q = m_r = m_innov = I;
     }
 
-    KalmanFilter::KalmanFilter(Math::Matrix& A, Math::Matrix& C, Math::Matrix& P, Math::Matrix& Q)
+    KalmanFilter::KalmanFilter(Math::Matrix& A, Math::Matrix& C, Math::Matrix& P, Math::Matrix& Q):
+      m_method(CM_BATCH),
+      m_form(CF_STANDARD)
     {
       m_ax = A;
       m_ap = A;
@@ -139,6 +143,29 @@ namespace DUNE
       if (m_r.rows() != m_r.columns() || m_r.rows() != m_innov.rows())
         throw std::runtime_error(DTR("invalid dimensions"));
 
+      if (m_method == CM_SEQUENTIAL)
+      {
+        // Sequential updates are only equivalent to the batch update
+        // if measurement noise is uncorrelated.
+        const Math::Matrix& r = m_r;
+        for (int i = 0; i < r.rows(); ++i)
+        {
+          for (int j = 0; j < r.columns(); ++j)
+          {
+            if (i != j && r(i, j) != 0.0)
+              return updateBatch(threshold);
+          }
+        }
+
+        return updateSequential(threshold);
+      }
+
+      return updateBatch(threshold);
+    }
+
+    int
+    KalmanFilter::updateBatch(float threshold)
+    {
       // Measurement prediction covariance.
       Math::Matrix S = (m_c * m_p * transpose(m_c)) + m_r;
       Math::Matrix S_1;
@@ -170,7 +197,134 @@ namespace DUNE
       m_x = m_x + K * m_innov;
 
       // State Covariance update.
-      m_p = m_p - K * m_c * m_p;
+      if (m_form == CF_JOSEPH)
+      {
+        Math::Matrix IKC = Math::Matrix(m_state_count) - K * m_c;
+        m_p = IKC * m_p * transpose(IKC) + K * m_r * transpose(K);
+      }
+      else
+      {
+        m_p = m_p - K * m_c * m_p;
+      }
+
+      return 0;
+    }
+
+    int
+    KalmanFilter::updateSequential(float threshold)
+    {
+      const Math::Matrix& c = m_c;
+      const Math::Matrix& r = m_r;
+      const Math::Matrix& innov = m_innov;
+      size_t n = m_state_count;
+      size_t m = m_innov.rows();
+
+      // Work on local copies so that nothing is committed if the
+      // innovation is rejected.
+      m_work.resize(n * n + 4 * n);
+      double* p = &m_work[0];
+      double* dx = p + n * n;
+      double* ph = dx + n;
+      double* k = ph + n;
+      double* h = k + n;
+
+      {
+        const Math::Matrix& cp = m_p;
+        for (size_t i = 0; i < n; ++i)
+        {
+          for (size_t j = 0; j < n; ++j)
+            p[i * n + j] = cp(i, j);
+          dx[i] = 0.0;
+        }
+      }
+
+      // Sum of normalized squared innovations, equal to the
+      // Mahalanobis distance of the batch update.
+      double level = 0.0;
+
+      for (size_t o = 0; o < m; ++o)
+      {
+        bool active = false;
+        for (size_t j = 0; j < n; ++j)
+        {
+          h[j] = c(o, j);
+          active = active || (h[j] != 0.0);
+        }
+
+        // Outputs with an empty observation row carry no information.
+        if (!active)
+          continue;
+
+        // Innovation given the corrections of previous outputs.
+        double nu = innov(o);
+        for (size_t j = 0; j < n; ++j)
+          nu -= h[j] * dx[j];
+
+        // ph = P * h', s = h * P * h' + r.
+        double s = r(o, o);
+        for (size_t i = 0; i < n; ++i)
+        {
+          ph[i] = 0.0;
+          for (size_t j = 0; j < n; ++j)
+            ph[i] += p[i * n + j] * h[j];
+        }
+
+        for (size_t j = 0; j < n; ++j)
+          s += h[j] * ph[j];
+
+        if (s <= 0.0)
+          throw std::runtime_error(DTR("matrix inversion error"));
+
+        level += nu * nu / s;
+
+        // Kalman Gain and state update.
+        for (size_t i = 0; i < n; ++i)
+        {
+          k[i] = ph[i] / s;
+          dx[i] += k[i] * nu;
+        }
+
+        // State Covariance update.
+        if (m_form == CF_JOSEPH)
+        {
+          // With a scalar output the Joseph form reduces to
+          // P - k * ph' - ph * k' + s * k * k', computed on the upper
+          // triangle and mirrored to keep P exactly symmetric.
+          for (size_t i = 0; i < n; ++i)
+          {
+            for (size_t j = i; j < n; ++j)
+            {
+              double v = p[i * n + j] - k[i] * ph[j] - ph[i] * k[j] + s * k[i] * k[j];
+              p[i * n + j] = v;
+              p[j * n + i] = v;
+            }
+          }
+        }
+        else
+        {
+          // P = P - k * (h * P), reusing ph to hold h * P.
+          for (size_t j = 0; j < n; ++j)
+          {
+            ph[j] = 0.0;
+            for (size_t i = 0; i < n; ++i)
+              ph[j] += h[i] * p[i * n + j];
+          }
+
+          for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j < n; ++j)
+              p[i * n + j] -= k[i] * ph[j];
+        }
+      }
+
+      // Check if innovation is above a threshold value.
+      // Set threshold to 0 to accept everything.
+      if (threshold != 0 && level >= threshold)
+        return -1;
+
+      for (size_t i = 0; i < n; ++i)
+        m_x(i) += dx[i];
+
+      m_p.fill(n, n, p);
 
       return 0;
     }
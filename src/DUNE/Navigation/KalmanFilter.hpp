@@ -46,6 +46,7 @@
 #include <stdexcept>
 #include <string>
 #include <cmath>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -61,6 +62,29 @@ namespace DUNE
     class KalmanFilter
     {
     public:
+      //! Correction methods.
+      enum CorrectionMethod
+      {
+        //! All outputs at once, inverting the innovation covariance.
+        CM_BATCH,
+        //! One output at a time as scalar updates, skipping outputs
+        //! with an empty observation row. Requires a diagonal
+        //! measurement noise covariance matrix, otherwise the batch
+        //! method is used. Skipped outputs do not count towards the
+        //! innovation threshold.
+        CM_SEQUENTIAL
+      };
+
+      //! Covariance update forms.
+      enum CovarianceForm
+      {
+        //! P = (I - K * C) * P.
+        CF_STANDARD,
+        //! Joseph form, P = (I - K * C) * P * (I - K * C)' + K * R * K',
+        //! which keeps P symmetric and positive semi-definite.
+        CF_JOSEPH
+      };
+
       //! Constructor.
       KalmanFilter(void);
 
@@ -109,6 +133,22 @@ namespace DUNE
       int
       update(float threshold);
 
+      //! Select the correction method used by update().
+      //! @param method correction method.
+      void
+      setCorrectionMethod(CorrectionMethod method)
+      {
+        m_method = method;
+      }
+
+      //! Select the covariance update form used by update().
+      //! @param form covariance update form.
+      void
+      setCovarianceForm(CovarianceForm form)
+      {
+        m_form = form;
+      }
+
       //! Get filter state value.
       //! @param pos matrix index.
       //! @return state matrix value.
@@ -361,6 +401,24 @@ namespace DUNE
       Math::Matrix m_r;
       //! Innovation vector.
       Math::Matrix m_innov;
+      //! Correction method.
+      CorrectionMethod m_method;
+      //! Covariance update form.
+      CovarianceForm m_form;
+      //! Work area of sequential updates.
+      std::vector<double> m_work;
+
+      //! Update all outputs at once.
+      //! @param threshold threshold to reject large state innovations.
+      //! @return 0 if update is successful, -1 otherwise.
+      int
+      updateBatch(float threshold);
+
+      //! Update one output at a time.
+      //! @param threshold threshold to reject large state innovations.
+      //! @return 0 if update is successful, -1 otherwise.
+      int
+      updateSequential(float threshold);
     };
   }
 }
@@ -103,6 +103,17 @@
 #  define ECONNRESET WSAECONNRESET
 #endif
 
+//! Test if the last socket operation failed because it would block.
+static inline bool
+wouldBlock(void)
+{
+#if defined(DUNE_OS_WINDOWS)
+  return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+  return errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+}
+
 static const unsigned c_block_size = 128 * 1024;
 
 static inline std::string
@@ -122,7 +133,8 @@ namespace DUNE
   namespace Network
   {
     TCPSocket::TCPSocket(bool create):
-      m_handle(INVALID_SOCKET)
+      m_handle(INVALID_SOCKET),
+      m_non_blocking(false)
     {
       if (create)
       {
@@ -225,6 +237,8 @@ namespace DUNE
       {
         if (errno == ECONNRESET)
           throw ConnectionClosed();
+        if (m_non_blocking && wouldBlock())
+          return 0;
         throw NetworkError(DTR("error receiving data"), getLastErrorMessage());
       }
 
@@ -246,6 +260,8 @@ namespace DUNE
       {
         if (errno == EPIPE)
           throw ConnectionClosed();
+        if (m_non_blocking && wouldBlock())
+          return 0;
         throw NetworkError(DTR("error sending data"), getLastErrorMessage());
       }
 
@@ -356,6 +372,26 @@ namespace DUNE
         throw NetworkError(DTR("unable to set send timeout"), getLastErrorMessage());
     }
 
+    void
+    TCPSocket::setNonBlocking(bool enabled)
+    {
+#if defined(DUNE_OS_WINDOWS)
+      u_long mode = enabled ? 1 : 0;
+      if (ioctlsocket(m_handle, FIONBIO, &mode) != 0)
+        throw NetworkError(DTR("unable to set non-blocking mode"), getLastErrorMessage());
+#else
+      int flags = fcntl(m_handle, F_GETFL, 0);
+      if (flags < 0)
+        throw NetworkError(DTR("unable to set non-blocking mode"), getLastErrorMessage());
+
+      flags = enabled ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
+      if (fcntl(m_handle, F_SETFL, flags) < 0)
+        throw NetworkError(DTR("unable to set non-blocking mode"), getLastErrorMessage());
+#endif
+
+      m_non_blocking = enabled;
+    }
+
     Address
     TCPSocket::getBoundAddress(void)
     {
@@ -103,6 +103,14 @@ namespace DUNE
       void
       setSendTimeout(double timeout);
 
+      //! Enable/disable non-blocking mode. In non-blocking mode read
+      //! and write operations that would block return 0 instead. In
+      //! blocking mode they throw NetworkError if they time out.
+      //! @param[in] enabled true to enable non-blocking mode, false to
+      //! disable.
+      void
+      setNonBlocking(bool enabled);
+
       Address
       getBoundAddress(void);
 
@@ -117,6 +125,8 @@ namespace DUNE
 #else
       int m_handle;
 #endif
+      //! True if the socket is in non-blocking mode.
+      bool m_non_blocking;
 
       IO::NativeHandle
       doGetNative(void) const;
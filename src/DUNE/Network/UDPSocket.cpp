@@ -28,7 +28,9 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <algorithm>
 #include <cerrno>
+#include <cstring>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -89,6 +91,9 @@
 #  define ENETUNREACH WSAENETUNREACH
 #endif
 
+//! Maximum number of datagrams per batched system call.
+static const unsigned c_batch_max = 64;
+
 namespace DUNE
 {
   namespace Network
@@ -232,6 +237,113 @@ namespace DUNE
       return rv;
     }
 
+    size_t
+    UDPSocket::write(const Datagram* dgrams, size_t count)
+    {
+      size_t sent = 0;
+
+#if defined(DUNE_SYS_HAS_SENDMMSG)
+      mmsghdr hdrs[c_batch_max];
+      iovec iovs[c_batch_max];
+      sockaddr_in sais[c_batch_max];
+
+      size_t i = 0;
+      while (i < count)
+      {
+        unsigned n = std::min(count - i, (size_t)c_batch_max);
+        std::memset(hdrs, 0, sizeof(mmsghdr) * n);
+
+        for (unsigned j = 0; j < n; ++j)
+        {
+          const Datagram& dgram = dgrams[i + j];
+          std::memset(&sais[j], 0, sizeof(sockaddr_in));
+          sais[j].sin_family = AF_INET;
+          sais[j].sin_port = Utils::ByteCopy::toBE(dgram.port);
+          sais[j].sin_addr.s_addr = dgram.addr.toInteger();
+          iovs[j].iov_base = dgram.data;
+          iovs[j].iov_len = dgram.size;
+          hdrs[j].msg_hdr.msg_name = &sais[j];
+          hdrs[j].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+          hdrs[j].msg_hdr.msg_iov = &iovs[j];
+          hdrs[j].msg_hdr.msg_iovlen = 1;
+        }
+
+        int rv = sendmmsg(m_handle, hdrs, n, 0);
+
+        if (rv == -1)
+        {
+          //! Retry when interrupted by a signal, skip the failed
+          //! datagram otherwise.
+          if (errno != EINTR)
+            ++i;
+          continue;
+        }
+
+        sent += rv;
+        i += rv;
+      }
+
+#else
+      for (size_t i = 0; i < count; ++i)
+      {
+        try
+        {
+          write(dgrams[i].data, dgrams[i].size, dgrams[i].addr, dgrams[i].port);
+          ++sent;
+        }
+        catch (...)
+        { }
+      }
+#endif
+
+      return sent;
+    }
+
+    size_t
+    UDPSocket::read(Datagram* dgrams, size_t count)
+    {
+      if (count == 0)
+        return 0;
+
+#if defined(DUNE_SYS_HAS_RECVMMSG)
+      mmsghdr hdrs[c_batch_max];
+      iovec iovs[c_batch_max];
+      sockaddr_in sais[c_batch_max];
+
+      unsigned n = std::min(count, (size_t)c_batch_max);
+      std::memset(hdrs, 0, sizeof(mmsghdr) * n);
+
+      for (unsigned i = 0; i < n; ++i)
+      {
+        std::memset(&sais[i], 0, sizeof(sockaddr_in));
+        iovs[i].iov_base = dgrams[i].data;
+        iovs[i].iov_len = dgrams[i].size;
+        hdrs[i].msg_hdr.msg_name = &sais[i];
+        hdrs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+        hdrs[i].msg_hdr.msg_iov = &iovs[i];
+        hdrs[i].msg_hdr.msg_iovlen = 1;
+      }
+
+      int rv = recvmmsg(m_handle, hdrs, n, MSG_WAITFORONE, NULL);
+
+      if (rv <= 0)
+        throw NetworkError(DTR("error receiving data"), DUNE_SOCKET_ERROR);
+
+      for (int i = 0; i < rv; ++i)
+      {
+        dgrams[i].size = hdrs[i].msg_len;
+        dgrams[i].addr = (::sockaddr*)&sais[i];
+        dgrams[i].port = Utils::ByteCopy::fromBE(sais[i].sin_port);
+      }
+
+      return rv;
+
+#else
+      dgrams[0].size = read(dgrams[0].data, dgrams[0].size, &dgrams[0].addr, &dgrams[0].port);
+      return 1;
+#endif
+    }
+
     void
     UDPSocket::createEventHandle(void)
     {
@@ -51,6 +51,20 @@ namespace DUNE
     class UDPSocket: public IO::Handle
     {
     public:
+      //! Datagram descriptor for batched I/O.
+      struct Datagram
+      {
+        //! Datagram data.
+        uint8_t* data;
+        //! Size of the data when sending, capacity of the buffer
+        //! before receiving and size of the data afterwards.
+        size_t size;
+        //! Destination or source address.
+        Address addr;
+        //! Destination or source port.
+        uint16_t port;
+      };
+
       //! Create an unbound UDP socket.
       UDPSocket(void);
 
@@ -97,6 +111,24 @@ namespace DUNE
       size_t
       read(uint8_t* buffer, size_t size, Address* addr = NULL, uint16_t* port = NULL);
 
+      //! Send several UDP datagrams. Where sendmmsg() is available
+      //! up to 64 datagrams are sent per system call. Datagrams that
+      //! cannot be sent, e.g., to unreachable hosts, are skipped.
+      //! @param dgrams datagrams to send.
+      //! @param count number of datagrams.
+      //! @return number of datagrams sent.
+      size_t
+      write(const Datagram* dgrams, size_t count);
+
+      //! Receive one or more UDP datagrams. Blocks until the first
+      //! datagram arrives and, where recvmmsg() is available, also
+      //! returns the datagrams already queued after it, up to 64.
+      //! @param dgrams datagram buffers.
+      //! @param count number of datagram buffers.
+      //! @return number of datagrams received.
+      size_t
+      read(Datagram* dgrams, size_t count);
+
     private:
       //! Platform specific handle.
 #if defined(DUNE_OS_WINDOWS)
@@ -37,6 +37,7 @@
 // DUNE headers.
 #include <DUNE/Concurrency/Thread.hpp>
 #include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/SharedMessage.hpp>
 
 namespace DUNE
 {
@@ -61,6 +62,17 @@ namespace DUNE
       virtual void
       receive(const IMC::Message* msg) = 0;
 
+      //! Queue a shared message for later consumption. Tasks that
+      //! keep a reference to the message must acquire it. The
+      //! default implementation falls back to receive(const
+      //! IMC::Message*).
+      //! @param msg shared message object.
+      virtual void
+      receive(IMC::SharedMessage* msg)
+      {
+        receive(msg->get());
+      }
+
       //! Retrieve task name.
       //! @return task name.
       virtual const char*
@@ -37,11 +37,28 @@
 #include <DUNE/Tasks/Periodic.hpp>
 #include <DUNE/Time/Clock.hpp>
 #include <DUNE/Time/Delay.hpp>
+#include <DUNE/Time/Lockstep.hpp>
 
 namespace DUNE
 {
   namespace Tasks
   {
+    //! Register the calling thread with the lockstep scheduler for
+    //! the lifetime of the object.
+    class LockstepScope
+    {
+    public:
+      LockstepScope(const std::string& name)
+      {
+        Time::Lockstep::join(name);
+      }
+
+      ~LockstepScope(void)
+      {
+        Time::Lockstep::leave();
+      }
+    };
+
     Periodic::Periodic(const std::string& name, Context& ctx):
       Task(name, ctx),
       m_run_count(0),
@@ -56,6 +73,10 @@ namespace DUNE
     void
     Periodic::onMain(void)
     {
+      // With simulated time, each cycle holds the clock until the
+      // task waits for the next one.
+      LockstepScope lockstep(getName());
+
       double now = Time::Clock::get();
       double delay = (1 / m_frequency);
       double next_inv = now + delay;
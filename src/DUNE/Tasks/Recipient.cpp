@@ -35,26 +35,79 @@
 #include <DUNE/IMC/Factory.hpp>
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Recipient.hpp>
+#include <DUNE/Time/Lockstep.hpp>
 
 namespace DUNE
 {
   namespace Tasks
   {
+    //! Default mailbox capacity.
+    static const unsigned c_default_capacity = 4096;
+    //! Maximum amount of time a publisher is blocked (s).
+    static const double c_block_timeout = 1.0;
+    //! Number of sources per coalescing table.
+    static const unsigned c_latest_slots = 64;
+
+    //! Latest instance of a message from a given source.
+    struct Recipient::LatestSlot
+    {
+      //! Source system and entity plus one, zero if unused.
+      Concurrency::AtomicValue<uint32_t> key;
+      //! Latest message or NULL if none is pending.
+      Concurrency::AtomicValue<IMC::SharedMessage*> message;
+    };
+
+    //! Coalescing slots of a message identifier, indexed by a hash
+    //! of the source and claimed by publishers on first use.
+    struct Recipient::LatestTable
+    {
+      //! Message identifier.
+      uint32_t id;
+      //! Slots.
+      LatestSlot slots[c_latest_slots];
+    };
+
     Recipient::Recipient(AbstractTask* task, Context& ctx):
       m_task(task),
-      m_ctx(ctx)
+      m_ctx(ctx),
+      m_mqueue(new Concurrency::BoundedQueue<Entry>(c_default_capacity)),
+      m_latest(new std::vector<LatestTable*>),
+      m_policy(OVERFLOW_DROP_OLDEST),
+      m_hwm(0),
+      m_reactive(false)
     { }
 
     Recipient::~Recipient(void)
     {
       unbindAll();
 
-      while (!m_mqueue.empty())
-      {
-        IMC::Message* msg = m_mqueue.pop();
-        if (msg)
-          delete msg;
-      }
+      Entry entry;
+      while (m_mqueue->pop(entry))
+        discard(entry);
+
+      delete m_mqueue;
+
+      const std::vector<LatestTable*>* tables = m_latest.load();
+      for (size_t i = 0; i < tables->size(); ++i)
+        delete (*tables)[i];
+      delete tables;
+
+      for (size_t i = 0; i < m_latest_retired.size(); ++i)
+        delete m_latest_retired[i];
+    }
+
+    void
+    Recipient::setMailbox(unsigned capacity, OverflowPolicy policy)
+    {
+      Concurrency::BoundedQueue<Entry>* old = m_mqueue;
+      m_mqueue = new Concurrency::BoundedQueue<Entry>(capacity);
+      m_policy = policy;
+
+      Entry entry;
+      while (old->pop(entry))
+        enqueue(entry);
+
+      delete old;
     }
 
     void
@@ -74,11 +127,25 @@ namespace DUNE
     }
 
     void
-    Recipient::bind(uint32_t id, AbstractConsumer* consumer)
+    Recipient::bind(uint32_t id, AbstractConsumer* consumer, BindMode mode)
     {
       std::map<uint32_t, std::vector<AbstractConsumer*> >::iterator itr = m_cbacks.find(id);
       if (itr == m_cbacks.end())
+      {
+        if (mode == BM_LATEST)
+        {
+          LatestTable* table = new LatestTable;
+          table->id = id;
+
+          const std::vector<LatestTable*>* old = m_latest.load();
+          std::vector<LatestTable*>* tables = new std::vector<LatestTable*>(*old);
+          tables->push_back(table);
+          m_latest.store(tables);
+          m_latest_retired.push_back(old);
+        }
+
         m_ctx.mbus.registerRecipient(m_task, id);
+      }
 
       m_cbacks[id].push_back(consumer);
     }
@@ -86,31 +153,177 @@ namespace DUNE
     void
     Recipient::waitForMessages(double timeout)
     {
-      if (m_mqueue.waitForItems(timeout))
+      m_reactive.store(true);
+
+      if (m_mqueue->waitForItems(timeout))
         runCallBacks();
     }
 
     void
     Recipient::put(const IMC::Message* msg)
     {
-      m_mqueue.push(msg->clone());
+      IMC::SharedMessage* shared = new IMC::SharedMessage(msg);
+      put(shared);
+      shared->release();
+    }
+
+    void
+    Recipient::put(IMC::SharedMessage* msg)
+    {
+      msg->acquire();
+
+      Entry entry;
+      entry.message = msg;
+      entry.slot = findSlot(msg->get());
+      entry.held = false;
+
+      if (entry.slot != NULL)
+      {
+        // Replace the pending instance, which is already queued.
+        IMC::SharedMessage* old = entry.slot->message.exchange(msg);
+        if (old != NULL)
+        {
+          old->release();
+          return;
+        }
+
+        entry.message = NULL;
+      }
+
+      // Hold the simulated clock until the message is consumed.
+      if (m_reactive.load() && Time::Lockstep::isEnabled())
+      {
+        entry.held = true;
+        Time::Lockstep::hold();
+      }
+
+      enqueue(entry);
+    }
+
+    Recipient::LatestSlot*
+    Recipient::findSlot(const IMC::Message* msg)
+    {
+      const std::vector<LatestTable*>* tables = m_latest.load();
+      if (tables->empty())
+        return NULL;
+
+      LatestTable* table = NULL;
+      for (size_t i = 0; i < tables->size(); ++i)
+      {
+        if ((*tables)[i]->id == msg->getId())
+        {
+          table = (*tables)[i];
+          break;
+        }
+      }
+
+      if (table == NULL)
+        return NULL;
+
+      uint32_t key = ((uint32_t)msg->getSource() << 8 | msg->getSourceEntity()) + 1;
+      unsigned hash = (msg->getSource() * 31 + msg->getSourceEntity()) % c_latest_slots;
+
+      for (unsigned i = 0; i < c_latest_slots; ++i)
+      {
+        LatestSlot& slot = table->slots[(hash + i) % c_latest_slots];
+        uint32_t current = slot.key.load();
+
+        if (current == 0 && slot.key.compareAndSwap(0, key))
+          return &slot;
+
+        if (slot.key.load() == key)
+          return &slot;
+      }
+
+      // Too many sources: queue every instance.
+      return NULL;
+    }
+
+    IMC::SharedMessage*
+    Recipient::take(const Entry& entry)
+    {
+      if (entry.slot == NULL)
+        return entry.message;
+
+      return entry.slot->message.exchange(NULL);
+    }
+
+    void
+    Recipient::discard(const Entry& entry)
+    {
+      IMC::SharedMessage* msg = take(entry);
+      if (msg)
+        msg->release();
+
+      if (entry.held)
+        Time::Lockstep::release();
+    }
+
+    void
+    Recipient::enqueue(const Entry& entry)
+    {
+      while (!m_mqueue->push(entry))
+      {
+        Entry old;
+
+        switch (m_policy)
+        {
+          case OVERFLOW_DROP_OLDEST:
+            if (m_mqueue->pop(old))
+            {
+              discard(old);
+              m_drops.add(1);
+            }
+            break;
+
+          case OVERFLOW_BLOCK:
+            if (m_mqueue->waitForSpace(c_block_timeout))
+              break;
+
+            // Consumer is stalled.
+            discard(entry);
+            m_drops.add(1);
+            return;
+
+          case OVERFLOW_DROP_NEWEST:
+            discard(entry);
+            m_drops.add(1);
+            return;
+        }
+      }
+
+      unsigned size = m_mqueue->size();
+      unsigned hwm = m_hwm.load();
+      while (size > hwm && !m_hwm.compareAndSwap(hwm, size))
+        hwm = m_hwm.load();
     }
 
     void
     Recipient::runCallBacks(void)
     {
-      unsigned int size = m_mqueue.size();
+      unsigned int size = m_mqueue->size();
 
       for (unsigned int i = 0; i < size; ++i)
       {
-        const IMC::Message* msg = m_mqueue.pop();
+        Entry entry;
+        if (!m_mqueue->pop(entry))
+          break;
+
+        // Consumers that sleep must not stop the clock they wait on.
+        if (entry.held)
+          Time::Lockstep::claim();
+
+        IMC::SharedMessage* msg = take(entry);
         if (msg)
         {
           uint32_t id = msg->getId();
           for (size_t j = 0; j < m_cbacks[id].size(); ++j)
-            m_cbacks[id][j]->consume(msg);
-          delete msg;
+            m_cbacks[id][j]->consume(msg->get());
+          msg->release();
         }
+
+        if (entry.held)
+          Time::Lockstep::releaseClaimed();
       }
     }
   }
@@ -35,7 +35,10 @@
 #include <vector>
 
 // DUNE headers.
-#include <DUNE/Concurrency/TSQueue.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
+#include <DUNE/Concurrency/AtomicValue.hpp>
+#include <DUNE/Concurrency/BoundedQueue.hpp>
+#include <DUNE/IMC/SharedMessage.hpp>
 #include <DUNE/Tasks/Consumer.hpp>
 #include <DUNE/Tasks/AbstractTask.hpp>
 
@@ -46,12 +49,33 @@ namespace DUNE
     // Forward declarations.
     struct Context;
 
+    //! Message binding modes.
+    enum BindMode
+    {
+      //! Queue every instance of the message.
+      BM_QUEUE,
+      //! Keep only the latest instance of the message per source
+      //! system and entity.
+      BM_LATEST
+    };
+
     // Export DLL Symbol.
     class DUNE_DLL_SYM Recipient;
 
     class Recipient
     {
     public:
+      //! Action taken when a message arrives and the mailbox is full.
+      enum OverflowPolicy
+      {
+        //! Discard the oldest queued message.
+        OVERFLOW_DROP_OLDEST,
+        //! Discard the arriving message.
+        OVERFLOW_DROP_NEWEST,
+        //! Block the publisher until there is room in the mailbox.
+        OVERFLOW_BLOCK
+      };
+
       //! Constructor.
       Recipient(AbstractTask* task, Context& ctx);
 
@@ -61,19 +85,74 @@ namespace DUNE
       void
       unbindAll(void);
 
+      //! Queue a private copy of a message.
+      //! @param msg message object.
       void
-      put(const IMC::Message*);
+      put(const IMC::Message* msg);
 
+      //! Queue a reference to a shared message.
+      //! @param msg shared message object.
       void
-      bind(uint32_t id, AbstractConsumer* c);
+      put(IMC::SharedMessage* msg);
 
+      //! Register a consumer for a given message identifier.
+      //! @param id message identifier.
+      //! @param c consumer object.
+      //! @param mode binding mode. All consumers of the same message
+      //! share the mode of the first binding.
+      void
+      bind(uint32_t id, AbstractConsumer* c, BindMode mode = BM_QUEUE);
+
+      //! Wait for messages and consume them.
+      //! @param timeout timeout in seconds, measured on the host
+      //! clock even if simulated time is enabled.
       void
       waitForMessages(double timeout);
 
       void
       runCallBacks(void);
 
+      //! Replace the mailbox with one of the given capacity and
+      //! overflow policy, keeping queued messages. Must be called
+      //! before the owner task is started.
+      //! @param capacity maximum number of queued messages.
+      //! @param policy overflow policy.
+      void
+      setMailbox(unsigned capacity, OverflowPolicy policy);
+
+      //! Retrieve the largest number of messages queued so far.
+      //! @return high-water mark.
+      unsigned
+      getHighWaterMark(void) const
+      {
+        return m_hwm.load();
+      }
+
+      //! Retrieve the number of messages dropped due to overflow.
+      //! @return number of dropped messages.
+      unsigned
+      getDropCount(void)
+      {
+        return m_drops.add(0);
+      }
+
     private:
+      // Forward declarations.
+      struct LatestSlot;
+      struct LatestTable;
+
+      //! Mailbox entry. Coalesced messages are queued as a reference
+      //! to the slot holding the latest instance.
+      struct Entry
+      {
+        //! Queued message.
+        IMC::SharedMessage* message;
+        //! Slot of a coalesced message.
+        LatestSlot* slot;
+        //! True if the entry holds the simulated clock.
+        bool held;
+      };
+
       //! Task.
       AbstractTask* m_task;
       //! Context.
@@ -81,7 +160,44 @@ namespace DUNE
       //! Callbacks.
       std::map<uint32_t, std::vector<AbstractConsumer*> > m_cbacks;
       //! Message queue.
-      Concurrency::TSQueue<IMC::Message*> m_mqueue;
+      Concurrency::BoundedQueue<Entry>* m_mqueue;
+      //! Coalescing tables of messages bound in BM_LATEST mode.
+      //! Replaced, never modified, while the task is receiving.
+      Concurrency::AtomicValue<const std::vector<LatestTable*>*> m_latest;
+      //! Superseded lists of coalescing tables.
+      std::vector<const std::vector<LatestTable*>*> m_latest_retired;
+      //! Overflow policy.
+      OverflowPolicy m_policy;
+      //! Largest number of queued messages.
+      Concurrency::AtomicValue<unsigned> m_hwm;
+      //! Number of dropped messages.
+      Concurrency::AtomicCounter m_drops;
+      //! True if the task waits for messages, in which case queued
+      //! messages hold the simulated clock until consumed.
+      Concurrency::AtomicValue<bool> m_reactive;
+
+      //! Queue an entry according to the overflow policy.
+      //! @param entry mailbox entry, whose message reference is
+      //! transferred to the mailbox.
+      void
+      enqueue(const Entry& entry);
+
+      //! Release the message referenced by a mailbox entry.
+      //! @param entry mailbox entry.
+      //! @return message or NULL if it was already consumed.
+      IMC::SharedMessage*
+      take(const Entry& entry);
+
+      //! Release the message referenced by a discarded mailbox entry.
+      //! @param entry mailbox entry.
+      void
+      discard(const Entry& entry);
+
+      //! Find the coalescing slot of a message.
+      //! @param msg message.
+      //! @return slot or NULL if the message is not coalesced.
+      LatestSlot*
+      findSlot(const IMC::Message* msg);
     };
   }
 }
@@ -101,20 +101,21 @@ namespace DUNE
     void
     SimpleTransport::handleData(IMC::Parser& parser, const uint8_t* p, unsigned int n)
     {
-      for (const uint8_t* e = p + n; p != e; ++p)
+      parser.parse(p, n, m_msgs);
+
+      for (size_t i = 0; i < m_msgs.size(); ++i)
       {
-        IMC::Message* m = parser.parse(*p);
+        IMC::Message* m = m_msgs[i];
 
-        if (m)
-        {
-          dispatch(m, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+        dispatch(m, DF_KEEP_TIME | DF_KEEP_SRC_EID);
 
-          if (m_gargs.trace_in)
-            inf(DTR("incoming: %s"), m->getName());
+        if (m_gargs.trace_in)
+          inf(DTR("incoming: %s"), m->getName());
 
-          delete m;
-        }
+        delete m;
       }
+
+      m_msgs.clear();
     }
   }
 }
@@ -87,6 +87,8 @@ namespace DUNE
       GArguments m_gargs;
       Utils::ByteBuffer m_buf;
       MessageFilter m_rl;
+      // Messages parsed from the last block of incoming data.
+      std::vector<IMC::Message*> m_msgs;
     };
   }
 }
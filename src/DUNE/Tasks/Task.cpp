@@ -63,7 +63,8 @@ namespace DUNE
       m_name(n),
       m_entity(NULL),
       m_debug_level(DEBUG_LEVEL_NONE),
-      m_honours_active(false)
+      m_honours_active(false),
+      m_mailbox_drops(0)
     {
       m_args.priority = 10;
       m_args.act_time = 0;
@@ -88,6 +89,18 @@ namespace DUNE
       .defaultValue("None")
       .values("None, Debug, Trace, Spew");
 
+      param(DTR_RT("Mailbox Capacity"), m_args.mailbox_capacity)
+      .visibility(Parameter::VISIBILITY_DEVELOPER)
+      .defaultValue("4096")
+      .minimumValue("2")
+      .description(DTR("Maximum number of queued messages, applied at startup"));
+
+      param(DTR_RT("Mailbox Overflow Policy"), m_args.mailbox_policy)
+      .visibility(Parameter::VISIBILITY_DEVELOPER)
+      .defaultValue("Drop Oldest")
+      .values("Drop Oldest, Drop Newest, Block")
+      .description(DTR("Action taken when a message arrives and the mailbox is full"));
+
       m_recipient = new Recipient(this, ctx);
       m_entity = new Entities::StatefulEntity(this, m_ctx);
       m_entities.push_back(m_entity);
@@ -710,6 +723,38 @@ namespace DUNE
       }
 
       updateParameters(false);
+
+      Recipient::OverflowPolicy policy = Recipient::OVERFLOW_DROP_OLDEST;
+      if (m_args.mailbox_policy == "Drop Newest")
+        policy = Recipient::OVERFLOW_DROP_NEWEST;
+      else if (m_args.mailbox_policy == "Block")
+        policy = Recipient::OVERFLOW_BLOCK;
+
+      m_recipient->setMailbox(m_args.mailbox_capacity, policy);
+    }
+
+    void
+    Task::setMailboxDefaults(unsigned capacity, const std::string& policy)
+    {
+      std::map<std::string, Parameter*>::iterator itr = m_params.find(DTR_RT("Mailbox Capacity"));
+      if (itr != m_params.end())
+        itr->second->defaultValue(uncastLexical(capacity));
+
+      itr = m_params.find(DTR_RT("Mailbox Overflow Policy"));
+      if (itr != m_params.end())
+        itr->second->defaultValue(policy);
+    }
+
+    void
+    Task::checkMailbox(void)
+    {
+      unsigned drops = m_recipient->getDropCount();
+      if (drops == m_mailbox_drops)
+        return;
+
+      war(DTR("mailbox overflow: %u messages dropped (high-water mark: %u)"),
+          drops - m_mailbox_drops, m_recipient->getHighWaterMark());
+      m_mailbox_drops = drops;
     }
   }
 }
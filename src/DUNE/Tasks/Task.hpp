@@ -336,6 +336,14 @@ namespace DUNE
         m_recipient->put(msg);
       }
 
+      //! Queue a shared message for later consumption.
+      //! @param msg shared message object.
+      void
+      receive(IMC::SharedMessage* msg)
+      {
+        m_recipient->put(msg);
+      }
+
       //! Instruct task to reserve all entity identifiers that it
       //! needs for normal execution.
       void
@@ -494,6 +502,7 @@ namespace DUNE
       waitForMessages(double timeout)
       {
         m_recipient->waitForMessages(timeout);
+        checkMailbox();
       }
 
       //! Call the consumers of all messages currently in the
@@ -502,6 +511,7 @@ namespace DUNE
       consumeMessages(void)
       {
         m_recipient->runCallBacks();
+        checkMailbox();
       }
 
       //! Declare a configuration parameter that can be parsed using
@@ -539,6 +549,26 @@ namespace DUNE
         return m_params.changed(&var);
       }
 
+      //! Change the default values of parameters 'Mailbox Capacity'
+      //! and 'Mailbox Overflow Policy'. Tasks that receive bursts of
+      //! messages, such as loggers, should call this from their
+      //! constructor with a larger capacity. The 'Block' policy makes
+      //! publishers wait for this task and should only be enabled
+      //! explicitly in configuration files.
+      //! @param[in] capacity default mailbox capacity.
+      //! @param[in] policy default overflow policy.
+      void
+      setMailboxDefaults(unsigned capacity, const std::string& policy);
+
+      //! Retrieve the number of messages dropped by the mailbox since
+      //! the task was created.
+      //! @return number of dropped messages.
+      unsigned
+      getMailboxDrops(void)
+      {
+        return m_recipient->getDropCount();
+      }
+
       //! Declare parameter 'Active' and associated parameters 'Active
       //! - Scope' and 'Active - Visibility'. These parameters allows
       //! the task to be activated/deactivated using the message
@@ -563,11 +593,14 @@ namespace DUNE
       //! Bind a message to a consumer method.
       //! @param task_obj consumer task.
       //! @param consumer consumer method.
+      //! @param mode binding mode, use BM_LATEST to receive only the
+      //! most recent instance of the message of each source.
       template <typename M, typename T>
       void
-      bind(T* task_obj, void (T::* consumer)(const M*) = &T::consume)
+      bind(T* task_obj, void (T::* consumer)(const M*) = &T::consume,
+           BindMode mode = BM_QUEUE)
       {
-        bind(M::getIdStatic(), new Consumer<T, M>(*task_obj, consumer));
+        bind(M::getIdStatic(), new Consumer<T, M>(*task_obj, consumer), mode);
       }
 
       //! Bind multiple messages to a default consumer method.
@@ -774,6 +807,10 @@ namespace DUNE
         std::string active_scope;
         //! Visibility of 'Active' parameter.
         std::string active_visibility;
+        //! Mailbox capacity.
+        unsigned mailbox_capacity;
+        //! Mailbox overflow policy.
+        std::string mailbox_policy;
       };
 
       //! Message recipient (queue).
@@ -796,6 +833,8 @@ namespace DUNE
       bool m_honours_active;
       //! Name of parameter section editor.
       std::string m_param_editor;
+      //! Number of mailbox drops already reported.
+      unsigned m_mailbox_drops;
 
       //! Report current entity states by dispatching EntityState
       //! messages. This function will at least report the state of
@@ -803,6 +842,11 @@ namespace DUNE
       void
       reportEntityState(void);
 
+      //! Warn about messages dropped by the mailbox since the last
+      //! call.
+      void
+      checkMailbox(void);
+
       void
       log(IMC::LogBookEntry::TypeEnum type, const char* format, std::va_list arg_list);
 
@@ -812,12 +856,13 @@ namespace DUNE
       //! Register a consumer for a given message identifier.
       //! @param[in] message_id message identifier.
       //! @param[in] consumer consumer object.
+      //! @param[in] mode binding mode.
       void
-      bind(unsigned int message_id, AbstractConsumer* consumer)
+      bind(unsigned int message_id, AbstractConsumer* consumer, BindMode mode = BM_QUEUE)
       {
         spew("registering consumer for '%s'",
              IMC::Factory::getAbbrevFromId(message_id).c_str());
-        m_recipient->bind(message_id, consumer);
+        m_recipient->bind(message_id, consumer, mode);
       }
 
       //! Consume QueryEntityState messages and reply accordingly.
@@ -36,7 +36,11 @@
 #include <DUNE/Config.hpp>
 #include <DUNE/Time/Constants.hpp>
 #include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/Lockstep.hpp>
 #include <DUNE/System/Error.hpp>
+#include <DUNE/Concurrency/AtomicValue.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
 
 // Platform headers.
 #if defined(DUNE_SYS_HAS_SYS_TIME_H)
@@ -55,8 +59,28 @@ namespace DUNE
 {
   namespace Time
   {
+    //! True if a virtual time is set.
+    static Concurrency::AtomicValue<bool> s_virtual(false);
+    //! Amount of time the monotonic clock was advanced ahead of the
+    //! host clock by the current virtual time (ns).
+    static Concurrency::AtomicValue<uint64_t> s_advance(0);
+    //! Difference between the virtual time since the UNIX Epoch and
+    //! the monotonic time (ns).
+    static Concurrency::AtomicValue<uint64_t> s_virtual_offset(0);
+    //! Lock serializing updates of the virtual time.
+    static Concurrency::Mutex s_virtual_lock;
+
     uint64_t
     Clock::getNsec(void)
+    {
+      if (Lockstep::isEnabled())
+        return Lockstep::getNsec();
+
+      return getHostNsec() + s_advance.load();
+    }
+
+    uint64_t
+    Clock::getHostNsec(void)
     {
       // POSIX RT.
 #if defined(DUNE_SYS_HAS_CLOCK_GETTIME)
@@ -73,14 +97,26 @@ namespace DUNE
         QueryPerformanceCounter(&li);
         return (uint64_t)(li.QuadPart * (1000000000L / (double)frequency.QuadPart));
       }
-      return getSinceEpochNsec();
+      return getHostSinceEpochNsec();
 #else
-      return getSinceEpochNsec();
+      return getHostSinceEpochNsec();
 #endif
     }
 
     uint64_t
     Clock::getSinceEpochNsec(void)
+    {
+      if (s_virtual.load())
+        return s_virtual_offset.load() + getNsec();
+
+      if (Lockstep::isEnabled())
+        return Lockstep::getSinceEpochNsec();
+
+      return getHostSinceEpochNsec();
+    }
+
+    uint64_t
+    Clock::getHostSinceEpochNsec(void)
     {
       // POSIX RT.
 #if defined(DUNE_SYS_HAS_CLOCK_GETTIME)
@@ -109,7 +145,7 @@ namespace DUNE
 
       // Unsupported system.
 #else
-#  error Clock::getSinceEpochNsec() is not yet implemented in this system.
+#  error Clock::getHostSinceEpochNsec() is not yet implemented in this system.
 
 #endif
     }
@@ -127,5 +163,40 @@ namespace DUNE
       (void)value;
 #endif
     }
+
+    void
+    Clock::setVirtual(double value)
+    {
+      uint64_t nsec = (uint64_t)(value * c_nsec_per_sec_fp);
+
+      Concurrency::ScopedMutex l(s_virtual_lock);
+      uint64_t now = getNsec();
+
+      if (!s_virtual.load())
+      {
+        s_virtual_offset.store(nsec - now);
+        s_virtual.store(true);
+        return;
+      }
+
+      // Advance the monotonic clock, and with it the virtual time.
+      uint64_t target = nsec - s_virtual_offset.load();
+      if (target > now)
+        s_advance.store(s_advance.load() + (target - now));
+    }
+
+    void
+    Clock::clearVirtual(void)
+    {
+      Concurrency::ScopedMutex l(s_virtual_lock);
+      s_virtual.store(false);
+      s_advance.store(0);
+    }
+
+    bool
+    Clock::isVirtual(void)
+    {
+      return s_virtual.load();
+    }
   }
 }
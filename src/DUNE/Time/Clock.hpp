@@ -47,11 +47,22 @@ namespace DUNE
     public:
       //! Get the amount of time (in nanoseconds) since an unspecified
       //! point in the past. If the system permits, this point does
-      //! not change after system start-up time.
+      //! not change after system start-up time. If simulated time is
+      //! enabled (see Lockstep) the simulated time is returned instead.
+      //! The clock may be advanced by a virtual time (see
+      //! setVirtual()).
       //! @return time in nanoseconds.
       static uint64_t
       getNsec(void);
 
+      //! Get the amount of time (in nanoseconds) since an unspecified
+      //! point in the past as given by the system, ignoring any
+      //! simulated time. Use this to compute deadlines passed to the
+      //! operating system.
+      //! @return time in nanoseconds.
+      static uint64_t
+      getHostNsec(void);
+
       //! Get the amount of time (in microseconds) since an unspecified
       //! point in the past. If the system permits, this point does
       //! not change after system start-up time.
@@ -83,11 +94,22 @@ namespace DUNE
       }
 
       //! Get the amount of time (in nanoseconds) elapsed since the
-      //! UNIX Epoch (Midnight UTC of January 1, 1970).
+      //! UNIX Epoch (Midnight UTC of January 1, 1970). If a virtual
+      //! time is set, the virtual time is returned instead. If
+      //! simulated time is enabled (see Lockstep) the simulated time
+      //! is returned instead.
       //! @return time in nanoseconds.
       static uint64_t
       getSinceEpochNsec(void);
 
+      //! Get the amount of time (in nanoseconds) elapsed since the
+      //! UNIX Epoch (Midnight UTC of January 1, 1970) as given by
+      //! the system, ignoring any virtual or simulated time. Use this
+      //! to compute deadlines passed to the operating system.
+      //! @return time in nanoseconds.
+      static uint64_t
+      getHostSinceEpochNsec(void);
+
       //! Get the amount of time (in microseconds) elapsed since the
       //! UNIX Epoch (Midnight UTC of January 1, 1970).
       //! @return time in microseconds.
@@ -120,6 +142,32 @@ namespace DUNE
       //! @param value time in seconds.
       static void
       set(double value);
+
+      //! Drive the clock from a virtual source, such as a log being
+      //! replayed as fast as possible. The first call sets the time
+      //! since the UNIX Epoch returned by getSinceEpoch*() for the
+      //! whole process; further calls advance both the monotonic
+      //! clock (get*()) and the time since the UNIX Epoch by the same
+      //! amount, so that timers and timestamps agree. Between calls
+      //! the clock keeps running at the host rate. The clock never
+      //! goes backwards: values older than the current virtual time
+      //! are ignored. Has no effect on the monotonic clock while
+      //! simulated time is enabled (see Lockstep).
+      //! @param value time in seconds since the UNIX Epoch.
+      static void
+      setVirtual(double value);
+
+      //! Stop using the virtual time set with setVirtual(). Both the
+      //! monotonic clock and the time since the UNIX Epoch return to
+      //! the host time, which may be behind the virtual time, hence
+      //! deadlines computed from the virtual time must be discarded.
+      static void
+      clearVirtual(void);
+
+      //! Test if a virtual time is set.
+      //! @return true if a virtual time is set, false otherwise.
+      static bool
+      isVirtual(void);
     };
   }
 }
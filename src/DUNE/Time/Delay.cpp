@@ -31,6 +31,7 @@
 #include <DUNE/Config.hpp>
 #include <DUNE/Time/Delay.hpp>
 #include <DUNE/Time/Constants.hpp>
+#include <DUNE/Time/Lockstep.hpp>
 
 // Platform headers.
 #if defined(DUNE_SYS_HAS_TIME_H)
@@ -47,6 +48,15 @@ namespace DUNE
   {
     void
     Delay::waitNsec(uint64_t nsec)
+    {
+      if (Lockstep::isEnabled())
+        Lockstep::sleep(nsec);
+      else
+        waitHostNsec(nsec);
+    }
+
+    void
+    Delay::waitHostNsec(uint64_t nsec)
     {
       // Microsoft Windows.
 #if defined(DUNE_SYS_HAS_CREATE_WAITABLE_TIMER)
@@ -73,7 +83,7 @@ namespace DUNE
 
       // Unsupported system.
 #else
-#  error Delay::waitNsec() is not yet implemented in this system
+#  error Delay::waitHostNsec() is not yet implemented in this system
 #endif
     }
   }
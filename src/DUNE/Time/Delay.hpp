@@ -46,11 +46,20 @@ namespace DUNE
     {
     public:
       //! Suspends the execution of the calling thread for the
-      //! specified amount of time (in nanosecond).
+      //! specified amount of time (in nanosecond). If simulated time
+      //! is enabled (see Lockstep) the amount of time is measured in
+      //! simulated time.
       //! @param nsec the amount of nanoseconds to suspend.
       static void
       waitNsec(uint64_t nsec);
 
+      //! Suspends the execution of the calling thread for the
+      //! specified amount of time (in nanosecond) as measured by
+      //! the system, ignoring any simulated time.
+      //! @param nsec the amount of nanoseconds to suspend.
+      static void
+      waitHostNsec(uint64_t nsec);
+
       //! Suspends the execution of the calling thread for the
       //! specified amount of time (in microsecond).
       //! @param usec the amount of microseconds to suspend.
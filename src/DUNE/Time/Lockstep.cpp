@@ -0,0 +1,370 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Time/Lockstep.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/Delay.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
+#include <DUNE/Concurrency/AtomicValue.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Concurrency/Semaphore.hpp>
+#include <DUNE/Concurrency/TLS.hpp>
+
+namespace DUNE
+{
+  namespace Time
+  {
+    //! Thread registered with the scheduler.
+    struct Participant
+    {
+      //! Name.
+      std::string name;
+      //! Simulated time at which the thread wants to run (ns).
+      uint64_t deadline;
+      //! True if the thread is running and holding the clock.
+      bool running;
+      //! Posted when the thread is released.
+      Concurrency::Semaphore wake;
+
+      Participant(void):
+        deadline(0),
+        running(true),
+        wake(0)
+      { }
+    };
+
+    //! Thread sleeping without holding the clock.
+    struct Sleeper
+    {
+      //! Holds claimed by the thread, restored when it wakes up.
+      unsigned holds;
+      //! Posted when the deadline is reached.
+      Concurrency::Semaphore wake;
+
+      Sleeper(void):
+        holds(0),
+        wake(0)
+      { }
+    };
+
+    //! Per thread scheduler state.
+    struct ThreadState
+    {
+      //! Participant of the thread, if any.
+      Participant* participant;
+      //! Number of holds claimed by the thread.
+      unsigned holds;
+
+      ThreadState(void):
+        participant(NULL),
+        holds(0)
+      { }
+    };
+
+    //! True if simulated time is enabled.
+    static Concurrency::AtomicValue<bool> s_enabled(false);
+    //! Simulated monotonic time (ns).
+    static Concurrency::AtomicValue<uint64_t> s_now(0);
+    //! Difference between the time since the UNIX Epoch and the
+    //! monotonic time when simulated time was enabled (ns).
+    static uint64_t s_epoch_offset = 0;
+    //! Host and simulated monotonic time when enabled (ns).
+    static uint64_t s_start = 0;
+    //! Maximum speed as a multiple of real time.
+    static double s_speed = 0;
+    //! Number of pending holds.
+    static Concurrency::AtomicCounter s_holds;
+    //! Lock protecting the scheduler state.
+    static Concurrency::Mutex s_lock;
+    //! Registered participants.
+    static std::vector<Participant*> s_participants;
+    //! Number of running participants.
+    static unsigned s_running = 0;
+    //! Sleeping threads, by deadline.
+    static std::multimap<uint64_t, Sleeper*> s_sleepers;
+    //! Per thread state.
+    static Concurrency::TLS<ThreadState> s_thread;
+
+    //! Wake up a sleeper, restoring its claimed holds before it
+    //! runs so that the clock does not move past it. Must be called
+    //! with the lock held.
+    //! @param sleeper sleeper.
+    static void
+    wakeSleeper(Sleeper* sleeper)
+    {
+      if (sleeper->holds > 0)
+        s_holds.add(sleeper->holds);
+
+      sleeper->wake.unlock();
+    }
+
+    //! Wake up sleepers whose deadline was reached. Must be called
+    //! with the lock held.
+    static void
+    wakeSleepers(void)
+    {
+      uint64_t now = s_now.load();
+
+      while (!s_sleepers.empty() && s_sleepers.begin()->first <= now)
+      {
+        wakeSleeper(s_sleepers.begin()->second);
+        s_sleepers.erase(s_sleepers.begin());
+      }
+    }
+
+    //! Advance the simulated clock to the next deadline and release
+    //! the participant that owns it, if nothing holds the clock. Must
+    //! be called with the lock held.
+    static void
+    advance(void)
+    {
+      while (s_running == 0 && s_holds.add(0) == 0)
+      {
+        Participant* next = NULL;
+        for (size_t i = 0; i < s_participants.size(); ++i)
+        {
+          Participant* p = s_participants[i];
+          if (next == NULL || p->deadline < next->deadline
+              || (p->deadline == next->deadline && p->name < next->name))
+            next = p;
+        }
+
+        if (!s_sleepers.empty() && (next == NULL || s_sleepers.begin()->first < next->deadline))
+        {
+          if (s_sleepers.begin()->first > s_now.load())
+            s_now.store(s_sleepers.begin()->first);
+          wakeSleepers();
+          continue;
+        }
+
+        if (next == NULL)
+          return;
+
+        if (next->deadline > s_now.load())
+          s_now.store(next->deadline);
+        wakeSleepers();
+
+        next->running = true;
+        ++s_running;
+        next->wake.unlock();
+        return;
+      }
+    }
+
+    //! Wait until the host clock catches up with a simulated time,
+    //! according to the maximum speed.
+    //! @param nsec simulated time (ns).
+    static void
+    pace(uint64_t nsec)
+    {
+      if (s_speed <= 0 || nsec <= s_start)
+        return;
+
+      uint64_t target = s_start + (uint64_t)((nsec - s_start) / s_speed);
+      uint64_t now = Clock::getHostNsec();
+      if (target > now)
+        Delay::waitHostNsec(target - now);
+    }
+
+    void
+    Lockstep::enable(double speed)
+    {
+      Concurrency::ScopedMutex l(s_lock);
+      s_start = Clock::getHostNsec();
+      s_epoch_offset = Clock::getHostSinceEpochNsec() - s_start;
+      s_speed = speed;
+      s_now.store(s_start);
+      s_enabled.store(true);
+    }
+
+    void
+    Lockstep::disable(void)
+    {
+      Concurrency::ScopedMutex l(s_lock);
+      s_enabled.store(false);
+
+      // Wake up everyone still sleeping on simulated time.
+      while (!s_sleepers.empty())
+      {
+        wakeSleeper(s_sleepers.begin()->second);
+        s_sleepers.erase(s_sleepers.begin());
+      }
+    }
+
+    bool
+    Lockstep::isEnabled(void)
+    {
+      return s_enabled.load();
+    }
+
+    uint64_t
+    Lockstep::getNsec(void)
+    {
+      return s_now.load();
+    }
+
+    uint64_t
+    Lockstep::getSinceEpochNsec(void)
+    {
+      return s_epoch_offset + s_now.load();
+    }
+
+    void
+    Lockstep::join(const std::string& name)
+    {
+      if (!s_enabled.load())
+        return;
+
+      ThreadState& state = s_thread.value();
+      if (state.participant != NULL)
+        return;
+
+      Participant* p = new Participant;
+      p->name = name;
+
+      Concurrency::ScopedMutex l(s_lock);
+      p->deadline = s_now.load();
+      s_participants.push_back(p);
+      ++s_running;
+      state.participant = p;
+    }
+
+    void
+    Lockstep::leave(void)
+    {
+      ThreadState& state = s_thread.value();
+      Participant* p = state.participant;
+      if (p == NULL)
+        return;
+
+      {
+        Concurrency::ScopedMutex l(s_lock);
+        for (size_t i = 0; i < s_participants.size(); ++i)
+        {
+          if (s_participants[i] == p)
+          {
+            s_participants.erase(s_participants.begin() + i);
+            break;
+          }
+        }
+
+        --s_running;
+        advance();
+      }
+
+      state.participant = NULL;
+      delete p;
+    }
+
+    void
+    Lockstep::sleep(uint64_t nsec)
+    {
+      if (!s_enabled.load())
+      {
+        Delay::waitHostNsec(nsec);
+        return;
+      }
+
+      ThreadState& state = s_thread.value();
+      Participant* p = state.participant;
+      Sleeper sleeper;
+      uint64_t deadline = 0;
+
+      s_lock.lock();
+      deadline = s_now.load() + nsec;
+
+      // Holds claimed by this thread would keep the clock from
+      // reaching the deadline.
+      if (state.holds > 0)
+        s_holds.sub(state.holds);
+
+      if (p != NULL)
+      {
+        p->deadline = deadline;
+        p->running = false;
+        --s_running;
+        advance();
+        s_lock.unlock();
+        p->wake.lock();
+
+        // The participant is running, the clock cannot advance.
+        if (state.holds > 0)
+          s_holds.add(state.holds);
+      }
+      else
+      {
+        sleeper.holds = state.holds;
+        s_sleepers.insert(std::make_pair(deadline, &sleeper));
+        advance();
+        s_lock.unlock();
+        sleeper.wake.lock();
+      }
+
+      pace(deadline);
+    }
+
+    void
+    Lockstep::hold(void)
+    {
+      s_holds.add(1);
+    }
+
+    void
+    Lockstep::release(void)
+    {
+      if (s_holds.sub(1) != 0)
+        return;
+
+      Concurrency::ScopedMutex l(s_lock);
+      advance();
+    }
+
+    void
+    Lockstep::claim(void)
+    {
+      ++s_thread.value().holds;
+    }
+
+    void
+    Lockstep::releaseClaimed(void)
+    {
+      --s_thread.value().holds;
+      release();
+    }
+  }
+}
@@ -0,0 +1,138 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+#ifndef DUNE_TIME_LOCKSTEP_HPP_INCLUDED_
+#define DUNE_TIME_LOCKSTEP_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Time
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Lockstep;
+
+    //! Deterministic simulated time.
+    //!
+    //! When enabled, the monotonic clock and the time since the UNIX
+    //! Epoch reported by Clock are driven by a simulated clock that
+    //! only advances when there is nothing left to do at the current
+    //! instant, allowing simulations to run faster than real time
+    //! with reproducible results.
+    //!
+    //! Threads that join the scheduler (participants), such as the
+    //! ones of periodic tasks, are released one at a time, in order
+    //! of deadline and name, and hold the simulated clock until they
+    //! wait again. Messages queued for other tasks also hold the
+    //! clock until they are consumed (see hold() and release()),
+    //! except while the consuming thread sleeps (see claim()).
+    //! Other threads sleeping with Delay wake up when the simulated
+    //! clock reaches their deadline but never hold it. Timed waits
+    //! for messages or queue events, such as
+    //! Tasks::Recipient::waitForMessages(), still time out on the
+    //! host clock.
+    class Lockstep
+    {
+    public:
+      //! Start driving the clock from simulated time. The simulated
+      //! clock starts at the current host time.
+      //! @param speed maximum speed as a multiple of real time, or 0
+      //! to run as fast as possible.
+      static void
+      enable(double speed = 0);
+
+      //! Stop driving the clock from simulated time. Must only be
+      //! called after all participants left.
+      static void
+      disable(void);
+
+      //! Test if simulated time is enabled.
+      //! @return true if simulated time is enabled, false otherwise.
+      static bool
+      isEnabled(void);
+
+      //! Get the simulated monotonic time.
+      //! @return time in nanoseconds.
+      static uint64_t
+      getNsec(void);
+
+      //! Get the simulated time elapsed since the UNIX Epoch.
+      //! @return time in nanoseconds.
+      static uint64_t
+      getSinceEpochNsec(void);
+
+      //! Register the calling thread as a participant. The thread
+      //! holds the simulated clock until it calls sleep() or
+      //! leave(). Does nothing if simulated time is not enabled.
+      //! @param name participant name, used to order participants
+      //! with the same deadline.
+      static void
+      join(const std::string& name);
+
+      //! Unregister the calling thread.
+      static void
+      leave(void);
+
+      //! Suspend the calling thread until the simulated clock
+      //! advances by the given amount of time. Participants let the
+      //! clock advance while suspended.
+      //! @param nsec amount of time in nanoseconds.
+      static void
+      sleep(uint64_t nsec);
+
+      //! Prevent the simulated clock from advancing, usually because
+      //! a message was queued and is yet to be consumed.
+      static void
+      hold(void);
+
+      //! Undo a previous call to hold().
+      static void
+      release(void);
+
+      //! Make the calling thread responsible for a pending hold,
+      //! usually because it is consuming the message that placed it.
+      //! Holds claimed by a thread are suspended while it sleeps, so
+      //! that it does not stop the clock it is waiting on.
+      static void
+      claim(void);
+
+      //! Undo a previous call to claim() and release the hold.
+      static void
+      releaseClaimed(void);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,444 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Eduardo Marques (former Bathymetry task)                         *
+// Author: Pedro Calado                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/I18N.hpp>
+#include <DUNE/Math/General.hpp>
+
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_MMAN_H)
+#  include <sys/mman.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_STAT_H)
+#  include <sys/stat.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_FCNTL_H)
+#  include <fcntl.h>
+#endif
+
+// Local headers.
+#include "Grid.hpp"
+
+namespace Simulators
+{
+  namespace Environment
+  {
+    //! Cache file magic number ("DBGR").
+    static const uint32_t c_magic = 0x44424752;
+    //! Cache file format version.
+    static const uint32_t c_version = 1;
+    //! Base two logarithm of the tile size.
+    static const unsigned c_tile_bits = 4;
+    //! Tile size (nodes).
+    static const unsigned c_tile_size = 1 << c_tile_bits;
+    //! Mask of node coordinates inside a tile.
+    static const unsigned c_tile_mask = c_tile_size - 1;
+
+    Grid::Grid(void):
+      m_depths(NULL),
+      m_map(NULL),
+      m_map_size(0)
+    {
+      std::memset(&m_header, 0, sizeof(m_header));
+    }
+
+    Grid::~Grid(void)
+    {
+      unmap();
+    }
+
+    size_t
+    Grid::index(unsigned col, unsigned row) const
+    {
+      size_t tile = (size_t)(row >> c_tile_bits) * m_header.tiles_x + (col >> c_tile_bits);
+      return (tile << (2 * c_tile_bits)) | ((row & c_tile_mask) << c_tile_bits) | (col & c_tile_mask);
+    }
+
+    size_t
+    Grid::getCapacity(void) const
+    {
+      return (size_t)m_header.tiles_x * m_header.tiles_y * c_tile_size * c_tile_size;
+    }
+
+    void
+    Grid::validate(const Header& header, uint64_t size)
+    {
+      // Grids built without soundings have no nodes.
+      bool empty = header.cols == 0 && header.rows == 0;
+
+      if (!empty && (header.cols < 2 || header.rows < 2))
+        throw std::runtime_error(DTR("invalid grid dimensions"));
+
+      if (header.tiles_x != ((uint64_t)header.cols + c_tile_mask) >> c_tile_bits
+          || header.tiles_y != ((uint64_t)header.rows + c_tile_mask) >> c_tile_bits)
+        throw std::runtime_error(DTR("invalid grid tiles"));
+
+      // Compare numbers of tiles, which cannot overflow, rather than sizes.
+      uint64_t tile_bytes = (uint64_t)c_tile_size * c_tile_size * sizeof(float);
+      uint64_t tiles = size / tile_bytes;
+      bool match = size % tile_bytes == 0;
+
+      if (empty)
+        match = match && tiles == 0;
+      else
+        match = match && tiles % header.tiles_x == 0 && tiles / header.tiles_x == header.tiles_y;
+
+      if (!match)
+        throw std::runtime_error(DTR("grid size does not match cache file size"));
+    }
+
+    void
+    Grid::build(const std::vector<Sounding>& soundings, const Metadata& metadata)
+    {
+      unmap();
+
+      std::memset(&m_header, 0, sizeof(m_header));
+      m_header.magic = c_magic;
+      m_header.version = c_version;
+      m_header.metadata = metadata;
+      m_data.clear();
+      m_depths = NULL;
+
+      if (soundings.empty() || metadata.resolution <= 0)
+        return;
+
+      double min_x = soundings[0].x;
+      double max_x = soundings[0].x;
+      double min_y = soundings[0].y;
+      double max_y = soundings[0].y;
+
+      for (size_t i = 1; i < soundings.size(); ++i)
+      {
+        min_x = std::min(min_x, soundings[i].x);
+        max_x = std::max(max_x, soundings[i].x);
+        min_y = std::min(min_y, soundings[i].y);
+        max_y = std::max(max_y, soundings[i].y);
+      }
+
+      // Positions up to the search radius outside the soundings have
+      // depth too.
+      double margin = std::max(metadata.radius, 0.0);
+      min_x -= margin;
+      min_y -= margin;
+      max_x += margin;
+      max_y += margin;
+
+      // At least two nodes per axis and the last one past the bounds.
+      double res = metadata.resolution;
+      m_header.min_x = min_x;
+      m_header.min_y = min_y;
+      m_header.cols = (uint32_t)std::floor((max_x - min_x) / res) + 2;
+      m_header.rows = (uint32_t)std::floor((max_y - min_y) / res) + 2;
+      m_header.tiles_x = (m_header.cols + c_tile_mask) >> c_tile_bits;
+      m_header.tiles_y = (m_header.rows + c_tile_mask) >> c_tile_bits;
+
+      // Nodes look one resolution further than the search radius, so
+      // that all nodes around a position within the search radius of a
+      // sounding have depth. Soundings are bucketed in square cells as
+      // wide as that distance.
+      double radius = margin + res;
+      unsigned bcols = (unsigned)std::floor((max_x - min_x) / radius) + 1;
+      unsigned brows = (unsigned)std::floor((max_y - min_y) / radius) + 1;
+      std::vector<unsigned> start((size_t)bcols * brows + 1, 0);
+      std::vector<unsigned> bucket(soundings.size());
+      std::vector<unsigned> order(soundings.size());
+
+      for (size_t i = 0; i < soundings.size(); ++i)
+      {
+        unsigned bc = (unsigned)((soundings[i].x - min_x) / radius);
+        unsigned br = (unsigned)((soundings[i].y - min_y) / radius);
+        bucket[i] = br * bcols + bc;
+        ++start[bucket[i] + 1];
+      }
+
+      for (size_t i = 1; i < start.size(); ++i)
+        start[i] += start[i - 1];
+
+      std::vector<unsigned> fill(start.begin(), start.end() - 1);
+      for (size_t i = 0; i < soundings.size(); ++i)
+        order[fill[bucket[i]]++] = i;
+
+      // Each node takes the closest sounding inside the square search area.
+      m_data.assign(getCapacity(), std::numeric_limits<float>::quiet_NaN());
+
+      for (unsigned row = 0; row < m_header.rows; ++row)
+      {
+        double y = min_y + row * res;
+        int br = (int)std::floor((y - min_y) / radius);
+
+        for (unsigned col = 0; col < m_header.cols; ++col)
+        {
+          double x = min_x + col * res;
+          int bc = (int)std::floor((x - min_x) / radius);
+          double dmin = std::numeric_limits<double>::max();
+          float depth = std::numeric_limits<float>::quiet_NaN();
+
+          for (int j = std::max(br - 1, 0); j <= std::min(br + 1, (int)brows - 1); ++j)
+          {
+            for (int k = std::max(bc - 1, 0); k <= std::min(bc + 1, (int)bcols - 1); ++k)
+            {
+              unsigned b = j * bcols + k;
+
+              for (unsigned n = start[b]; n < start[b + 1]; ++n)
+              {
+                const Sounding& s = soundings[order[n]];
+                double dx = s.x - x;
+                double dy = s.y - y;
+
+                if (std::fabs(dx) > radius || std::fabs(dy) > radius)
+                  continue;
+
+                double d = dx * dx + dy * dy;
+                if (d < dmin)
+                {
+                  dmin = d;
+                  depth = (float)s.depth;
+                }
+              }
+            }
+          }
+
+          m_data[index(col, row)] = depth;
+        }
+      }
+
+      m_depths = &m_data[0];
+    }
+
+    bool
+    Grid::load(const std::string& path, const Metadata& metadata)
+    {
+#if defined(DUNE_SYS_HAS_MMAP)
+      int fd = ::open(path.c_str(), O_RDONLY);
+      if (fd < 0)
+        return false;
+
+      struct stat st;
+      if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(Header))
+      {
+        ::close(fd);
+        return false;
+      }
+
+      void* map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+      ::close(fd);
+
+      if (map == MAP_FAILED)
+        return false;
+
+      Header header;
+      std::memcpy(&header, map, sizeof(header));
+
+      if (header.magic != c_magic || header.version != c_version
+          || header.metadata.source_size != metadata.source_size
+          || header.metadata.source_time != metadata.source_time
+          || header.metadata.resolution != metadata.resolution
+          || header.metadata.radius != metadata.radius)
+      {
+        munmap(map, st.st_size);
+        return false;
+      }
+
+      try
+      {
+        validate(header, st.st_size - sizeof(Header));
+      }
+      catch (...)
+      {
+        munmap(map, st.st_size);
+        throw;
+      }
+
+      size_t capacity = (size_t)header.tiles_x * header.tiles_y * c_tile_size * c_tile_size;
+
+      unmap();
+      m_data.clear();
+      m_header = header;
+      m_map = map;
+      m_map_size = st.st_size;
+      m_depths = capacity ? reinterpret_cast<const float*>(static_cast<const uint8_t*>(map) + sizeof(Header)) : NULL;
+      return true;
+#else
+      std::FILE* fd = std::fopen(path.c_str(), "rb");
+      if (fd == NULL)
+        return false;
+
+      Header header;
+      bool ok = std::fread(&header, sizeof(header), 1, fd) == 1
+      && header.magic == c_magic && header.version == c_version
+      && header.metadata.source_size == metadata.source_size
+      && header.metadata.source_time == metadata.source_time
+      && header.metadata.resolution == metadata.resolution
+      && header.metadata.radius == metadata.radius;
+
+      std::vector<float> data;
+      if (ok)
+      {
+        std::fseek(fd, 0, SEEK_END);
+        long end = std::ftell(fd);
+        std::fseek(fd, sizeof(Header), SEEK_SET);
+
+        try
+        {
+          validate(header, (uint64_t)end - sizeof(Header));
+        }
+        catch (...)
+        {
+          std::fclose(fd);
+          throw;
+        }
+
+        data.resize((size_t)header.tiles_x * header.tiles_y * c_tile_size * c_tile_size);
+        ok = data.empty() || std::fread(&data[0], sizeof(float), data.size(), fd) == data.size();
+      }
+
+      std::fclose(fd);
+
+      if (!ok)
+        return false;
+
+      m_header = header;
+      m_data.swap(data);
+      m_depths = m_data.empty() ? NULL : &m_data[0];
+      return true;
+#endif
+    }
+
+    bool
+    Grid::save(const std::string& path) const
+    {
+      // Write to a temporary file and rename it, so that readers never
+      // map a partially written cache.
+      std::string tmp = path + ".tmp";
+      std::FILE* fd = std::fopen(tmp.c_str(), "wb");
+      if (fd == NULL)
+        return false;
+
+      size_t capacity = getCapacity();
+      bool ok = std::fwrite(&m_header, sizeof(m_header), 1, fd) == 1;
+      if (ok && capacity > 0)
+        ok = std::fwrite(m_depths, sizeof(float), capacity, fd) == capacity;
+
+      ok = (std::fclose(fd) == 0) && ok;
+
+      if (ok)
+        ok = std::rename(tmp.c_str(), path.c_str()) == 0;
+
+      if (!ok)
+        std::remove(tmp.c_str());
+
+      return ok;
+    }
+
+    void
+    Grid::unmap(void)
+    {
+#if defined(DUNE_SYS_HAS_MMAP)
+      if (m_map != NULL)
+        munmap(m_map, m_map_size);
+#endif
+
+      m_map = NULL;
+      m_map_size = 0;
+    }
+
+    bool
+    Grid::depthAt(double x, double y, double& depth) const
+    {
+      if (m_depths == NULL)
+        return false;
+
+      double fx = (x - m_header.min_x) / m_header.metadata.resolution;
+      double fy = (y - m_header.min_y) / m_header.metadata.resolution;
+
+      // Also rejects NaN coordinates.
+      if (!(fx >= 0 && fy >= 0 && fx <= m_header.cols - 1 && fy <= m_header.rows - 1))
+        return false;
+
+      unsigned col = std::min((unsigned)fx, m_header.cols - 2);
+      unsigned row = std::min((unsigned)fy, m_header.rows - 2);
+      double tx = fx - col;
+      double ty = fy - row;
+
+      float d[4] = {m_depths[index(col, row)], m_depths[index(col + 1, row)],
+                    m_depths[index(col, row + 1)], m_depths[index(col + 1, row + 1)]};
+      double w[4] = {(1 - tx) * (1 - ty), tx * (1 - ty), (1 - tx) * ty, tx * ty};
+
+      // Nodes without depth are left out and the weights of the
+      // others renormalized.
+      double sum = 0;
+      double weights = 0;
+
+      for (unsigned i = 0; i < 4; ++i)
+      {
+        if (!DUNE::Math::isNaN(d[i]))
+        {
+          sum += w[i] * d[i];
+          weights += w[i];
+        }
+      }
+
+      if (weights <= 0)
+        return false;
+
+      depth = sum / weights;
+      return true;
+    }
+
+    unsigned
+    Grid::depthAt(const double* x, const double* y, unsigned count, double* depths) const
+    {
+      unsigned valid = 0;
+
+      for (unsigned i = 0; i < count; ++i)
+      {
+        if (depthAt(x[i], y[i], depths[i]))
+          ++valid;
+        else
+          depths[i] = std::numeric_limits<double>::quiet_NaN();
+      }
+
+      return valid;
+    }
+  }
+}
@@ -0,0 +1,217 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Eduardo Marques (former Bathymetry task)                         *
+// Author: Pedro Calado                                                     *
+//***************************************************************************
+
+#ifndef SIMULATORS_ENVIRONMENT_GRID_HPP_INCLUDED_
+#define SIMULATORS_ENVIRONMENT_GRID_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace Simulators
+{
+  namespace Environment
+  {
+    //! Regular grid of depths built from scattered soundings.
+    //!
+    //! Grid nodes are spaced by a fixed resolution and each node takes
+    //! the depth of the closest sounding within the search radius plus
+    //! one resolution, or no depth if there is none. Depths are interpolated bilinearly from
+    //! the four nodes around a position. Nodes are stored in square
+    //! tiles so that nearby positions share cache lines.
+    //!
+    //! A grid can be saved to a binary cache file and mapped back into
+    //! memory, which avoids parsing the soundings and rebuilding the grid.
+    class Grid
+    {
+    public:
+      //! Sounding.
+      struct Sounding
+      {
+        //! Northing.
+        double x;
+        //! Easting.
+        double y;
+        //! Depth.
+        double depth;
+      };
+
+      //! Properties that identify a grid.
+      struct Metadata
+      {
+        //! Size of the source file.
+        int64_t source_size;
+        //! Modification time of the source file.
+        int64_t source_time;
+        //! Distance between nodes.
+        double resolution;
+        //! Search radius of soundings.
+        double radius;
+        //! Reference latitude of soundings (rad).
+        double ref_lat;
+        //! Reference longitude of soundings (rad).
+        double ref_lon;
+      };
+
+      //! Constructor.
+      Grid(void);
+
+      //! Destructor.
+      ~Grid(void);
+
+      //! Build the grid from scattered soundings.
+      //! @param[in] soundings soundings.
+      //! @param[in] metadata grid properties.
+      void
+      build(const std::vector<Sounding>& soundings, const Metadata& metadata);
+
+      //! Map a grid from a cache file.
+      //! @param[in] path cache file.
+      //! @param[in] metadata expected source file and grid properties,
+      //! except for the reference coordinates.
+      //! @return true if the cache file exists and matches, false otherwise.
+      //! @throw std::runtime_error if the cache file is corrupted.
+      bool
+      load(const std::string& path, const Metadata& metadata);
+
+      //! Save the grid to a cache file.
+      //! @param[in] path cache file.
+      //! @return true on success, false otherwise.
+      bool
+      save(const std::string& path) const;
+
+      //! Retrieve grid properties.
+      //! @return grid properties.
+      const Metadata&
+      getMetadata(void) const
+      {
+        return m_header.metadata;
+      }
+
+      //! Retrieve number of nodes along the x-axis.
+      //! @return number of nodes.
+      unsigned
+      getColumns(void) const
+      {
+        return m_header.cols;
+      }
+
+      //! Retrieve number of nodes along the y-axis.
+      //! @return number of nodes.
+      unsigned
+      getRows(void) const
+      {
+        return m_header.rows;
+      }
+
+      //! Compute depth at a position.
+      //! @param[in] x northing.
+      //! @param[in] y easting.
+      //! @param[out] depth depth.
+      //! @return true if there is depth data at the position, false otherwise.
+      bool
+      depthAt(double x, double y, double& depth) const;
+
+      //! Compute depths at several positions.
+      //! @param[in] x northings.
+      //! @param[in] y eastings.
+      //! @param[in] count number of positions.
+      //! @param[out] depths depths, NaN where there is no depth data.
+      //! @return number of positions with depth data.
+      unsigned
+      depthAt(const double* x, const double* y, unsigned count, double* depths) const;
+
+    private:
+      //! Cache file header.
+      struct Header
+      {
+        //! Magic number.
+        uint32_t magic;
+        //! Format version.
+        uint32_t version;
+        //! Grid properties.
+        Metadata metadata;
+        //! Northing of the first node.
+        double min_x;
+        //! Easting of the first node.
+        double min_y;
+        //! Number of nodes along the x-axis.
+        uint32_t cols;
+        //! Number of nodes along the y-axis.
+        uint32_t rows;
+        //! Number of tiles along the x-axis.
+        uint32_t tiles_x;
+        //! Number of tiles along the y-axis.
+        uint32_t tiles_y;
+      };
+
+      //! Retrieve the index of a node.
+      //! @param[in] col node column.
+      //! @param[in] row node row.
+      //! @return node index.
+      size_t
+      index(unsigned col, unsigned row) const;
+
+      //! Retrieve number of stored nodes, including tile padding.
+      //! @return number of nodes.
+      size_t
+      getCapacity(void) const;
+
+      //! Check that the grid dimensions of a cache file header are
+      //! consistent and match the amount of depth data in the file.
+      //! @param[in] header cache file header.
+      //! @param[in] size size of the depth data (bytes).
+      //! @throw std::runtime_error if the header is inconsistent.
+      static void
+      validate(const Header& header, uint64_t size);
+
+      //! Release mapped cache file.
+      void
+      unmap(void);
+
+      //! Grid header.
+      Header m_header;
+      //! Node depths.
+      const float* m_depths;
+      //! Node depths of a built grid.
+      std::vector<float> m_data;
+      //! Mapped cache file.
+      void* m_map;
+      //! Size of mapped cache file.
+      size_t m_map_size;
+    };
+  }
+}
+
+#endif
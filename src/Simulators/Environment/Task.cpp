@@ -35,7 +35,7 @@
 #include <DUNE/DUNE.hpp>
 
 // Local headers.
-#include "QuadTree.hpp"
+#include "Grid.hpp"
 
 namespace Simulators
 {
@@ -143,6 +143,8 @@ namespace Simulators
       double oob_depth;
       //! Interpolation radius.
       double interp_radius;
+      //! Bathymetry grid resolution.
+      double grid_resolution;
       // Forward distance arguments
       //! Standard deviation of the forward distance estimates
       double fd_std_dev;
@@ -195,8 +197,8 @@ namespace Simulators
       double m_a_n, m_a_e, m_b_n, m_b_e;
       //! PRNG handle.
       Random::Generator* m_prng;
-      //! The tree.
-      QuadTree* m_qtree;
+      //! Bathymetry grid.
+      Grid* m_grid;
       //! Reference latitude and longitude for data points.
       double m_ref_lat, m_ref_lon;
       //! NE offsets in regard to navigational reference.
@@ -209,7 +211,7 @@ namespace Simulators
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Periodic(name, ctx),
         m_prng(NULL),
-        m_qtree(NULL),
+        m_grid(NULL),
         m_pb(NULL)
       {
         param("Simulate - Bottom Distance", m_args.simulate_bd)
@@ -248,7 +250,16 @@ namespace Simulators
 
         param("Interpolation Radius", m_args.interp_radius)
         .units(Units::Meter)
-        .defaultValue("10.0");
+        .defaultValue("10.0")
+        .description("Maximum distance between a bathymetry grid node and"
+                     " the sounding that defines its depth");
+
+        param("Grid Resolution", m_args.grid_resolution)
+        .units(Units::Meter)
+        .defaultValue("5.0")
+        .minimumValue("0.1")
+        .description("Distance between bathymetry grid nodes. Depths are"
+                     " interpolated bilinearly between nodes");
 
         param("Simulate Pier", m_args.simulate_pier)
         .defaultValue("false")
@@ -354,7 +365,7 @@ namespace Simulators
       onResourceRelease(void)
       {
         Memory::clear(m_prng);
-        Memory::clear(m_qtree);
+        Memory::clear(m_grid);
         Memory::clear(m_pb);
       }
 
@@ -402,49 +413,48 @@ namespace Simulators
       {
         Utils::String::toLowerCase(m_args.location);
         Path path = m_ctx.dir_cfg / "simulation" / ("bathymetry-" + m_args.location + ".ini");
-        DUNE::Parsers::Config cfg(path.c_str());
-        std::vector<std::string> lines;
-        cfg.get("Bathymetry", "Data", "", lines);
-        cfg.get("Bathymetry", "Latitude (degrees)", "", m_ref_lat);
-        cfg.get("Bathymetry", "Longitude (degrees)", "", m_ref_lon);
+        Path cache = m_ctx.dir_cfg / "simulation" / ("bathymetry-" + m_args.location + ".grid");
 
-        debug("%s | %0.6f, %0.6f", m_args.location.c_str(), m_ref_lat, m_ref_lon);
-        debug("%s | %s", m_args.location.c_str(), path.c_str());
-        debug("%s | %lu %s", m_args.location.c_str(), (long unsigned int)lines.size(), "bathymetry values");
+        Grid::Metadata metadata;
+        metadata.source_size = path.size();
+        metadata.source_time = path.getLastModifiedTime();
+        metadata.resolution = m_args.grid_resolution;
+        metadata.radius = m_args.interp_radius;
+        metadata.ref_lat = 0;
+        metadata.ref_lon = 0;
 
-        m_ref_lat = Angles::radians(m_ref_lat);
-        m_ref_lon = Angles::radians(m_ref_lon);
+        double start = Clock::get();
+        m_grid = new Grid;
 
-        std::vector<QuadTree::Item> data;
-        QuadTree::Item item;
-        Bounds* bounds = 0;
-
-        for (unsigned i = 0; i < lines.size(); ++i)
+        bool loaded = false;
+        try
         {
-          std::vector<double> v;
-          DUNE::Utils::String::split(lines[i], " ", v);
-          if (!bounds)
-            bounds = new Bounds(Point(v[0], v[1]));
-          else
-            bounds->cover(Point(v[0], v[1]));
-          item.x = v[0]; item.y = v[1]; item.value = v[2];
-          data.push_back(item);
+          loaded = m_grid->load(cache.str(), metadata);
+        }
+        catch (std::runtime_error& e)
+        {
+          war(DTR("discarding bathymetry cache '%s': %s"), cache.c_str(), e.what());
         }
 
-        std::stringstream ss;
-        ss << *bounds;
-        trace("bounds: %s", ss.str().c_str());
+        if (loaded)
+        {
+          debug("%s | %s", m_args.location.c_str(), cache.c_str());
+        }
+        else
+        {
+          loadBathymetry(path, metadata);
 
-        // Fill the tree
-        m_qtree = new QuadTree(*bounds);
-        delete bounds;
+          if (!m_grid->save(cache.str()))
+            war(DTR("unable to write bathymetry cache '%s'"), cache.c_str());
+        }
 
-        for (unsigned i = 0; i < data.size(); ++i)
-          m_qtree->insert(data[i]);
+        m_ref_lat = m_grid->getMetadata().ref_lat;
+        m_ref_lon = m_grid->getMetadata().ref_lon;
 
-        ss.clear();
-        ss << *m_qtree;
-        trace("tree elements: %s", ss.str().c_str());
+        debug("%s | %0.6f, %0.6f", m_args.location.c_str(),
+              Angles::degrees(m_ref_lat), Angles::degrees(m_ref_lon));
+        debug("%s | %u x %u grid nodes in %0.1f ms", m_args.location.c_str(),
+              m_grid->getColumns(), m_grid->getRows(), (Clock::get() - start) * 1000.0);
 
         m_bd.beam_config.clear();
         m_bd.location.clear();
@@ -485,6 +495,44 @@ namespace Simulators
         m_fd.beam_config.push_back(forward_bc);
       }
 
+      //! Build the bathymetry grid from a bathymetry file.
+      //! @param[in] path bathymetry file.
+      //! @param[in] metadata grid properties.
+      void
+      loadBathymetry(const Path& path, Grid::Metadata& metadata)
+      {
+        DUNE::Parsers::Config cfg(path.c_str());
+        std::vector<std::string> lines;
+        cfg.get("Bathymetry", "Data", "", lines);
+        cfg.get("Bathymetry", "Latitude (degrees)", "", metadata.ref_lat);
+        cfg.get("Bathymetry", "Longitude (degrees)", "", metadata.ref_lon);
+
+        debug("%s | %s", m_args.location.c_str(), path.c_str());
+        debug("%s | %lu %s", m_args.location.c_str(), (long unsigned int)lines.size(), "bathymetry values");
+
+        metadata.ref_lat = Angles::radians(metadata.ref_lat);
+        metadata.ref_lon = Angles::radians(metadata.ref_lon);
+
+        std::vector<Grid::Sounding> soundings;
+        soundings.reserve(lines.size());
+        Grid::Sounding sounding;
+
+        for (unsigned i = 0; i < lines.size(); ++i)
+        {
+          std::vector<double> v;
+          DUNE::Utils::String::split(lines[i], " ", v);
+          if (v.size() < 3)
+            continue;
+
+          sounding.x = v[0];
+          sounding.y = v[1];
+          sounding.depth = v[2];
+          soundings.push_back(sounding);
+        }
+
+        m_grid->build(soundings, metadata);
+      }
+
       void
       onEntityReservation(void)
       {
@@ -561,35 +609,14 @@ namespace Simulators
       double
       depthAt(double x, double y)
       {
-        Point p(x, y);
-        Bounds search_area(p, m_args.interp_radius);
-
-        std::vector<QuadTree::Item> items;
+        double depth;
 
-        m_qtree->search(search_area, items);
-
-        if (items.size() == 0)
+        if (!m_grid->depthAt(x, y, depth))
         {
           trace("out of bounds");
           return m_args.oob_depth;
         }
 
-        trace("found %lu close data values", (long unsigned int)items.size());
-
-        // @todo interpolate rather than picking closest one
-        double dmin = p.distance(Point(items[0].x, items[0].y));
-        double depth = items[0].value;
-
-        for (unsigned int i = 1; i < items.size(); ++i)
-        {
-          double d = p.distance(Point(items[i].x, items[i].y));
-          if (d < dmin)
-          {
-            dmin = d;
-            depth = items[i].value;
-          }
-        }
-
         return depth + m_args.tide;
       }
 
@@ -710,9 +737,26 @@ namespace Simulators
 
         double x_step = m_args.max_range / (double)c_forward_points;
 
-        std::vector<float> fwd_depths(c_forward_points);
+        // Depths of all points along the beam direction at once.
+        double xs[c_forward_points];
+        double ys[c_forward_points];
+        double fwd_depths[c_forward_points];
+
+        for (unsigned i = 0; i < c_forward_points; i++)
+        {
+          xs[i] = m_sstate.x + m_off_n + (double)i * x_step * cos(m_sstate.psi);
+          ys[i] = m_sstate.y + m_off_e + (double)i * x_step * sin(m_sstate.psi);
+        }
+
+        m_grid->depthAt(xs, ys, c_forward_points, fwd_depths);
 
-        fwd_depths[0] = depthAt(m_sstate.x + m_off_n, m_sstate.y + m_off_e);
+        for (unsigned i = 0; i < c_forward_points; i++)
+        {
+          if (Math::isNaN(fwd_depths[i]))
+            fwd_depths[i] = m_args.oob_depth;
+          else
+            fwd_depths[i] += m_args.tide;
+        }
 
         // x and z coordinates of the end of the forward beam
         double x_target, z_target;
@@ -723,11 +767,6 @@ namespace Simulators
 
         for (unsigned i = 1; i < c_forward_points; i++)
         {
-          double xe = (double)i * x_step * cos(m_sstate.psi);
-          double ye = (double)i * x_step * sin(m_sstate.psi);
-
-          fwd_depths[i] = depthAt(m_sstate.x + m_off_n + xe, m_sstate.y + m_off_e + ye);
-
           double bottom_x_1 = (double)(i - 1) * x_step;
           double bottom_z_1 = fwd_depths[i - 1];
 
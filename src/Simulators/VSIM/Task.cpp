@@ -33,6 +33,7 @@
 #include <cmath>
 #include <algorithm>
 #include <vector>
+#include <map>
 #include <stdexcept>
 #include <cstdlib>
 
@@ -64,6 +65,21 @@ namespace Simulators
       double wx;
       //! Stream speed East parameter (m/s).
       double wy;
+      //! Names of the systems simulated as a fleet.
+      std::vector<std::string> fleet;
+    };
+
+    //! Fleet vehicle bridged to the task stack of another system.
+    struct Member
+    {
+      //! System identifier.
+      unsigned id;
+      //! Simulated state.
+      IMC::SimulatedState sstate;
+      //! Start time.
+      double start_time;
+      //! True if the vehicle origin was defined.
+      bool active;
     };
 
     //! Simulator task.
@@ -79,12 +95,19 @@ namespace Simulators
       double m_start_time;
       //! Task arguments.
       Arguments m_args;
+      //! Fleet simulation engine.
+      Simulators::VSIM::Fleet* m_fleet;
+      //! Fleet vehicles.
+      std::vector<Member> m_members;
+      //! Fleet vehicle index by system identifier.
+      std::map<unsigned, unsigned> m_index;
 
       Task(const std::string& name, Tasks::Context& ctx):
         Periodic(name, ctx),
         m_vehicle(NULL),
         m_world(NULL),
-        m_start_time(Clock::get())
+        m_start_time(Clock::get()),
+        m_fleet(NULL)
       {
         // Retrieve configuration values.
         param("Stream Speed North", m_args.wx)
@@ -97,6 +120,14 @@ namespace Simulators
         .defaultValue("0.0")
         .description("Water current speed along the East in the NED frame");
 
+        param("Fleet", m_args.fleet)
+        .defaultValue("")
+        .description("Names of the systems to simulate in this task. When"
+                     " empty, the vehicle of the local system is simulated."
+                     " Otherwise every system is simulated in one batched"
+                     " fleet, is actuated by the messages it sends, and"
+                     " receives the simulated states addressed to it");
+
         // Register handler routines.
         bind<IMC::GpsFix>(this);
         bind<IMC::ServoPosition>(this);
@@ -109,12 +140,29 @@ namespace Simulators
       {
         Memory::clear(m_vehicle);
         Memory::clear(m_world);
+
+        if (m_fleet != NULL)
+        {
+          for (unsigned i = 0; i < m_fleet->size(); ++i)
+            delete m_fleet->getVehicle(i);
+
+          Memory::clear(m_fleet);
+        }
+
+        m_members.clear();
+        m_index.clear();
       }
 
       //! Initialize resources and add vehicle to the world.
       void
       onResourceInitialization(void)
       {
+        if (!m_args.fleet.empty())
+        {
+          initializeFleet();
+          return;
+        }
+
         // Initialize simulation world.
         m_world = Factory::produceWorld(m_ctx.config);
         if (!m_world)
@@ -130,12 +178,76 @@ namespace Simulators
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
       }
 
+      //! Add one vehicle per fleet system to a fleet.
+      void
+      initializeFleet(void)
+      {
+        m_fleet = new Simulators::VSIM::Fleet(1.0 / getFrequency());
+
+        for (unsigned i = 0; i < m_args.fleet.size(); ++i)
+        {
+          Member member;
+          member.id = resolveSystemName(m_args.fleet[i]);
+          member.start_time = Clock::get();
+          member.active = false;
+
+          if (m_index.find(member.id) != m_index.end())
+            continue;
+
+          Simulators::VSIM::Vehicle* vehicle = Factory::produceVehicle(m_ctx.config);
+          if (!vehicle)
+            throw std::runtime_error(DTR("error loading vehicle parameters."));
+
+          m_index[member.id] = m_fleet->addVehicle(vehicle);
+          m_members.push_back(member);
+        }
+
+        inf(DTR("simulating a fleet of %u vehicles"), m_fleet->size());
+
+        setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
+      }
+
+      //! Retrieve the fleet vehicle of the system that sent a message.
+      //! @param[in] msg message.
+      //! @return vehicle index or -1 if the system is not simulated.
+      int
+      lookup(const IMC::Message* msg)
+      {
+        std::map<unsigned, unsigned>::const_iterator itr = m_index.find(msg->getSource());
+        if (itr == m_index.end())
+          return -1;
+
+        return itr->second;
+      }
+
       void
       consume(const IMC::GpsFix* msg)
       {
         if (msg->type != IMC::GpsFix::GFT_MANUAL_INPUT)
           return;
 
+        if (m_fleet != NULL)
+        {
+          int i = lookup(msg);
+          if (i < 0)
+            return;
+
+          // We assume vehicle starts at sea surface and at rest.
+          m_fleet->setPosition(i, 0, 0, 0);
+          m_fleet->setOrientation(i, 0, 0, msg->cog);
+          m_fleet->stop(i);
+
+          Member& member = m_members[i];
+          member.sstate.lat = msg->lat;
+          member.sstate.lon = msg->lon;
+          member.sstate.height = msg->height;
+          member.start_time = Clock::get();
+          member.active = true;
+
+          requestActivation();
+          return;
+        }
+
         // We assume vehicle starts at sea surface.
         m_vehicle->setPosition(0, 0, 0);
         m_vehicle->setOrientation(0, 0, msg->cog);
@@ -160,53 +272,117 @@ namespace Simulators
       consume(const IMC::ServoPosition* msg)
       {
         using Simulators::VSIM::UUV;
-        UUV* v = static_cast<UUV*>(m_vehicle);
+        Simulators::VSIM::Vehicle* vehicle = m_vehicle;
+
+        if (m_fleet != NULL)
+        {
+          int i = lookup(msg);
+          if (i < 0)
+            return;
+
+          vehicle = m_fleet->getVehicle(i);
+        }
+
+        UUV* v = static_cast<UUV*>(vehicle);
         v->updateFin(msg->id, msg->value);
       }
 
       void
       consume(const IMC::SetThrusterActuation* msg)
       {
+        if (m_fleet != NULL)
+        {
+          int i = lookup(msg);
+          if (i >= 0)
+            m_fleet->getVehicle(i)->updateEngine(msg->id, msg->value);
+          return;
+        }
+
         m_vehicle->updateEngine(msg->id, msg->value);
       }
 
+      //! Fill simulated state.
+      //! @param[in,out] state simulated state.
+      //! @param[in] start_time start time.
+      //! @param[in] position position.
+      //! @param[in] attitude attitude.
+      //! @param[in] av angular velocity.
+      //! @param[in] lv linear velocity.
       void
-      task(void)
+      fillState(IMC::SimulatedState& state, double start_time, const double* position,
+                const double* attitude, const double* av, const double* lv)
       {
-        if (!isActive())
-          return;
-
-        m_world->takeStep();
-
         // Fill position.
-        double* position = m_vehicle->getPosition();
-        double sim_time = Clock::get() - m_start_time;
-        m_sstate.x = position[0] + sim_time * m_args.wx;
-        m_sstate.y = position[1] + sim_time * m_args.wy;
-        m_sstate.z = std::max(position[2], 0.0);
+        double sim_time = Clock::get() - start_time;
+        state.x = position[0] + sim_time * m_args.wx;
+        state.y = position[1] + sim_time * m_args.wy;
+        state.z = std::max(position[2], 0.0);
 
         // Fill attitude.
-        double* attitude = m_vehicle->getOrientation();
-        m_sstate.phi = Angles::normalizeRadian(attitude[0]);
-        m_sstate.theta = Angles::normalizeRadian(attitude[1]);
-        m_sstate.psi = Angles::normalizeRadian(attitude[2]);
+        state.phi = Angles::normalizeRadian(attitude[0]);
+        state.theta = Angles::normalizeRadian(attitude[1]);
+        state.psi = Angles::normalizeRadian(attitude[2]);
 
         // Fill angular velocity.
-        double* av = m_vehicle->getAngularVelocity();
-        m_sstate.p = av[0];
-        m_sstate.q = av[1];
-        m_sstate.r = av[2];
+        state.p = av[0];
+        state.q = av[1];
+        state.r = av[2];
 
         // Fill linear velocity.
-        double* lv = m_vehicle->getLinearVelocity();
-        m_sstate.u = lv[0];
-        m_sstate.v = lv[1];
-        m_sstate.w = lv[2];
+        state.u = lv[0];
+        state.v = lv[1];
+        state.w = lv[2];
 
         // Fill stream velocity.
-        m_sstate.svx = m_args.wx;
-        m_sstate.svy = m_args.wy;
-        m_sstate.svz = 0;
+        state.svx = m_args.wx;
+        state.svy = m_args.wy;
+        state.svz = 0;
+      }
+
+      //! Step the fleet and send each system its simulated state.
+      void
+      stepFleet(void)
+      {
+        m_fleet->takeStep();
+
+        double position[3];
+        double attitude[3];
+        double av[3];
+        double lv[3];
+
+        for (unsigned i = 0; i < m_members.size(); ++i)
+        {
+          Member& member = m_members[i];
+          if (!member.active)
+            continue;
+
+          m_fleet->getPosition(i, position);
+          m_fleet->getOrientation(i, attitude);
+          m_fleet->getAngularVelocity(i, av);
+          m_fleet->getLinearVelocity(i, lv);
+          fillState(member.sstate, member.start_time, position, attitude, av, lv);
+
+          member.sstate.setDestination(member.id);
+          dispatch(member.sstate);
+        }
+      }
+
+      void
+      task(void)
+      {
+        if (!isActive())
+          return;
+
+        if (m_fleet != NULL)
+        {
+          stepFleet();
+          return;
+        }
+
+        m_world->takeStep();
+
+        fillState(m_sstate, m_start_time, m_vehicle->getPosition(), m_vehicle->getOrientation(),
+                  m_vehicle->getAngularVelocity(), m_vehicle->getLinearVelocity());
 
         dispatch(m_sstate);
       }
@@ -90,6 +90,32 @@ namespace Simulators
 
     void
     ASV::applyAsvActuation(void)
+    {
+      double Xf = 0.0;
+      double Nf = 0.0;
+
+      computeAsvActuation(Xf, Nf);
+
+      addForces(Xf, 0, 0, 0, 0, Nf);
+    }
+
+    void
+    ASV::addControlForces(double speed, double z, double f[6])
+    {
+      double Xf = 0.0;
+      double Nf = 0.0;
+
+      (void)speed;
+      (void)z;
+
+      computeAsvActuation(Xf, Nf);
+
+      f[0] = f[0] + Xf;
+      f[5] = f[5] + Nf;
+    }
+
+    void
+    ASV::computeAsvActuation(double& xf, double& nf)
     {
       // Original parameters.
       double T2CLeft[] = {-0.7428, 1.6420, 4.0325, -0.769};
@@ -116,10 +142,8 @@ namespace Simulators
       if (m_asvm.turnRight_k_1)
         curR = std::sqrt(std::fabs(m_asvm.turnRight_k_1)) * (std::fabs(m_asvm.turnRight_k_1) / m_asvm.turnRight_k_1);
 
-      double Xf = 25 * (curL + curR);
-      double Nf = 0.00088667 * (curL - curR);
-
-      addForces(Xf, 0, 0, 0, 0, Nf);
+      xf = 25 * (curL + curR);
+      nf = 0.00088667 * (curL - curR);
 
       // Set auxiliary memory.
       m_asvm.turnLeft_k_2 = m_asvm.turnLeft_k_1;
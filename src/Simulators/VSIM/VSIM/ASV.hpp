@@ -66,12 +66,25 @@ namespace Simulators
       void
       applyAsvActuation(void);
 
+      //! Add ASV actuation forces to a force vector.
+      //! @param[in] speed vehicle speed (unused).
+      //! @param[in] z vehicle position in the z-axis (unused).
+      //! @param[in,out] f forces (body-fixed reference frame).
+      void
+      addControlForces(double speed, double z, double f[6]);
+
       //! Update ASV actiation.
       //! @param[in] id vehicle id.
       void
       updateActuation(int id);
 
     private:
+      //! Compute ASV actuation and advance actuation memory.
+      //! @param[out] xf force along the x-axis.
+      //! @param[out] nf torque along the z-axis.
+      void
+      computeAsvActuation(double& xf, double& nf);
+
       //! %ASV auxiliary memory. Stores past actuation computations.
       class ASVMemory
       {
@@ -0,0 +1,492 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Bruno Terra                                                      *
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// VSIM headers.
+#include <VSIM/Fleet.hpp>
+#include <VSIM/UUV.hpp>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Simulators
+{
+  namespace VSIM
+  {
+    //! Append a value to a set of arrays.
+    //! @param[in] arrays arrays.
+    //! @param[in] count number of arrays.
+    //! @param[in] values values to append, one per array.
+    static void
+    append(std::vector<double>* arrays, unsigned count, const double* values)
+    {
+      for (unsigned i = 0; i < count; ++i)
+        arrays[i].push_back(values[i]);
+    }
+
+    //! Retrieve the data pointers of a set of arrays. Loops index
+    //! these instead of the arrays, whose data pointers would otherwise
+    //! be reloaded after every store.
+    //! @param[in] arrays arrays.
+    //! @param[in] count number of arrays.
+    //! @param[out] data data pointers, one per array.
+    template <typename T>
+    static void
+    pointers(std::vector<double>* arrays, unsigned count, T** data)
+    {
+      for (unsigned i = 0; i < count; ++i)
+        data[i] = &arrays[i][0];
+    }
+
+    Fleet::Fleet(double tstep):
+      m_timestep(tstep)
+    { }
+
+    Fleet::~Fleet(void)
+    { }
+
+    unsigned
+    Fleet::addVehicle(Vehicle* veh)
+    {
+      veh->insertInWorld();
+      m_vehicles.push_back(veh);
+
+      append(m_state + S_X, 3, veh->m_position);
+      append(m_state + S_PHI, 3, veh->m_orientation);
+      append(m_state + S_U, 3, veh->m_linear_velocity);
+      append(m_state + S_P, 3, veh->m_angular_velocity);
+      append(m_forces, 6, veh->m_forces);
+      append(m_inertia, 6, veh->m_inertia);
+      append(m_linear_drag_coef, 10, veh->m_linear_drag_coef);
+      append(m_quad_drag_coef, 10, veh->m_quad_drag_coef);
+      m_mass.push_back(veh->m_mass);
+
+      for (unsigned i = 0; i < 3; ++i)
+      {
+        m_cos[i].push_back(0.0);
+        m_sin[i].push_back(0.0);
+      }
+
+      m_regular.push_back(veh->m_integration_method ? 1.0 : 0.0);
+
+      UUV* uuv = dynamic_cast<UUV*>(veh);
+      if (uuv != NULL)
+      {
+        append(m_added_mass_coef, 6, uuv->m_added_mass_coef);
+        append(m_body_lift_coef, 8, uuv->m_body_lift_coef);
+        m_buoyancy_z.push_back(uuv->m_buoyancy_position[2]);
+
+        if (uuv->m_volume != NULL)
+        {
+          m_volume_height.push_back(uuv->m_volume->m_height);
+          m_volume_area.push_back(uuv->m_volume->m_width * uuv->m_volume->m_length);
+        }
+        else
+        {
+          m_volume_height.push_back(0.0);
+          m_volume_area.push_back(0.0);
+        }
+
+        m_hydro.push_back(1.0);
+      }
+      else
+      {
+        double zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+        append(m_added_mass_coef, 6, zeros);
+        append(m_body_lift_coef, 8, zeros);
+        m_buoyancy_z.push_back(0.0);
+        m_volume_height.push_back(0.0);
+        m_volume_area.push_back(0.0);
+        m_hydro.push_back(0.0);
+      }
+
+      return m_vehicles.size() - 1;
+    }
+
+    void
+    Fleet::setPosition(unsigned i, double x, double y, double z)
+    {
+      m_state[S_X][i] = x;
+      m_state[S_Y][i] = y;
+      m_state[S_Z][i] = z;
+    }
+
+    void
+    Fleet::setOrientation(unsigned i, double roll, double pitch, double yaw)
+    {
+      m_state[S_PHI][i] = roll;
+      m_state[S_THETA][i] = pitch;
+      m_state[S_PSI][i] = yaw;
+    }
+
+    void
+    Fleet::stop(unsigned i)
+    {
+      for (unsigned j = S_U; j <= S_R; ++j)
+        m_state[j][i] = 0.0;
+    }
+
+    void
+    Fleet::getPosition(unsigned i, double pos[3]) const
+    {
+      for (unsigned j = 0; j < 3; ++j)
+        pos[j] = m_state[S_X + j][i];
+    }
+
+    void
+    Fleet::getOrientation(unsigned i, double ori[3]) const
+    {
+      for (unsigned j = 0; j < 3; ++j)
+        ori[j] = m_state[S_PHI + j][i];
+    }
+
+    void
+    Fleet::getLinearVelocity(unsigned i, double lv[3]) const
+    {
+      for (unsigned j = 0; j < 3; ++j)
+        lv[j] = m_state[S_U + j][i];
+    }
+
+    void
+    Fleet::getAngularVelocity(unsigned i, double av[3]) const
+    {
+      for (unsigned j = 0; j < 3; ++j)
+        av[j] = m_state[S_P + j][i];
+    }
+
+    void
+    Fleet::applyDragForces(void)
+    {
+      const unsigned n = m_vehicles.size();
+      const double* u = &m_state[S_U][0];
+      const double* v = &m_state[S_V][0];
+      const double* w = &m_state[S_W][0];
+      const double* p = &m_state[S_P][0];
+      const double* q = &m_state[S_Q][0];
+      const double* r = &m_state[S_R][0];
+      double* fx = &m_forces[0][0];
+      double* fy = &m_forces[1][0];
+      double* fz = &m_forces[2][0];
+      double* fp = &m_forces[3][0];
+      double* fq = &m_forces[4][0];
+      double* fr = &m_forces[5][0];
+      const double* ld[10];
+      const double* qd[10];
+      pointers(m_linear_drag_coef, 10, ld);
+      pointers(m_quad_drag_coef, 10, qd);
+
+      for (unsigned i = 0; i < n; ++i)
+      {
+        fx[i] = fx[i] + ld[0][i] * u[i];
+        fy[i] = fy[i] + (ld[1][i] * v[i] + ld[6][i] * r[i]);
+        fz[i] = fz[i] + (ld[2][i] * w[i] + ld[7][i] * q[i]);
+        fp[i] = fp[i] + ld[3][i] * p[i];
+        fq[i] = fq[i] + (ld[4][i] * q[i] + ld[8][i] * w[i]);
+        fr[i] = fr[i] + (ld[5][i] * r[i] + ld[9][i] * v[i]);
+      }
+
+      for (unsigned i = 0; i < n; ++i)
+      {
+        fx[i] = fx[i] + qd[0][i] * u[i] * std::fabs(u[i]);
+        fy[i] = fy[i] + (qd[1][i] * v[i] * std::fabs(v[i]) +
+                         qd[6][i] * r[i] * std::fabs(r[i]));
+        fz[i] = fz[i] + (qd[2][i] * w[i] * std::fabs(w[i]) +
+                         qd[7][i] * q[i] * std::fabs(q[i]));
+        fp[i] = fp[i] + qd[3][i] * p[i] * std::fabs(p[i]);
+        fq[i] = fq[i] + (qd[4][i] * q[i] * std::fabs(q[i]) +
+                         qd[8][i] * w[i] * std::fabs(w[i]));
+        fr[i] = fr[i] + (qd[5][i] * r[i] * std::fabs(r[i]) +
+                         qd[9][i] * v[i] * std::fabs(v[i]));
+      }
+    }
+
+    void
+    Fleet::applyControlForces(void)
+    {
+      const unsigned n = m_vehicles.size();
+      double f[6];
+
+      for (unsigned i = 0; i < n; ++i)
+      {
+        double speed = std::sqrt(std::pow(m_state[S_U][i], 2) +
+                                 std::pow(m_state[S_V][i], 2) +
+                                 std::pow(m_state[S_W][i], 2));
+
+        for (unsigned j = 0; j < 6; ++j)
+          f[j] = m_forces[j][i];
+
+        m_vehicles[i]->addControlForces(speed, m_state[S_Z][i], f);
+
+        for (unsigned j = 0; j < 6; ++j)
+          m_forces[j][i] = f[j];
+      }
+    }
+
+    void
+    Fleet::applyRestoringForcesMoments(void)
+    {
+      const unsigned n = m_vehicles.size();
+      const double* z = &m_state[S_Z][0];
+      const double* c1 = &m_cos[0][0];
+      const double* s1 = &m_sin[0][0];
+      const double* c2 = &m_cos[1][0];
+      const double* s2 = &m_sin[1][0];
+      const double* height = &m_volume_height[0];
+      const double* area = &m_volume_area[0];
+      const double* mass = &m_mass[0];
+      const double* zb = &m_buoyancy_z[0];
+      const double* hydro = &m_hydro[0];
+      double* fy = &m_forces[1][0];
+      double* fz = &m_forces[2][0];
+      double* fp = &m_forces[3][0];
+      double* fq = &m_forces[4][0];
+
+      for (unsigned i = 0; i < n; ++i)
+      {
+        // Submersed height of the volume (see Volume).
+        double h = (z[i] < (-height[i] / 2)) ? (z[i] - (height[i] / 2)) : (z[i] + (height[i] / 2));
+        h = (h <= 0) ? 0 : ((h <= height[i]) ? h : height[i]);
+
+        double B = (DUNE::Math::c_gravity * DUNE::Math::c_water_density * (area[i] * h));
+        double W = mass[i] * DUNE::Math::c_gravity;
+
+        // Neutrally buoyant in the x-axis, no moment in the z-axis.
+        fy[i] = fy[i] + hydro[i] * ((W - B) * c2[i] * s1[i]);
+        fz[i] = fz[i] + hydro[i] * ((W - B) * c2[i] * c1[i]);
+        fp[i] = fp[i] + hydro[i] * (zb[i] * W * c2[i] * s1[i]);
+        fq[i] = fq[i] + hydro[i] * (zb[i] * W * s2[i]);
+      }
+    }
+
+    void
+    Fleet::applyCoriolisForce(void)
+    {
+      const unsigned n = m_vehicles.size();
+      const double* lu = &m_state[S_U][0];
+      const double* lv = &m_state[S_V][0];
+      const double* lw = &m_state[S_W][0];
+      const double* ap = &m_state[S_P][0];
+      const double* aq = &m_state[S_Q][0];
+      const double* ar = &m_state[S_R][0];
+      const double* mass = &m_mass[0];
+      const double* zb = &m_buoyancy_z[0];
+      const double* hydro = &m_hydro[0];
+      const double* in[6];
+      const double* am[6];
+      const double* bl[8];
+      pointers(m_inertia, 6, in);
+      pointers(m_added_mass_coef, 6, am);
+      pointers(m_body_lift_coef, 8, bl);
+      double* fx = &m_forces[0][0];
+      double* fy = &m_forces[1][0];
+      double* fz = &m_forces[2][0];
+      double* fp = &m_forces[3][0];
+      double* fq = &m_forces[4][0];
+      double* fr = &m_forces[5][0];
+
+      for (unsigned i = 0; i < n; ++i)
+      {
+        // Vehicle center of gravity relative to center of buoyancy.
+        double zg = -zb[i];
+        double m = mass[i];
+        double u = lu[i], v = lv[i], w = lw[i];
+        double p = ap[i], q = aq[i], r = ar[i];
+
+        double xf = (-m * zg * r * p +
+                     -(m - am[2][i]) * w * q +
+                     +(m - am[1][i]) * v * r);
+
+        double yf = ((m - am[2][i]) * w * p +
+                     -m * zg * r * q +
+                     -(m - am[0][i]) * u * r);
+
+        double zf = (m * zg * (p * p + q * q) +
+                     -(m - am[1][i]) * v * p +
+                     +(m - am[0][i]) * u * q);
+
+        double pf = (m * zg * r * u +
+                     -(m - am[2][i]) * w * v +
+                     -(m * zg * p - (m - am[1][i]) * v) * w +
+                     -(in[2][i] - am[5][i]) * r * q +
+                     +(in[1][i] - am[4][i]) * q * r);
+
+        double qf = ((m - am[2][i]) * w * u +
+                     +m * zg * r * v +
+                     -(m * zg * q + (m - am[0][i]) * u) * w +
+                     +(in[2][i] - am[5][i]) * r * p +
+                     -(in[0][i] - am[3][i]) * p * r);
+
+        double rf = (-(m - am[1][i]) * v * u +
+                     +(m - am[0][i]) * u * v +
+                     -(in[1][i] - am[4][i]) * q * p +
+                     +(in[0][i] - am[3][i]) * p * q);
+
+        fx[i] = fx[i] + hydro[i] * xf;
+        fy[i] = fy[i] + hydro[i] * yf;
+        fz[i] = fz[i] + hydro[i] * zf;
+        fp[i] = fp[i] + hydro[i] * pf;
+        fq[i] = fq[i] + hydro[i] * qf;
+        fr[i] = fr[i] + hydro[i] * rf;
+
+        // Body lift.
+        fy[i] = fy[i] + hydro[i] * ((bl[0][i] * v + bl[1][i] * r) * u);
+        fz[i] = fz[i] + hydro[i] * ((bl[2][i] * w + bl[3][i] * q) * u);
+        fq[i] = fq[i] + hydro[i] * ((bl[4][i] * w + bl[5][i] * q) * u);
+        fr[i] = fr[i] + hydro[i] * ((bl[6][i] * v + bl[7][i] * r) * u);
+      }
+    }
+
+    void
+    Fleet::computeTrigonometry(void)
+    {
+      const unsigned n = m_vehicles.size();
+
+      for (unsigned j = 0; j < 3; ++j)
+      {
+        const double* a = &m_state[S_PHI + j][0];
+        double* c = &m_cos[j][0];
+        double* s = &m_sin[j][0];
+
+        for (unsigned i = 0; i < n; ++i)
+        {
+          c[i] = std::cos(a[i]);
+          s[i] = std::sin(a[i]);
+        }
+      }
+    }
+
+    void
+    Fleet::applyForces(void)
+    {
+      applyDragForces();
+      applyControlForces();
+      applyRestoringForcesMoments();
+      applyCoriolisForce();
+    }
+
+    void
+    Fleet::update(void)
+    {
+      const unsigned n = m_vehicles.size();
+      const double ts = m_timestep;
+
+      double* pos[3] = {&m_state[S_X][0], &m_state[S_Y][0], &m_state[S_Z][0]};
+      double* ori[3] = {&m_state[S_PHI][0], &m_state[S_THETA][0], &m_state[S_PSI][0]};
+      double* lvel[3] = {&m_state[S_U][0], &m_state[S_V][0], &m_state[S_W][0]};
+      double* avel[3] = {&m_state[S_P][0], &m_state[S_Q][0], &m_state[S_R][0]};
+      const double* regular = &m_regular[0];
+      const double* in[6];
+      double* f[6];
+      pointers(m_inertia, 6, in);
+      pointers(m_forces, 6, f);
+
+      const double* cs[3];
+      const double* sn[3];
+      pointers(m_cos, 3, cs);
+      pointers(m_sin, 3, sn);
+
+      for (unsigned i = 0; i < n; ++i)
+      {
+        double c1 = cs[0][i];
+        double c2 = cs[1][i];
+        double c3 = cs[2][i];
+
+        double s1 = sn[0][i];
+        double s2 = sn[1][i];
+        double s3 = sn[2][i];
+
+        double t2 = std::tan(ori[1][i]);
+
+        double u = lvel[0][i];
+        double v = lvel[1][i];
+        double w = lvel[2][i];
+        double p = avel[0][i];
+        double q = avel[1][i];
+        double r = avel[2][i];
+
+        double d_pos[6];
+        double d_vel[6];
+
+        // Accelerations.
+        for (unsigned j = 0; j < 6; ++j)
+        {
+          d_vel[j] = f[j][i] / in[j][i];
+          f[j][i] = 0.0;
+        }
+
+        // Velocities in the inertial frame (see Object::update).
+        d_pos[0] = (c3 * c2) * u + (c3 * s2 * s1 - s3 * c1) * v + (s3 * s1 + c3 * c1 * s2) * w;
+        d_pos[1] = (s3 * c2) * u + (c1 * c3 + s1 * s2 * s3) * v + (c1 * s2 * s3 - c3 * s1) * w;
+        d_pos[2] = (-s2) * u + (c2 * s1) * v + (c1 * c2) * w;
+        d_pos[3] = p + (s1 * t2) * q + (c1 * t2) * r;
+        d_pos[4] = c1 * q + (-s1) * r;
+        d_pos[5] = (s1 / c2) * q + (c1 / c2) * r;
+
+        // Integrate using Euler's method.
+        for (unsigned j = 0; j < 3; ++j)
+        {
+          pos[j][i] += d_pos[j] * ts;
+          ori[j][i] += DUNE::Math::Angles::minSignedAngle(ori[j][i], ori[j][i] + d_pos[j + 3] * ts);
+
+          if (regular[i] != 0.0)
+          {
+            lvel[j][i] += d_vel[j] * ts;
+            avel[j][i] = avel[j][i] + d_vel[j + 3] * ts;
+          }
+          else
+          {
+            // ASV integration.
+            lvel[j][i] = d_vel[j];
+            avel[j][i] = d_vel[j + 3];
+          }
+        }
+
+        if (pos[2][i] <= 0.0)
+          pos[2][i] = 0.0;
+      }
+    }
+
+    void
+    Fleet::takeStep(void)
+    {
+      if (m_vehicles.empty())
+        return;
+
+      // Orientation terms shared by forces and integration.
+      computeTrigonometry();
+
+      // Apply forces to vehicles.
+      applyForces();
+
+      // Update vehicles state.
+      update();
+    }
+  }
+}
@@ -0,0 +1,231 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Bruno Terra                                                      *
+
+#ifndef SIMULATORS_VSIM_VSIM_FLEET_HPP_INCLUDED_
+#define SIMULATORS_VSIM_VSIM_FLEET_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// VSIM headers.
+#include <VSIM/Vehicle.hpp>
+
+namespace Simulators
+{
+  namespace VSIM
+  {
+    //! %Fleet of vehicles stepped together. The state, forces and
+    //! model coefficients of all vehicles are kept in one array per
+    //! quantity (structure of arrays) and every stage of a step runs
+    //! as a single loop over the whole fleet. The equations are the
+    //! ones of Object, Vehicle and UUV; the vehicles themselves only
+    //! supply their actuation forces.
+    class Fleet
+    {
+    public:
+      //! Constructor.
+      //! @param[in] tstep integration timestep.
+      Fleet(double tstep);
+
+      //! Destructor.
+      ~Fleet(void);
+
+      //! Define fleet's integration timestep.
+      //! @param[in] ts integration timestep.
+      void
+      setTimeStep(double ts)
+      {
+        m_timestep = ts;
+      }
+
+      //! Returns fleet's integration timestep.
+      //! @return fleet integration timestep.
+      double
+      getTimeStep(void)
+      {
+        return m_timestep;
+      }
+
+      //! Add vehicle to fleet. The vehicle's mass properties, drag
+      //! and hydrostatic coefficients and current state are copied
+      //! into the fleet, which is responsible for its motion from
+      //! then on. The vehicle is not owned by the fleet.
+      //! @param[in] veh new vehicle.
+      //! @return index of the vehicle in the fleet.
+      unsigned
+      addVehicle(Vehicle* veh);
+
+      //! Retrieve number of vehicles.
+      //! @return number of vehicles.
+      unsigned
+      size(void) const
+      {
+        return m_vehicles.size();
+      }
+
+      //! Retrieve a vehicle.
+      //! @param[in] i vehicle index.
+      //! @return vehicle.
+      Vehicle*
+      getVehicle(unsigned i)
+      {
+        return m_vehicles[i];
+      }
+
+      //! Define vehicle inertial position.
+      //! @param[in] i vehicle index.
+      //! @param[in] x position in the x-axis.
+      //! @param[in] y position in the y-axis.
+      //! @param[in] z position in the z-axis.
+      void
+      setPosition(unsigned i, double x, double y, double z);
+
+      //! Define vehicle inertial orientation.
+      //! @param[in] i vehicle index.
+      //! @param[in] roll roll orientation.
+      //! @param[in] pitch pitch orientation.
+      //! @param[in] yaw yaw orientation.
+      void
+      setOrientation(unsigned i, double roll, double pitch, double yaw);
+
+      //! Stop a vehicle (zero linear and angular velocities).
+      //! @param[in] i vehicle index.
+      void
+      stop(unsigned i);
+
+      //! Retrieve vehicle position [X,Y,Z].
+      //! @param[in] i vehicle index.
+      //! @param[out] pos position.
+      void
+      getPosition(unsigned i, double pos[3]) const;
+
+      //! Retrieve vehicle orientation [roll, pitch, yaw].
+      //! @param[in] i vehicle index.
+      //! @param[out] ori orientation.
+      void
+      getOrientation(unsigned i, double ori[3]) const;
+
+      //! Retrieve vehicle linear velocity (body-fixed reference frame).
+      //! @param[in] i vehicle index.
+      //! @param[out] lv linear velocity.
+      void
+      getLinearVelocity(unsigned i, double lv[3]) const;
+
+      //! Retrieve vehicle angular velocity (body-fixed reference frame).
+      //! @param[in] i vehicle index.
+      //! @param[out] av angular velocity.
+      void
+      getAngularVelocity(unsigned i, double av[3]) const;
+
+      //! Simulation's tick.
+      void
+      takeStep(void);
+
+    private:
+      //! State quantities.
+      enum State
+      {
+        //! Position.
+        S_X, S_Y, S_Z,
+        //! Orientation.
+        S_PHI, S_THETA, S_PSI,
+        //! Linear velocity.
+        S_U, S_V, S_W,
+        //! Angular velocity.
+        S_P, S_Q, S_R,
+        //! Number of state quantities.
+        S_COUNT
+      };
+
+      //! Computes cosine and sine of all orientations.
+      void
+      computeTrigonometry(void);
+
+      //! Applies forces to all vehicles.
+      void
+      applyForces(void);
+
+      //! Applies actuation forces of all vehicles.
+      void
+      applyControlForces(void);
+
+      //! Applies drag forces of all vehicles.
+      void
+      applyDragForces(void);
+
+      //! Applies restoring forces and moments of underwater vehicles.
+      void
+      applyRestoringForcesMoments(void);
+
+      //! Applies Coriolis forces and body lift of underwater vehicles.
+      void
+      applyCoriolisForce(void);
+
+      //! Integrates the state of all vehicles.
+      void
+      update(void);
+
+      //! Fleet's vehicles.
+      std::vector<Vehicle*> m_vehicles;
+      //! State, one array per quantity.
+      std::vector<double> m_state[S_COUNT];
+      //! Cosine of orientation, valid during a step.
+      std::vector<double> m_cos[3];
+      //! Sine of orientation, valid during a step.
+      std::vector<double> m_sin[3];
+      //! Forces (body-fixed reference frame).
+      std::vector<double> m_forces[6];
+      //! Mass.
+      std::vector<double> m_mass;
+      //! Inertia matrix diagonal.
+      std::vector<double> m_inertia[6];
+      //! Linear drag coefficients.
+      std::vector<double> m_linear_drag_coef[10];
+      //! Quadratic drag coefficients.
+      std::vector<double> m_quad_drag_coef[10];
+      //! Added mass coefficients.
+      std::vector<double> m_added_mass_coef[6];
+      //! Body lift coefficients.
+      std::vector<double> m_body_lift_coef[8];
+      //! Buoyancy position in the z-axis.
+      std::vector<double> m_buoyancy_z;
+      //! Height of the displaced volume.
+      std::vector<double> m_volume_height;
+      //! Horizontal area of the displaced volume.
+      std::vector<double> m_volume_area;
+      //! One for underwater vehicles, zero otherwise.
+      std::vector<double> m_hydro;
+      //! One for regular velocity integration, zero for ASV integration.
+      std::vector<double> m_regular;
+      //! Integration timestep.
+      double m_timestep;
+    };
+  }
+}
+
+#endif
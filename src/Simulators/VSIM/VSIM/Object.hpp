@@ -179,6 +179,9 @@ namespace Simulators
       double m_angular_velocity[3];
 
     private:
+      //! Fleets step objects with their own copy of the state.
+      friend class Fleet;
+
       //! Object id.
       int m_body_id;
       //! Object type.
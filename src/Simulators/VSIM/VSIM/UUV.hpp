@@ -98,6 +98,9 @@ namespace Simulators
       applyCoriolisForce(void);
 
     private:
+      //! Fleets step vehicles with their own copy of the model.
+      friend class Fleet;
+
       //! Applies vehicle specific force (buoyancy).
       void
       applyRestoringForcesMoments(void);
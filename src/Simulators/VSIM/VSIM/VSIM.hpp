@@ -41,6 +41,7 @@ namespace Simulators
 #include <VSIM/ASV.hpp>
 #include <VSIM/Engine.hpp>
 #include <VSIM/Fin.hpp>
+#include <VSIM/Fleet.hpp>
 #include <VSIM/Force.hpp>
 #include <VSIM/Object.hpp>
 #include <VSIM/UUV.hpp>
@@ -86,6 +86,27 @@ namespace Simulators
       }
     }
 
+    void
+    Vehicle::addControlForces(double speed, double z, double f[6])
+    {
+      double af[6];
+
+      for (std::list<Force*>::iterator itr = m_vehicle_forces.begin(); itr != m_vehicle_forces.end(); ++itr)
+      {
+        for (unsigned i = 0; i < 6; i++)
+          af[i] = 0.0;
+
+        (*itr)->applyForce(speed, af);
+
+        // See applyControlForces().
+        if (z <= 0.0)
+          af[2] = 0;
+
+        for (unsigned i = 0; i < 6; i++)
+          f[i] = f[i] + af[i];
+      }
+    }
+
     void
     Vehicle::applyForces(void)
     {
@@ -68,6 +68,13 @@ namespace Simulators
       void
       applyControlForces(void);
 
+      //! Add vehicle actuation forces to a force vector.
+      //! @param[in] speed vehicle speed.
+      //! @param[in] z vehicle position in the z-axis.
+      //! @param[in,out] f forces (body-fixed reference frame).
+      virtual void
+      addControlForces(double speed, double z, double f[6]);
+
       //! Applies all vehicle's forces.
       void
       applyForces(void);
@@ -54,6 +54,9 @@ namespace Simulators
       sub_volume(double depth);
 
     private:
+      //! Fleets use the volume dimensions directly.
+      friend class Fleet;
+
       //! Get submersed z component.
       //! @param[in] depth depth of the submersed part.
       //! @return submersed height of the volume (z coordinate).
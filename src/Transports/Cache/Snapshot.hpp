@@ -0,0 +1,359 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef TRANSPORTS_CACHE_SNAPSHOT_HPP_INCLUDED_
+#define TRANSPORTS_CACHE_SNAPSHOT_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// POSIX headers.
+#if defined(DUNE_SYS_HAS_FSYNC)
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+namespace Transports
+{
+  namespace Cache
+  {
+    using DUNE_NAMESPACES;
+
+    //! Snapshot of the cached messages, kept as an append-only
+    //! journal of IMC packets. Each stored message is appended to the
+    //! journal, and the journal is rewritten with only the latest
+    //! packet of each message once it grows past twice the size of
+    //! the cached messages. A journal cut short by a crash still
+    //! starts with valid packets, which are recovered when it is
+    //! loaded. Writes are synchronized to disk, and a failed
+    //! compaction leaves the previous journal in place.
+    class Snapshot
+    {
+    public:
+      //! Journal size, in bytes, below which no compaction is done.
+      static const uint64_t c_min_compaction_size = 64 * 1024;
+
+      //! Constructor.
+      //! @param[in] path journal file.
+      Snapshot(const Path& path):
+        m_path(path),
+        m_live_size(0),
+        m_size(0),
+        m_written(0)
+      { }
+
+      //! Set the order in which messages are stored by compaction
+      //! and returned by getMessages().
+      //! @param[in] order list of message names, messages not in the
+      //! list come afterwards.
+      void
+      setOrder(const std::vector<std::string>& order)
+      {
+        m_order = order;
+      }
+
+      //! Read the journal, keeping the latest packet of each message.
+      //! Reading stops at the first invalid packet and the journal is
+      //! compacted if it held stale or invalid data.
+      //! @return false if there is no journal, true otherwise.
+      bool
+      load(void)
+      {
+        m_journal.close();
+        m_entries.clear();
+        m_live_size = 0;
+        m_size = 0;
+
+        if (m_path.type() != Path::PT_FILE)
+          return false;
+
+        uint64_t valid = 0;
+
+        {
+          std::ifstream ifs(m_path.c_str(), std::ios::binary);
+          IMC::PacketReader reader(ifs);
+          IMC::Header hdr;
+          const uint8_t* data = NULL;
+          unsigned size = 0;
+
+          try
+          {
+            while (reader.nextPacket(hdr, data, size))
+            {
+              IMC::PacketReader::validate(hdr, data);
+              IMC::Message* msg = IMC::Packet::deserialize(data, size);
+              update(msg->getName(), msg->getSubId(), data, size);
+              delete msg;
+              valid += size;
+            }
+          }
+          catch (std::exception&)
+          { }
+        }
+
+        m_size = valid;
+        if (valid != (uint64_t)m_path.size() || m_size != m_live_size)
+          compact();
+
+        return true;
+      }
+
+      //! Append a message to the journal.
+      //! @param[in] msg message.
+      //! @throw std::runtime_error if the journal could not be
+      //! written.
+      void
+      store(const IMC::Message* msg)
+      {
+        unsigned size = msg->getSerializationSize();
+        m_bfr.resize(size);
+        IMC::Packet::serialize(msg, &m_bfr[0], size);
+        update(msg->getName(), msg->getSubId(), &m_bfr[0], size);
+
+        if (m_size + size > std::max(2 * m_live_size, c_min_compaction_size))
+        {
+          compact();
+          return;
+        }
+
+        if (!m_journal.is_open())
+          m_journal.open(m_path.c_str(), std::ios::binary | std::ios::app);
+
+        m_journal.write((const char*)&m_bfr[0], size);
+        m_journal.flush();
+
+        if (!m_journal.good() || !sync(m_path.str()))
+        {
+          // Reopen on the next store, the journal is cut short at the
+          // last valid packet when loaded.
+          m_journal.close();
+          m_journal.clear();
+          throw std::runtime_error(DTR("failed to append to cache snapshot"));
+        }
+
+        m_size += size;
+        m_written += size;
+      }
+
+      //! Rewrite the journal with the latest packet of each message.
+      //! The new journal is synchronized to disk and then replaces
+      //! the old one atomically.
+      //! @throw std::runtime_error if the new journal could not be
+      //! written, in which case the old journal is kept.
+      void
+      compact(void)
+      {
+        m_journal.close();
+
+        std::string tmp = m_path.str() + ".tmp";
+        bool ok = false;
+
+        {
+          std::ofstream ofs(tmp.c_str(), std::ios::binary | std::ios::trunc);
+          std::vector<const Bytes*> packets;
+          getPackets(packets);
+
+          for (unsigned i = 0; i < packets.size(); ++i)
+            ofs.write((const char*)&(*packets[i])[0], packets[i]->size());
+
+          ofs.close();
+          ok = ofs.good();
+        }
+
+        if (!ok || !sync(tmp))
+        {
+          std::remove(tmp.c_str());
+          throw std::runtime_error(DTR("failed to write cache snapshot"));
+        }
+
+#if defined(DUNE_OS_WINDOWS)
+        std::remove(m_path.c_str());
+#endif
+
+        if (std::rename(tmp.c_str(), m_path.c_str()) != 0)
+        {
+          std::remove(tmp.c_str());
+          throw std::runtime_error(DTR("failed to replace cache snapshot"));
+        }
+
+        // Make the rename itself durable.
+        sync(m_path.dirname().str());
+
+        m_size = m_live_size;
+        m_written += m_live_size;
+      }
+
+      //! Forget all messages and remove the journal.
+      void
+      clear(void)
+      {
+        m_journal.close();
+        m_entries.clear();
+        m_live_size = 0;
+        m_size = 0;
+
+        if (m_path.exists())
+          m_path.remove();
+      }
+
+      //! Deserialize the latest instance of each message.
+      //! @param[out] msgs messages, to be deleted by the caller.
+      void
+      getMessages(std::vector<IMC::Message*>& msgs) const
+      {
+        std::vector<const Bytes*> packets;
+        getPackets(packets);
+
+        for (unsigned i = 0; i < packets.size(); ++i)
+          msgs.push_back(IMC::Packet::deserialize(&(*packets[i])[0], packets[i]->size()));
+      }
+
+      //! Get the number of bytes written to disk so far.
+      //! @return number of bytes.
+      uint64_t
+      getBytesWritten(void) const
+      {
+        return m_written;
+      }
+
+      //! Get the current size of the journal.
+      //! @return size in bytes.
+      uint64_t
+      getSize(void) const
+      {
+        return m_size;
+      }
+
+    private:
+      //! Serialized packet.
+      typedef std::vector<uint8_t> Bytes;
+      //! Latest packets by message sub-identifier.
+      typedef std::map<unsigned, Bytes> Instances;
+      //! Latest packets by message name.
+      typedef std::map<std::string, Instances> Entries;
+
+      //! Journal file.
+      Path m_path;
+      //! Journal output stream.
+      std::ofstream m_journal;
+      //! Message order.
+      std::vector<std::string> m_order;
+      //! Latest packets.
+      Entries m_entries;
+      //! Size of the latest packets.
+      uint64_t m_live_size;
+      //! Size of the journal.
+      uint64_t m_size;
+      //! Bytes written to disk.
+      uint64_t m_written;
+      //! Serialization buffer.
+      Bytes m_bfr;
+
+      //! Synchronize a file or directory to disk.
+      //! @param[in] path file or directory.
+      //! @return true on success, false otherwise.
+      static bool
+      sync(const std::string& path)
+      {
+#if defined(DUNE_SYS_HAS_FSYNC)
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+          return false;
+
+        bool ok = (::fsync(fd) == 0);
+        ::close(fd);
+        return ok;
+#else
+        (void)path;
+        return true;
+#endif
+      }
+
+      //! Replace the latest packet of a message.
+      //! @param[in] name message name.
+      //! @param[in] subid message sub-identifier.
+      //! @param[in] data serialized packet.
+      //! @param[in] size packet size.
+      void
+      update(const std::string& name, unsigned subid, const uint8_t* data, unsigned size)
+      {
+        Bytes& pkt = m_entries[name][subid];
+        m_live_size -= pkt.size();
+        pkt.assign(data, data + size);
+        m_live_size += size;
+      }
+
+      //! Get the latest packets in loading order.
+      //! @param[out] packets packets.
+      void
+      getPackets(std::vector<const Bytes*>& packets) const
+      {
+        for (unsigned i = 0; i < m_order.size(); ++i)
+        {
+          Entries::const_iterator itr = m_entries.find(m_order[i]);
+          if (itr != m_entries.end())
+            getPackets(itr->second, packets);
+        }
+
+        for (Entries::const_iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr)
+        {
+          if (std::find(m_order.begin(), m_order.end(), itr->first) == m_order.end())
+            getPackets(itr->second, packets);
+        }
+      }
+
+      //! Get the latest packets of a message.
+      //! @param[in] instances latest packets by sub-identifier.
+      //! @param[out] packets packets.
+      static void
+      getPackets(const Instances& instances, std::vector<const Bytes*>& packets)
+      {
+        for (Instances::const_iterator itr = instances.begin(); itr != instances.end(); ++itr)
+          packets.push_back(&itr->second);
+      }
+
+      // Non-copyable.
+      Snapshot(const Snapshot&);
+
+      // Non-assignable.
+      Snapshot&
+      operator=(const Snapshot&);
+    };
+  }
+}
+
+#endif
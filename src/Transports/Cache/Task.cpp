@@ -36,6 +36,9 @@
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// Local headers.
+#include "Snapshot.hpp"
+
 namespace Transports
 {
   namespace Cache
@@ -54,6 +57,8 @@ namespace Transports
       Path m_path;
       // Path to snapshot file.
       Path m_snapshot;
+      // Snapshot journal.
+      Snapshot* m_journal;
       // Internal buffer.
       uint8_t* m_buffer;
       // Internal buffer size.
@@ -79,6 +84,7 @@ namespace Transports
 
         // Set snapshot file path.
         m_snapshot = m_path / (std::string(DUNE_IMC_CONST_MD5) + ".lsf");
+        m_journal = new Snapshot(m_snapshot);
 
         // Bind messages.
         bind<IMC::CacheControl>(this);
@@ -86,9 +92,16 @@ namespace Transports
 
       ~Task(void)
       {
+        delete m_journal;
         delete [] m_buffer;
       }
 
+      void
+      onUpdateParameters(void)
+      {
+        m_journal->setOrder(m_args.order);
+      }
+
       void
       onResourceInitialization(void)
       {
@@ -188,56 +201,41 @@ namespace Transports
         ofs.write((char*)m_buffer, size);
         ofs.close();
 
-        storeSnapshot();
+        try
+        {
+          m_journal->store(msg);
+        }
+        catch (std::exception& e)
+        {
+          err(DTR("failed to store cache snapshot: %s"), e.what());
+        }
       }
 
       void
       loadSnapshot(void)
       {
-        if (m_snapshot.type() != Path::PT_FILE)
-        {
-          clear();
-          return;
-        }
-
-        std::ifstream ifs(m_snapshot.c_str(), std::ios::binary);
+        std::vector<IMC::Message*> msgs;
 
-        if (!ifs.is_open())
-          return;
-
-        while (!ifs.eof())
+        try
         {
-          IMC::Message* msg = IMC::Packet::deserialize(ifs);
-          if (msg)
+          if (!m_journal->load())
           {
-            dispatch(msg, DF_KEEP_TIME);
-            delete msg;
+            clear();
+            return;
           }
         }
-      }
-
-      void
-      storeSnapshot(void)
-      {
-        // Retrieve file list.
-        std::vector<std::string> files;
-        getMessageFiles(files);
-
-        std::ofstream ofs(m_snapshot.c_str(), std::ios::binary);
-
-        // Copy all cached messages to a single file.
-        for (unsigned int i = 0; i < files.size(); ++i)
+        catch (std::exception& e)
         {
-          int64_t size = Path(files[i]).size();
-
-          if (size < 0)
-            continue;
+          // Messages read before the failure are still dispatched.
+          err(DTR("failed to load cache snapshot: %s"), e.what());
+        }
 
-          growBuffer(size);
+        m_journal->getMessages(msgs);
 
-          std::ifstream ifs(files[i].c_str(), std::ios::binary);
-          ifs.read((char*)m_buffer, size);
-          ofs.write((char*)m_buffer, size);
+        for (unsigned int i = 0; i < msgs.size(); ++i)
+        {
+          dispatch(msgs[i], DF_KEEP_TIME);
+          delete msgs[i];
         }
       }
 
@@ -249,13 +247,14 @@ namespace Transports
 
         try
         {
+          m_journal->compact();
           Path(m_snapshot).copy(destination);
           IMC::CacheControl cc;
           cc.op = IMC::CacheControl::COP_COPY_COMPLETE;
           cc.snapshot = destination.str();
           dispatch(cc);
         }
-        catch (System::Error& e)
+        catch (std::exception& e)
         {
           err(DTR("failed to copy cache snapshot: %s"), e.what());
         }
@@ -283,6 +282,7 @@ namespace Transports
       clear(void)
       {
         // Remove cache directory and create a new one.
+        m_journal->clear();
         m_path.remove(Path::MODE_RECURSIVE);
         m_path.create();
       }
@@ -24,94 +24,89 @@
 // https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
 // http://ec.europa.eu/idabc/eupl.html.                                     *
 //***************************************************************************
-// Author: Eduardo Marques                                                  *
+// Author: Ricardo Martins                                                  *
 //***************************************************************************
 
-#ifndef SIMULATORS_ENVIRONMENT_QUAD_TREE_HPP_INCLUDED_
-#define SIMULATORS_ENVIRONMENT_QUAD_TREE_HPP_INCLUDED_
-
-// ISO C++ 98 headers.
-#include <iomanip>
-#include <iostream>
-#include <vector>
+#ifndef TRANSPORTS_HTTP_DOCUMENT_HPP_INCLUDED_
+#define TRANSPORTS_HTTP_DOCUMENT_HPP_INCLUDED_
 
 // DUNE headers.
-#include <DUNE/Config.hpp>
-
-// Local headers.
-#include "Point.hpp"
-#include "Bounds.hpp"
+#include <DUNE/DUNE.hpp>
 
-namespace Simulators
+namespace Transports
 {
-  namespace Environment
+  namespace HTTP
   {
-    //! Forward declaration.
-    struct Node;
-
-    //! "Quad-tree" structure used to index spatial data in two dimensions.
-    class QuadTree
+    //! Immutable, reference-counted document served to HTTP clients.
+    //! A document is filled once before being published; afterwards
+    //! every holder must call acquire() before storing a pointer to
+    //! it and release() when done with it.
+    class Document
     {
     public:
-      //! Item datum.
-      struct Item
+      //! Create an empty document. The caller holds the first
+      //! reference.
+      Document(void):
+        m_refs(1)
+      { }
+
+      //! Retrieve the buffer used to fill the document.
+      //! @return document buffer.
+      DUNE::Utils::ByteBuffer&
+      getBuffer(void)
       {
-        double x, y, value;
-      };
+        return m_bfr;
+      }
 
-      //! Iteration handle.
-      class Iteration
+      //! Retrieve the document data.
+      //! @return document data.
+      const char*
+      getData(void)
       {
-      public:
-        virtual void
-        process(const Item& item) = 0;
-
-        virtual
-        ~Iteration(){ }
-      };
+        return m_bfr.getBufferSigned();
+      }
 
-      //! Constructor.
-      QuadTree(const Bounds& bounds);
-
-      ~QuadTree();
-
-      //! Insert an item.
-      //! Returns 'false' if item is out-of-bounds.
-      bool
-      insert(const Item& item);
-
-      //! Iterate tree.
-      void
-      iterate(Iteration& iteration) const;
+      //! Retrieve the size of the document.
+      //! @return document size.
+      unsigned
+      getSize(void)
+      {
+        return m_bfr.getSize();
+      }
 
-      //! Iterate tree over a given area.
+      //! Add a reference to this object.
       void
-      iterate(Iteration& iteration, const Bounds& area) const;
+      acquire(void)
+      {
+        m_refs.add(1);
+      }
 
-      //! Clear entire tree.
+      //! Drop a reference to this object, destroying it if this
+      //! was the last one.
       void
-      clear(void);
+      release(void)
+      {
+        if (m_refs.sub(1) == 0)
+          delete this;
+      }
 
-      //! Remove items in a given area.
-      void
-      remove(const Bounds& area);
+    private:
+      //! Document data.
+      DUNE::Utils::ByteBuffer m_bfr;
+      //! Reference count.
+      DUNE::Concurrency::AtomicCounter m_refs;
 
-      //! Search for items in a given area.
-      //! If any are found returns 'true' and adds results to 'item' vector.
-      bool
-      search(const Bounds& area, std::vector<Item>& items) const;
+      //! Destructor is private, use release().
+      ~Document(void)
+      { }
 
-      //! Get number of elements in a given area.
-      uint32_t
-      size(const Bounds& area) const;
+      //! Non - copyable.
+      Document(const Document&);
 
-    private:
-      Bounds m_bounds;     //!< Bounds.
-      Node* m_root;     //!< Node handle providing actual implementation.
+      //! Non - assignable.
+      Document&
+      operator=(const Document&);
     };
-
-    std::ostream&
-    operator<<(std::ostream& os, const QuadTree& tree);
   }
 }
 
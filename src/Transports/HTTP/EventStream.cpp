@@ -0,0 +1,227 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "EventStream.hpp"
+
+namespace Transports
+{
+  namespace HTTP
+  {
+    using DUNE_NAMESPACES;
+
+    //! Time after which a client that does not accept data is dropped.
+    static const double c_stall_timeout = 30.0;
+
+    EventStream::EventStream(MessageMonitor& monitor, unsigned max_clients, double max_rate, double keep_alive):
+      m_monitor(monitor),
+      m_max_clients(max_clients),
+      m_period(1.0 / max_rate),
+      m_keep_alive(keep_alive),
+      m_count(0)
+    { }
+
+    EventStream::~EventStream(void)
+    {
+      for (std::list<Client>::iterator itr = m_clients.begin(); itr != m_clients.end(); ++itr)
+        delete itr->sock;
+
+      for (unsigned i = 0; i < m_incoming.size(); ++i)
+        delete m_incoming[i].sock;
+    }
+
+    bool
+    EventStream::isFull(void)
+    {
+      ScopedMutex l(m_mutex);
+      return m_count >= m_max_clients;
+    }
+
+    bool
+    EventStream::add(TCPSocket* sock, const std::set<unsigned>& ids, double rate)
+    {
+      ScopedMutex l(m_mutex);
+
+      if (m_count >= m_max_clients)
+        return false;
+
+      Client client;
+      client.sock = sock;
+      client.ids = ids;
+      client.period = m_period;
+      if (rate > 0)
+        client.period = std::max(m_period, 1.0 / rate);
+      client.last_update = 0;
+      client.last_write = Clock::get();
+      client.seq = 0;
+      client.closed = false;
+
+      m_incoming.push_back(client);
+      ++m_count;
+      return true;
+    }
+
+    void
+    EventStream::run(void)
+    {
+      uint8_t bfr[256];
+
+      while (!isStopping())
+      {
+        acceptClients();
+
+        // Clients are not expected to send anything, wait for one tick
+        // and detect closed connections.
+        if (m_poll.poll(m_period))
+        {
+          for (std::list<Client>::iterator itr = m_clients.begin(); itr != m_clients.end(); ++itr)
+          {
+            if (!m_poll.wasTriggered(*itr->sock))
+              continue;
+
+            try
+            {
+              itr->sock->read(bfr, sizeof(bfr));
+            }
+            catch (...)
+            {
+              itr->closed = true;
+            }
+          }
+        }
+
+        if (m_clients.empty())
+          continue;
+
+        m_monitor.update();
+
+        double now = Clock::get();
+        std::list<Client>::iterator itr = m_clients.begin();
+        while (itr != m_clients.end())
+        {
+          if (service(*itr, now))
+          {
+            ++itr;
+            continue;
+          }
+
+          m_poll.remove(*itr->sock);
+          delete itr->sock;
+          itr = m_clients.erase(itr);
+
+          ScopedMutex l(m_mutex);
+          --m_count;
+        }
+      }
+    }
+
+    void
+    EventStream::acceptClients(void)
+    {
+      ScopedMutex l(m_mutex);
+
+      for (unsigned i = 0; i < m_incoming.size(); ++i)
+      {
+        m_incoming[i].sock->setNonBlocking(true);
+        m_poll.add(*m_incoming[i].sock);
+        m_clients.push_back(m_incoming[i]);
+      }
+
+      m_incoming.clear();
+    }
+
+    bool
+    EventStream::service(Client& client, double now)
+    {
+      if (client.closed || (now - client.last_write) > c_stall_timeout)
+        return false;
+
+      // Changes are only collected when the previous batch was fully
+      // written, so slow clients receive the latest state instead of a
+      // growing backlog.
+      if (client.out.empty() && (now - client.last_update) >= client.period)
+      {
+        std::vector<std::string> changes;
+        client.seq = m_monitor.getChanges(client.seq, client.ids, changes);
+
+        for (unsigned i = 0; i < changes.size(); ++i)
+          appendEvent(client.out, changes[i]);
+
+        if (!changes.empty())
+          client.last_update = now;
+      }
+
+      if (client.out.empty() && (now - client.last_write) >= m_keep_alive)
+        client.out = ":\n\n";
+
+      if (client.out.empty())
+        return true;
+
+      try
+      {
+        size_t rv = client.sock->write(client.out.c_str(), client.out.size());
+        if (rv > 0)
+        {
+          client.out.erase(0, rv);
+          client.last_write = now;
+        }
+      }
+      catch (...)
+      {
+        return false;
+      }
+
+      return true;
+    }
+
+    void
+    EventStream::appendEvent(std::string& out, const std::string& json)
+    {
+      size_t size = json.size();
+      if (size > 0 && json[size - 1] == '\n')
+        --size;
+
+      out.append("data: ");
+
+      for (size_t i = 0; i < size; ++i)
+      {
+        if (json[i] == '\n')
+          out.append("\ndata: ");
+        else
+          out.push_back(json[i]);
+      }
+
+      out.append("\n\n");
+    }
+  }
+}
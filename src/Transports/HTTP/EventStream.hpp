@@ -0,0 +1,148 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+#ifndef TRANSPORTS_HTTP_EVENT_STREAM_HPP_INCLUDED_
+#define TRANSPORTS_HTTP_EVENT_STREAM_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <list>
+#include <set>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "MessageMonitor.hpp"
+
+namespace Transports
+{
+  namespace HTTP
+  {
+    //! Server-sent events stream. Clients receive the current state
+    //! of all monitored messages when they connect and afterwards only
+    //! the messages that changed, at most once per client period.
+    class EventStream: public DUNE::Concurrency::Thread
+    {
+    public:
+      //! Constructor.
+      //! @param[in] monitor message monitor.
+      //! @param[in] max_clients maximum number of clients.
+      //! @param[in] max_rate maximum update rate per client (Hz).
+      //! @param[in] keep_alive period of keep-alive comments (s).
+      EventStream(MessageMonitor& monitor, unsigned max_clients, double max_rate, double keep_alive);
+
+      //! Destructor.
+      ~EventStream(void);
+
+      //! Test if the maximum number of clients was reached.
+      //! @return true if no more clients are accepted, false
+      //! otherwise.
+      bool
+      isFull(void);
+
+      //! Add a client. The response header must already have been
+      //! sent.
+      //! @param[in] sock client socket.
+      //! @param[in] ids identifiers of the messages of interest,
+      //! empty for all messages.
+      //! @param[in] rate requested update rate (Hz), zero for the
+      //! maximum rate.
+      //! @return true if the stream took ownership of the socket,
+      //! false if the maximum number of clients was reached.
+      bool
+      add(DUNE::Network::TCPSocket* sock, const std::set<unsigned>& ids, double rate);
+
+    private:
+      //! Stream client.
+      struct Client
+      {
+        //! Client socket.
+        DUNE::Network::TCPSocket* sock;
+        //! Identifiers of the messages of interest.
+        std::set<unsigned> ids;
+        //! Minimum time between updates.
+        double period;
+        //! Time of the last update.
+        double last_update;
+        //! Time of the last successful write.
+        double last_write;
+        //! Sequence number of the last change sent.
+        uint64_t seq;
+        //! Data waiting to be written.
+        std::string out;
+        //! True if the connection was closed by the client.
+        bool closed;
+      };
+
+      //! Message monitor.
+      MessageMonitor& m_monitor;
+      //! Maximum number of clients.
+      unsigned m_max_clients;
+      //! Minimum time between updates.
+      double m_period;
+      //! Period of keep-alive comments.
+      double m_keep_alive;
+      //! Protects new clients and client count.
+      DUNE::Concurrency::Mutex m_mutex;
+      //! Clients waiting to be serviced.
+      std::vector<Client> m_incoming;
+      //! Number of clients.
+      unsigned m_count;
+      //! Serviced clients.
+      std::list<Client> m_clients;
+      //! I/O multiplexing.
+      DUNE::IO::Poll m_poll;
+
+      void
+      run(void);
+
+      //! Start servicing new clients.
+      void
+      acceptClients(void);
+
+      //! Send pending changes to a client.
+      //! @param[in] client stream client.
+      //! @param[in] now current time.
+      //! @return true if the client is still alive, false otherwise.
+      bool
+      service(Client& client, double now);
+
+      //! Append a message to a client's output as one event.
+      //! @param[in] out client output.
+      //! @param[in] json JSON representation of the message.
+      static void
+      appendEvent(std::string& out, const std::string& json);
+    };
+  }
+}
+
+#endif
@@ -40,8 +40,13 @@ namespace Transports
     using DUNE_NAMESPACES;
 
     MessageMonitor::MessageMonitor(const std::string& system, uint64_t uid):
+      m_entities("  'dune_entities': { },\n"),
       m_uid(uid),
+      m_seq(0),
+      m_msgs_doc(new Document),
       m_last_msgs_json(0),
+      m_logbook_dirty(false),
+      m_logbook_doc(new Document),
       m_last_logbook_json(0),
       m_log_entry(100)
     {
@@ -57,171 +62,258 @@ namespace Transports
 
     MessageMonitor::~MessageMonitor(void)
     {
-      ScopedMutex l(m_mutex);
+      for (MessageMap::iterator itr = m_pending.begin(); itr != m_pending.end(); ++itr)
+        delete itr->second;
 
-      {
-        std::map<unsigned, IMC::Message*>::iterator itr = m_msgs.begin();
-        for (; itr != m_msgs.end(); ++itr)
-          delete itr->second;
-      }
+      for (PowerChannelMap::iterator itr = m_power_pending.begin(); itr != m_power_pending.end(); ++itr)
+        delete itr->second;
 
-      {
-        for (PowerChannelMap::iterator itr = m_power_channels.begin(); itr != m_power_channels.end(); ++itr)
-          delete itr->second;
-      }
-
-      {
-        for(unsigned int itr = 0; itr < m_logbook.size(); ++itr)
-          delete m_logbook[itr];
-      }
+      m_msgs_doc->release();
+      m_logbook_doc->release();
     }
 
     void
     MessageMonitor::setEntities(const std::map<unsigned, std::string>& entities)
     {
+      std::ostringstream os;
+
+      if (entities.empty())
+      {
+        os << "  'dune_entities': { },\n";
+      }
+      else
+      {
+        os << "  'dune_entities': {\n";
+        std::map<unsigned, std::string>::const_iterator itr = entities.begin();
+        os << itr->first << " : {" << "\"label\": \"" << itr->second << "\"}";
+        ++itr;
+        for (; itr != entities.end(); ++itr)
+          os << ",\n" << itr->first << " : {" << "\"label\": \"" << itr->second << "\"}";
+        os << "\n},";
+      }
+
       ScopedMutex l(m_mutex);
-      m_entities = entities;
+      m_entities = os.str();
     }
 
-    ByteBuffer*
+    Document*
     MessageMonitor::messagesJSON(void)
     {
-      ScopedMutex l(m_mutex);
+      ScopedMutex l(m_render_mutex);
 
       uint64_t now = Clock::getMsec();
 
       if ((now - m_last_msgs_json) > 2000)
         m_last_msgs_json = now;
       else
-        return &m_msgs_json;
+        return acquire(m_msgs_doc);
+
+      std::string entities = renderPending();
 
       if (m_msgs.empty())
-        return &m_msgs_json;
+        return acquire(m_msgs_doc);
 
       std::ostringstream os;
       os << m_meta
-         << "  'dune_time_current': '" << std::setprecision(12) << Clock::getSinceEpoch() << "',\n";
-
-      if (m_entities.empty())
-      {
-        os << "  'dune_entities': { },\n";
-      }
-      else
-      {
-        os << "  'dune_entities': {\n";
-        EntityMap::iterator itr = m_entities.begin();
-        os << itr->first << " : {" << "\"label\": \"" << itr->second << "\"}";
-        ++itr;
-        for (; itr != m_entities.end(); ++itr)
-          os << ",\n" << itr->first << " : {" << "\"label\": \"" << itr->second << "\"}";
-        os << "\n},";
-      }
-
-      os << "  'dune_messages': [\n";
+         << "  'dune_time_current': '" << std::setprecision(12) << Clock::getSinceEpoch() << "',\n"
+         << entities
+         << "  'dune_messages': [\n";
 
-      std::map<unsigned, IMC::Message*>::iterator itr = m_msgs.begin();
-      itr->second->toJSON(os);
+      RenderedMap::iterator itr = m_msgs.begin();
+      os << itr->second.json;
       ++itr;
 
       for (; itr != m_msgs.end(); ++itr)
-      {
-        os << ",\n";
-        itr->second->toJSON(os);
-      }
+        os << ",\n" << itr->second.json;
 
-      for (PowerChannelMap::iterator pitr = m_power_channels.begin(); pitr != m_power_channels.end(); ++pitr)
-      {
-        os << ",\n";
-        pitr->second->toJSON(os);
-      }
+      for (RenderedPowerMap::iterator pitr = m_power_channels.begin(); pitr != m_power_channels.end(); ++pitr)
+        os << ",\n" << pitr->second.json;
 
       os << "\n]"
          << "\n};";
 
-      GzipCompressor cmp;
-      std::string str = os.str();
-      cmp.compress(m_msgs_json, (char*)str.c_str(), (unsigned long)str.size());
+      publish(m_msgs_doc, os.str());
 
-      return &m_msgs_json;
+      return acquire(m_msgs_doc);
     }
 
     void
-    MessageMonitor::updateMessage(const IMC::Message* msg)
+    MessageMonitor::update(void)
     {
-      ScopedMutex l(m_mutex);
+      ScopedMutex l(m_render_mutex);
+      renderPending();
+    }
 
-      if (msg->getId() == DUNE_IMC_POWERCHANNELSTATE)
-        updatePowerChannel(static_cast<const IMC::PowerChannelState*>(msg));
+    uint64_t
+    MessageMonitor::getChanges(uint64_t seq, const std::set<unsigned>& ids, std::vector<std::string>& changes)
+    {
+      ScopedMutex l(m_render_mutex);
+
+      if (seq >= m_seq)
+        return m_seq;
+
+      for (RenderedMap::iterator itr = m_msgs.begin(); itr != m_msgs.end(); ++itr)
+      {
+        if (itr->second.seq <= seq)
+          continue;
+
+        if (ids.empty() || ids.find(itr->second.id) != ids.end())
+          changes.push_back(itr->second.json);
+      }
+
+      for (RenderedPowerMap::iterator itr = m_power_channels.begin(); itr != m_power_channels.end(); ++itr)
+      {
+        if (itr->second.seq <= seq)
+          continue;
+
+        if (ids.empty() || ids.find(itr->second.id) != ids.end())
+          changes.push_back(itr->second.json);
+      }
 
+      return m_seq;
+    }
+
+    void
+    MessageMonitor::updateMessage(const IMC::Message* msg)
+    {
+      // Clone outside the lock, the critical section only swaps pointers.
       IMC::Message* tmsg = msg->clone();
       unsigned key = tmsg->getId() << 24 | tmsg->getSubId() << 8 | tmsg->getSourceEntity();
 
-      if (m_msgs[key])
-        delete m_msgs[key];
+      IMC::Message* pmsg = 0;
+      if (msg->getId() == DUNE_IMC_POWERCHANNELSTATE)
+        pmsg = msg->clone();
+
+      {
+        ScopedMutex l(m_mutex);
+
+        std::swap(m_pending[key], tmsg);
+
+        if (pmsg != 0)
+          std::swap(m_power_pending[static_cast<IMC::PowerChannelState*>(pmsg)->name], pmsg);
+      }
 
-      m_msgs[key] = tmsg;
+      delete tmsg;
+      delete pmsg;
     }
 
-    ByteBuffer*
+    Document*
     MessageMonitor::logbookJSON(void)
     {
-      ScopedMutex l(m_mutex);
+      ScopedMutex l(m_render_mutex);
 
-      uint64_t now = Clock::getMsec();
+      std::ostringstream os;
+      {
+        ScopedMutex ml(m_mutex);
+
+        uint64_t now = Clock::getMsec();
+
+        if ((now - m_last_logbook_json) < 2000 || !m_logbook_dirty)
+          return acquire(m_logbook_doc);
 
-      if ((now - m_last_logbook_json) < 2000)
-        return &m_logbook_json;
-      else
         m_last_logbook_json = now;
+        m_logbook_dirty = false;
 
-      // Update m_logbook_json
-      if (m_logbook.empty())
-        return &m_logbook_json;
+        os << "var logbook = {\n"
+           <<"'dune_logbook': [\n";
 
-      std::ostringstream os;
-      unsigned int itr = 0;
+        std::deque<std::string>::iterator itr = m_logbook.begin();
+        os << *itr;
+        ++itr;
 
-      os << "var logbook = {\n"
-         <<"'dune_logbook': [\n";
-      m_logbook[itr]->toJSON(os);
-      ++itr;
+        for (; itr != m_logbook.end(); ++itr)
+          os << ",\n" << *itr;
 
-      for (; itr != m_logbook.size(); ++itr)
-      {
-        os << ",\n";
-        m_logbook[itr]->toJSON(os);
+        os << "\n]"
+           << "\n};";
       }
 
-      os << "\n]"
-         << "\n};";
+      publish(m_logbook_doc, os.str());
 
-      // gzip compress
-      GzipCompressor cmp;
-      std::string str = os.str();
-      cmp.compress(m_logbook_json, (char*)str.c_str(), (unsigned long)str.size());
-
-      return &m_logbook_json;
+      return acquire(m_logbook_doc);
     }
 
     void
     MessageMonitor::addLogEntry(const IMC::LogBookEntry* msg)
     {
+      std::string json = render(msg);
+
       ScopedMutex l(m_mutex);
 
       if (m_logbook.size() >= m_log_entry)
-        m_logbook.erase(m_logbook.begin());
+        m_logbook.pop_front();
+
+      m_logbook.push_back(json);
+      m_logbook_dirty = true;
+    }
+
+    std::string
+    MessageMonitor::renderPending(void)
+    {
+      // Take ownership of pending updates, keeping the bus consumer
+      // locked out only while swapping containers.
+      MessageMap msgs;
+      PowerChannelMap pcs;
+      std::string entities;
+      {
+        ScopedMutex l(m_mutex);
+        msgs.swap(m_pending);
+        pcs.swap(m_power_pending);
+        entities = m_entities;
+      }
+
+      for (MessageMap::iterator itr = msgs.begin(); itr != msgs.end(); ++itr)
+      {
+        renderEntry(m_msgs[itr->first], itr->second);
+        delete itr->second;
+      }
+
+      for (PowerChannelMap::iterator itr = pcs.begin(); itr != pcs.end(); ++itr)
+      {
+        renderEntry(m_power_channels[itr->first], itr->second);
+        delete itr->second;
+      }
 
-      m_logbook.push_back(new IMC::LogBookEntry(*msg));
+      return entities;
     }
 
     void
-    MessageMonitor::updatePowerChannel(const IMC::PowerChannelState* msg)
+    MessageMonitor::renderEntry(Entry& entry, const IMC::Message* msg)
     {
-      std::map<std::string, IMC::PowerChannelState*>::iterator itr = m_power_channels.find(msg->name);
-      if (itr != m_power_channels.end())
-        *itr->second = *msg;
-      else
-        m_power_channels[msg->name] = new IMC::PowerChannelState(*msg);
+      entry.id = msg->getId();
+      entry.seq = ++m_seq;
+      entry.json = render(msg);
+    }
+
+    Document*
+    MessageMonitor::acquire(Document*& doc)
+    {
+      ScopedMutex l(m_doc_mutex);
+      doc->acquire();
+      return doc;
+    }
+
+    void
+    MessageMonitor::publish(Document*& doc, const std::string& str)
+    {
+      Document* ndoc = new Document;
+      GzipCompressor cmp;
+      cmp.compress(ndoc->getBuffer(), (char*)str.c_str(), (unsigned long)str.size());
+
+      {
+        ScopedMutex l(m_doc_mutex);
+        std::swap(doc, ndoc);
+      }
+
+      ndoc->release();
+    }
+
+    std::string
+    MessageMonitor::render(const IMC::Message* msg)
+    {
+      std::ostringstream os;
+      msg->toJSON(os);
+      return os.str();
     }
   }
 }
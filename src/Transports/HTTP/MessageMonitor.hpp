@@ -31,16 +31,28 @@
 #define TRANSPORTS_HTTP_MESSAGE_MONITOR_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
+#include <deque>
 #include <map>
+#include <set>
 #include <string>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// Local headers.
+#include "Document.hpp"
+
 namespace Transports
 {
   namespace HTTP
   {
+    //! The message monitor keeps the last message of each type and
+    //! serves it to HTTP clients as a gzip compressed JavaScript
+    //! document. Each message is rendered to JSON only once, when a
+    //! new document is needed after it was updated, and documents are
+    //! published as immutable snapshots so that readers never block
+    //! the bus consumer.
     class MessageMonitor
     {
     public:
@@ -51,12 +63,31 @@ namespace Transports
       void
       setEntities(const std::map<unsigned, std::string>& entities);
 
-      DUNE::Utils::ByteBuffer*
+      //! Retrieve the current messages document. The caller must
+      //! release the returned document when done with it.
+      //! @return messages document.
+      Document*
       messagesJSON(void);
 
-      DUNE::Utils::ByteBuffer*
+      //! Retrieve the current logbook document. The caller must
+      //! release the returned document when done with it.
+      //! @return logbook document.
+      Document*
       logbookJSON(void);
 
+      //! Render messages updated since the last call.
+      void
+      update(void);
+
+      //! Retrieve messages rendered after a given sequence number.
+      //! @param[in] seq sequence number of the last retrieved change.
+      //! @param[in] ids identifiers of the messages of interest, empty
+      //! for all messages.
+      //! @param[out] changes JSON representation of changed messages.
+      //! @return sequence number of the last rendered change.
+      uint64_t
+      getChanges(uint64_t seq, const std::set<unsigned>& ids, std::vector<std::string>& changes);
+
       void
       addLogEntry(const DUNE::IMC::LogBookEntry* msg);
 
@@ -76,37 +107,91 @@ namespace Transports
       }
 
     private:
-      //! Convenience type definition for a map of power channels.
-      typedef std::map<std::string, DUNE::IMC::PowerChannelState*> PowerChannelMap;
-      // Convenience type definition for a map of entity labels.
-      typedef std::map<unsigned, std::string> EntityMap;
+      //! Rendered message.
+      struct Entry
+      {
+        //! Message identifier.
+        unsigned id;
+        //! Sequence number of the last render.
+        uint64_t seq;
+        //! JSON representation.
+        std::string json;
+      };
+
+      //! Convenience type definition for a map of pending messages.
+      typedef std::map<unsigned, DUNE::IMC::Message*> MessageMap;
+      //! Convenience type definition for a map of pending power channels.
+      typedef std::map<std::string, DUNE::IMC::Message*> PowerChannelMap;
+      //! Convenience type definition for a map of rendered messages.
+      typedef std::map<unsigned, Entry> RenderedMap;
+      //! Convenience type definition for a map of rendered power channels.
+      typedef std::map<std::string, Entry> RenderedPowerMap;
       // Software meta information.
       std::string m_meta;
-      // Table of messages.
-      std::map<unsigned, DUNE::IMC::Message*> m_msgs;
-      // Entity map.
-      EntityMap m_entities;
-      // Concurrency mutex.
+      // Messages updated since the last render.
+      MessageMap m_pending;
+      //! Power channels updated since the last render.
+      PowerChannelMap m_power_pending;
+      // Rendered entity map.
+      std::string m_entities;
+      // Concurrency mutex, protects pending updates and logbook.
       DUNE::Concurrency::Mutex m_mutex;
+      // Render mutex, protects rendered messages.
+      DUNE::Concurrency::Mutex m_render_mutex;
+      // Document mutex, protects published documents.
+      DUNE::Concurrency::Mutex m_doc_mutex;
       // DUNE's UID.
       uint64_t m_uid;
-      // JSON messages.
-      DUNE::Utils::ByteBuffer m_msgs_json;
+      // Rendered messages.
+      RenderedMap m_msgs;
+      //! Rendered power channels.
+      RenderedPowerMap m_power_channels;
+      // Sequence number of the last render.
+      uint64_t m_seq;
+      // Published messages document.
+      Document* m_msgs_doc;
       // Last JSON messages refresh.
       uint64_t m_last_msgs_json;
-      //! Power channels.
-      PowerChannelMap m_power_channels;
-      // Logbook messages.
-      std::vector<DUNE::IMC::LogBookEntry*> m_logbook;
-      // Logbook messages' JSON.
-      DUNE::Utils::ByteBuffer m_logbook_json;
+      // Rendered logbook messages.
+      std::deque<std::string> m_logbook;
+      // True if the logbook changed since the last render.
+      bool m_logbook_dirty;
+      // Published logbook document.
+      Document* m_logbook_doc;
       // Last logbook generation timestamp.
       uint64_t m_last_logbook_json;
       // Number of logbook messages to show.
       unsigned int m_log_entry;
 
+      //! Render pending messages, must be called with the render
+      //! mutex held.
+      //! @return rendered entity map.
+      std::string
+      renderPending(void);
+
+      //! Update a rendered entry.
+      //! @param[in] entry rendered entry.
+      //! @param[in] msg message.
       void
-      updatePowerChannel(const DUNE::IMC::PowerChannelState* msg);
+      renderEntry(Entry& entry, const DUNE::IMC::Message* msg);
+
+      //! Retrieve a published document.
+      //! @param[in] doc published document.
+      //! @return acquired document.
+      Document*
+      acquire(Document*& doc);
+
+      //! Replace a published document.
+      //! @param[in] doc published document.
+      //! @param[in] str uncompressed contents of the new document.
+      void
+      publish(Document*& doc, const std::string& str);
+
+      //! Render one message to JSON.
+      //! @param[in] msg message.
+      //! @return JSON representation of the message.
+      static std::string
+      render(const DUNE::IMC::Message* msg);
     };
   }
 }
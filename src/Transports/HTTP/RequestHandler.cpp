@@ -92,6 +92,28 @@ namespace Transports
       sock->write(res.c_str(), res.size());
     }
 
+    void
+    RequestHandler::sendStreamHeader(TCPSocket* sock, HeaderFieldsMap* hdr_fields)
+    {
+      std::stringstream ss;
+      ss << STATUS_LINE_200
+         << SERVER_VERSION
+         << "Cache-Control: " << "no-cache" << "\r\n"
+         << "Connection: " << "close" << "\r\n";
+
+      if (hdr_fields)
+      {
+        HeaderFieldsMap::iterator itr = hdr_fields->begin();
+        for (; itr != hdr_fields->end(); ++itr)
+          ss << itr->first << ": " << itr->second << "\r\n";
+      }
+
+      ss << "\r\n";
+
+      std::string res = ss.str();
+      sock->write(res.c_str(), res.size());
+    }
+
     void
     RequestHandler::sendResponse100(TCPSocket* sock)
     {
@@ -225,6 +247,22 @@ namespace Transports
       sendResponse404(sock);
     }
 
+    bool
+    RequestHandler::isStreamURI(const char* uri)
+    {
+      (void)uri;
+      return false;
+    }
+
+    bool
+    RequestHandler::handleStream(TCPSocket* sock, Utils::TupleList& headers, const char* uri)
+    {
+      (void)headers;
+      (void)uri;
+      sendResponse404(sock);
+      return false;
+    }
+
     void
     RequestHandler::handlePOST(TCPSocket* sock, Utils::TupleList& headers, const char* uri)
     {
@@ -241,7 +279,7 @@ namespace Transports
       sendResponse404(sock);
     }
 
-    void
+    bool
     RequestHandler::handleRequest(TCPSocket* sock)
     {
       char mtd[16];
@@ -281,7 +319,7 @@ namespace Transports
       if (size <= 0)
       {
         DUNE_WRN("HTTP", "request too short");
-        return;
+        return false;
       }
 
       char* hdr = new char[size + 1];
@@ -289,6 +327,7 @@ namespace Transports
       hdr[size] = 0;
 
       Utils::TupleList headers(hdr, ":", "\r\n", true);
+      bool detached = false;
 
       // Parse request line.
       if (std::sscanf(hdr, "%s %s %*s", mtd, uri) == 2)
@@ -298,7 +337,10 @@ namespace Transports
 
         if (std::strcmp(mtd, "GET") == 0)
         {
-          handleGET(sock, headers, uri_clean);
+          if (isStreamURI(uri_clean))
+            detached = handleStream(sock, headers, uri_clean);
+          else
+            handleGET(sock, headers, uri_clean);
         }
         else if (std::strcmp(mtd, "POST") == 0)
         {
@@ -311,6 +353,8 @@ namespace Transports
       }
 
       delete[] hdr;
+
+      return detached;
     }
   }
 }
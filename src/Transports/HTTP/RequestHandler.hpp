@@ -59,6 +59,22 @@ namespace Transports
       virtual void
       handleGET(TCPSocket* sock, Utils::TupleList& headers, const char* uri);
 
+      //! Test if a GET request is for a long-lived stream.
+      //! @param[in] uri request URI.
+      //! @return true if the request must be handled by
+      //! handleStream(), false otherwise.
+      virtual bool
+      isStreamURI(const char* uri);
+
+      //! Handle a GET request for a long-lived stream.
+      //! @param[in] sock client socket.
+      //! @param[in] headers request headers.
+      //! @param[in] uri request URI.
+      //! @return true if the handler took ownership of the socket,
+      //! false if the caller must dispose of it.
+      virtual bool
+      handleStream(TCPSocket* sock, Utils::TupleList& headers, const char* uri);
+
       virtual void
       handlePOST(TCPSocket* sock, Utils::TupleList& headers, const char* uri);
 
@@ -68,6 +84,13 @@ namespace Transports
       void
       sendHeader(TCPSocket* sock, const char* status_line, int64_t length, HeaderFieldsMap* hdr_fields = 0);
 
+      //! Send the header of a response whose body ends when the
+      //! connection is closed.
+      //! @param[in] sock client socket.
+      //! @param[in] hdr_fields extra header fields.
+      void
+      sendStreamHeader(TCPSocket* sock, HeaderFieldsMap* hdr_fields = 0);
+
       void
       sendResponse100(TCPSocket* sock);
 
@@ -110,7 +133,11 @@ namespace Transports
       void
       sendFile(TCPSocket* sock, const std::string& file, HeaderFieldsMap& hdr_fields, int64_t off_beg = -1, int64_t off_end = -1);
 
-      void
+      //! Read and handle one request.
+      //! @param[in] sock client socket.
+      //! @return true if the handler took ownership of the socket,
+      //! false if the caller must dispose of it.
+      bool
       handleRequest(TCPSocket* sock);
     };
   }
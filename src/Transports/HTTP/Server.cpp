@@ -74,14 +74,17 @@ namespace Transports
           if (!sock)
             continue;
 
+          bool detached = false;
+
           try
           {
-            m_handler.handleRequest(sock);
+            detached = m_handler.handleRequest(sock);
           }
           catch (...)
           { }
 
-          delete sock;
+          if (!detached)
+            delete sock;
         }
       }
     };
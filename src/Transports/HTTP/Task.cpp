@@ -35,11 +35,13 @@
 #include <cstdlib>
 #include <algorithm>
 #include <cstddef>
+#include <set>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
 // Local headers.
+#include "EventStream.hpp"
 #include "MessageMonitor.hpp"
 #include "RequestHandler.hpp"
 #include "Server.hpp"
@@ -61,6 +63,12 @@ namespace Transports
       unsigned threads;
       //! List of messages to transport.
       std::vector<std::string> messages;
+      //! Maximum number of event stream clients.
+      unsigned stream_clients;
+      //! Maximum event stream update rate.
+      double stream_rate;
+      //! Event stream keep-alive period.
+      double stream_keep_alive;
     };
 
     //! Buffer length.
@@ -78,6 +86,8 @@ namespace Transports
       std::string m_agent;
       //! Message Monitor.
       MessageMonitor m_msg_mon;
+      //! Event stream.
+      EventStream* m_stream;
       //! Task arguments.
       Arguments m_args;
 
@@ -85,7 +95,8 @@ namespace Transports
         Tasks::Task(name, ctx),
         RequestHandler(),
         m_server(NULL),
-        m_msg_mon(getSystemName(), ctx.uid)
+        m_msg_mon(getSystemName(), ctx.uid),
+        m_stream(NULL)
       {
         // Define configuration parameters.
         param("Port", m_args.port)
@@ -100,6 +111,21 @@ namespace Transports
         .defaultValue("")
         .description("List of messages to transport");
 
+        param("Stream - Maximum Clients", m_args.stream_clients)
+        .defaultValue("8")
+        .description("Maximum number of clients of the event stream");
+
+        param("Stream - Maximum Rate", m_args.stream_rate)
+        .defaultValue("10")
+        .minimumValue("0.1")
+        .units(Units::Hertz)
+        .description("Maximum rate at which event stream clients are updated");
+
+        param("Stream - Keep Alive Period", m_args.stream_keep_alive)
+        .defaultValue("15")
+        .units(Units::Second)
+        .description("Period of keep-alive comments sent to idle event stream clients");
+
         m_cfg_dir = ctx.dir_cfg.str();
         m_agent = getSystemName();
 
@@ -111,6 +137,10 @@ namespace Transports
       {
         bind(this, m_args.messages);
 
+        m_stream = new EventStream(m_msg_mon, m_args.stream_clients,
+                                   m_args.stream_rate, m_args.stream_keep_alive);
+        m_stream->start();
+
         uint16_t last_port = m_args.port + c_max_port_tries;
 
         for (uint16_t port = m_args.port; port < last_port; ++port)
@@ -152,6 +182,12 @@ namespace Transports
       onResourceRelease(void)
       {
         Memory::clear(m_server);
+
+        if (m_stream != NULL)
+        {
+          m_stream->stopAndJoin();
+          Memory::clear(m_stream);
+        }
       }
 
       void
@@ -225,6 +261,79 @@ namespace Transports
         }
       }
 
+      bool
+      isStreamURI(const char* uri)
+      {
+        return matchURL(uri, "/dune/state/stream", true);
+      }
+
+      //! Handle a request for the event stream. Accepted query
+      //! arguments are 'messages', a comma separated list of message
+      //! abbreviations, and 'rate', the update rate in Hz.
+      bool
+      handleStream(TCPSocket* sock, TupleList& headers, const char* uri)
+      {
+        (void)headers;
+
+        debug("stream request: %s", uri);
+
+        std::set<unsigned> ids;
+        double rate = 0;
+
+        const char* query = std::strchr(uri, '?');
+        if (query != NULL)
+        {
+          std::vector<std::string> args;
+          String::split(query + 1, "&", args);
+
+          for (unsigned i = 0; i < args.size(); ++i)
+          {
+            std::vector<std::string> kv;
+            String::split(args[i], "=", kv);
+
+            if (kv.size() != 2)
+              continue;
+
+            if (kv[0] == "rate")
+            {
+              std::istringstream is(kv[1]);
+              is >> rate;
+            }
+            else if (kv[0] == "messages")
+            {
+              std::vector<std::string> abbrevs;
+              String::split(kv[1], ",", abbrevs);
+
+              for (unsigned j = 0; j < abbrevs.size(); ++j)
+              {
+                try
+                {
+                  ids.insert(IMC::Factory::getIdFromAbbrev(abbrevs[j]));
+                }
+                catch (...)
+                {
+                  sendResponse404(sock, "Unknown message: " + abbrevs[j]);
+                  return false;
+                }
+              }
+            }
+          }
+        }
+
+        if (m_stream == NULL || m_stream->isFull())
+        {
+          war(DTR("too many stream clients"));
+          sendResponse503(sock);
+          return false;
+        }
+
+        RequestHandler::HeaderFieldsMap hdr;
+        hdr["Content-Type"] = "text/event-stream";
+        sendStreamHeader(sock, &hdr);
+
+        return m_stream->add(sock, ids, rate);
+      }
+
       void
       handlePOST(TCPSocket* sock, TupleList& headers, const char* uri)
       {
@@ -336,8 +445,18 @@ namespace Transports
         hdr["Content-Type"] = "text/javascript";
         hdr["Content-Encoding"] = "gzip";
 
-        ByteBuffer* bfr = m_msg_mon.messagesJSON();
-        sendData(sock, bfr->getBufferSigned(), bfr->getSize(), &hdr);
+        Document* doc = m_msg_mon.messagesJSON();
+        try
+        {
+          sendData(sock, doc->getData(), doc->getSize(), &hdr);
+        }
+        catch (...)
+        {
+          doc->release();
+          throw;
+        }
+
+        doc->release();
       }
 
       void
@@ -350,8 +469,18 @@ namespace Transports
         hdr["Content-Type"] = "text/javascript";
         hdr["Content-Encoding"] = "gzip";
 
-        ByteBuffer* bfr = m_msg_mon.logbookJSON();
-        sendData(sock, bfr->getBufferSigned(), bfr->getSize(), &hdr);
+        Document* doc = m_msg_mon.logbookJSON();
+        try
+        {
+          sendData(sock, doc->getData(), doc->getSize(), &hdr);
+        }
+        catch (...)
+        {
+          doc->release();
+          throw;
+        }
+
+        doc->release();
       }
 
       void
@@ -37,6 +37,9 @@
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// Local headers.
+#include "Writer.hpp"
+
 namespace Transports
 {
   namespace Logging
@@ -45,6 +48,8 @@ namespace Transports
 
     // Bytes per Mebibyte.
     static const unsigned c_bytes_per_mib = 1048576U;
+    // Bytes per Kibibyte.
+    static const unsigned c_bytes_per_kib = 1024U;
 
     struct Arguments
     {
@@ -58,6 +63,14 @@ namespace Transports
       unsigned lsf_volume_size;
       // Compression method.
       std::string lsf_compression;
+      // Size of blocks handed to the writer thread.
+      unsigned lsf_block_size;
+      // True to write a chunked, seekable LSF container.
+      bool lsf_chunked;
+      // Largest amount of data waiting for the writer thread (blocks).
+      unsigned lsf_backlog_limit;
+      // Action taken when the backlog is full.
+      std::string lsf_backlog_policy;
     };
 
     struct Task: public Tasks::Task
@@ -72,8 +85,8 @@ namespace Transports
       std::string m_volume_dir;
       // Compression format.
       Compression::Methods m_compression;
-      // Output file stream for LSF/LSF_GZ formats.
-      std::ostream* m_lsf;
+      // Asynchronous writer of LSF/LSF_GZ data.
+      Writer* m_writer;
       // Path to LSF file.
       Path m_lsf_file;
       // Serialization buffer.
@@ -82,15 +95,27 @@ namespace Transports
       IMC::LoggingControl m_log_ctl;
       // True if logging is enabled.
       bool m_active;
+      // Number of messages dropped by the mailbox.
+      unsigned m_mailbox_drops;
+      // True if messages were dropped in the last reporting period.
+      bool m_dropping;
       // Task arguments.
       Arguments m_args;
 
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
         m_last_flush(0),
-        m_lsf(NULL),
-        m_active(true)
+        m_writer(NULL),
+        m_active(true),
+        m_mailbox_drops(0),
+        m_dropping(false)
       {
+        // Absorb bursts of messages, but never make publishers wait
+        // for the disk. When full, new messages are refused rather
+        // than evicting queued ones, so that the log has a single gap
+        // per overload, and drops are reported (see reportStatistics).
+        setMailboxDefaults(16384, "Drop Newest");
+
         // Define configuration parameters.
         param("Flush Interval", m_args.flush_interval)
         .defaultValue("5.0")
@@ -105,6 +130,29 @@ namespace Transports
         .units(Units::Mebibyte)
         .defaultValue("0");
 
+        param("LSF Chunked", m_args.lsf_chunked)
+        .defaultValue("false")
+        .description("Write a seekable container of LZ4 compressed chunks "
+                     "instead of a LSF file. The compression method is ignored");
+
+        param("LSF Block Size", m_args.lsf_block_size)
+        .units(Units::Kibibyte)
+        .defaultValue("1024")
+        .minimumValue("4")
+        .description("Amount of data accumulated before being handed to the writer thread");
+
+        param("LSF Backlog Limit", m_args.lsf_backlog_limit)
+        .defaultValue("8")
+        .minimumValue("2")
+        .description("Largest amount of data waiting for the writer thread, "
+                     "in multiples of the block size");
+
+        param("LSF Backlog Policy", m_args.lsf_backlog_policy)
+        .defaultValue("Block")
+        .values("Block, Drop")
+        .description("Action taken when the backlog limit is reached: wait "
+                     "for the writer thread or drop the data");
+
         param("LSF Volume Directories", m_args.lsf_volumes)
         .defaultValue("");
 
@@ -124,6 +172,17 @@ namespace Transports
         onResourceRelease();
       }
 
+      void
+      onResourceAcquisition(void)
+      {
+        onResourceRelease();
+
+        unsigned block_size = m_args.lsf_block_size * c_bytes_per_kib;
+        m_writer = new Writer(block_size, block_size * m_args.lsf_backlog_limit,
+                              m_args.lsf_backlog_policy == "Drop");
+        m_writer->start();
+      }
+
       void
       onResourceInitialization(void)
       {
@@ -136,7 +195,12 @@ namespace Transports
       void
       onResourceRelease(void)
       {
-        Memory::clear(m_lsf);
+        if (m_writer != NULL)
+        {
+          m_writer->stopAndJoin();
+          delete m_writer;
+          m_writer = NULL;
+        }
       }
 
       void
@@ -283,6 +347,9 @@ namespace Transports
       void
       logFile(const std::string& file)
       {
+        if (!isLogOpen())
+          return;
+
         std::ifstream ifs(file.c_str(), std::ios::binary);
 
         if (!ifs.is_open())
@@ -292,7 +359,7 @@ namespace Transports
         while (!ifs.eof())
         {
           ifs.read(bfr, sizeof(bfr));
-          m_lsf->write(bfr, ifs.gcount());
+          m_writer->write(bfr, ifs.gcount());
         }
       }
 
@@ -303,7 +370,7 @@ namespace Transports
         if (!m_active)
           return;
 
-        if (m_lsf == NULL)
+        if (!isLogOpen())
           return;
 
         m_active = keep_logging;
@@ -320,7 +387,8 @@ namespace Transports
         inf(DTR("log stopped '%s'"), m_log_ctl.name.c_str());
         m_log_ctl.name.clear();
 
-        onResourceRelease();
+        if (!m_writer->close())
+          err(DTR("timed out writing log data, pending data was discarded"));
       }
 
       void
@@ -348,12 +416,23 @@ namespace Transports
         // Stop current log.
         stopLog();
 
-        m_lsf_file = m_dir / "Data.lsf" + Compression::Factory::extension(m_compression);
-
-        if (m_compression == METHOD_UNKNOWN)
-          m_lsf = new std::ofstream(m_lsf_file.c_str(), std::ios::binary);
+        std::ostream* lsf = NULL;
+        if (m_args.lsf_chunked)
+        {
+          m_lsf_file = m_dir / "Data.lsfc";
+          lsf = new IMC::ChunkedLogOutput(m_lsf_file.c_str());
+        }
         else
-          m_lsf = new Compression::FileOutput(m_lsf_file.c_str(), m_compression);
+        {
+          m_lsf_file = m_dir / "Data.lsf" + Compression::Factory::extension(m_compression);
+
+          if (m_compression == METHOD_UNKNOWN)
+            lsf = new std::ofstream(m_lsf_file.c_str(), std::ios::binary);
+          else
+            lsf = new Compression::FileOutput(m_lsf_file.c_str(), m_compression);
+        }
+
+        m_writer->open(lsf, m_lsf_file.str());
 
         // Log LoggingControl to facilitate posterior conversion to LLF.
         m_log_ctl.op = IMC::LoggingControl::COP_STARTED;
@@ -377,20 +456,70 @@ namespace Transports
         if (now > (m_last_flush + m_args.flush_interval))
         {
           tryRotate();
+          reportStatistics();
           m_last_flush = now;
         }
       }
 
+      void
+      reportStatistics(void)
+      {
+        // Messages lost before reaching the log.
+        unsigned drops = getMailboxDrops();
+        if (drops != m_mailbox_drops)
+        {
+          std::string desc = String::str(DTR("dropped %u messages (total: %u)"),
+                                         drops - m_mailbox_drops, drops);
+          err("%s", desc.c_str());
+          setEntityState(IMC::EntityState::ESTA_ERROR, desc);
+          m_mailbox_drops = drops;
+          m_dropping = true;
+        }
+        else if (m_dropping)
+        {
+          setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
+          m_dropping = false;
+        }
+
+        Writer::Statistics stats;
+        m_writer->getStatistics(stats);
+
+        if (stats.errors > 0)
+          err(DTR("failed to write %u blocks"), stats.errors);
+
+        if (stats.drops > 0)
+          err(DTR("writer backlog full: dropped %u writes"), stats.drops);
+
+        if (stats.pending_max > 2 * m_args.lsf_block_size * c_bytes_per_kib)
+          war(DTR("writer is falling behind: %u bytes pending"), stats.pending_max);
+
+        // Buffer occupancy and write latency for operators.
+        IMC::Event ev;
+        ev.topic = "Logger Writer";
+        ev.data = String::str("pending=%u;pending_max=%u;capacity=%u;writes=%u;"
+                              "latency_avg=%0.1f;latency_max=%0.1f;blocked=%0.1f;"
+                              "errors=%u;drops=%u;mailbox_drops=%u",
+                              stats.pending, stats.pending_max,
+                              m_args.lsf_backlog_limit * m_args.lsf_block_size * c_bytes_per_kib,
+                              stats.writes, stats.latency_avg * 1e3, stats.latency_max * 1e3,
+                              stats.blocked * 1e3, stats.errors, stats.drops, drops);
+        dispatch(ev);
+
+        debug("pending: %u / %u bytes | writes: %u | latency: %0.1f / %0.1f ms | blocked: %0.1f ms",
+              stats.pending, stats.pending_max, stats.writes,
+              stats.latency_avg * 1e3, stats.latency_max * 1e3, stats.blocked * 1e3);
+      }
+
       void
       tryRotate(void)
       {
-        if (m_lsf == NULL)
+        if (!isLogOpen())
           return;
 
         int64_t mib = Path(m_lsf_file).size();
         mib /= c_bytes_per_mib;
 
-        m_lsf->flush();
+        m_writer->flush();
 
         if ((m_args.lsf_volume_size > 0) && (mib >= m_args.lsf_volume_size))
           tryStartLog(m_label);
@@ -418,14 +547,20 @@ namespace Transports
         }
       }
 
+      bool
+      isLogOpen(void)
+      {
+        return m_writer != NULL && m_writer->isOpen();
+      }
+
       void
       logMessage(const IMC::Message* msg)
       {
-        if (m_lsf == NULL)
+        if (!isLogOpen())
           return;
 
         IMC::Packet::serialize(msg, m_buffer);
-        m_lsf->write(m_buffer.getBufferSigned(), m_buffer.getSize());
+        m_writer->write(m_buffer.getBufferSigned(), m_buffer.getSize());
       }
 
       void
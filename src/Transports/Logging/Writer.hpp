@@ -0,0 +1,417 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+#ifndef TRANSPORTS_LOGGING_WRITER_HPP_INCLUDED_
+#define TRANSPORTS_LOGGING_WRITER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <ostream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// POSIX headers.
+#if defined(DUNE_SYS_HAS_FSYNC)
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+namespace Transports
+{
+  namespace Logging
+  {
+    using DUNE_NAMESPACES;
+
+    //! Period to check for thread termination (s).
+    static const double c_wait_period = 1.0;
+    //! Largest amount of time to wait for pending data to be written
+    //! when closing the output stream (s).
+    static const double c_close_timeout = 10.0;
+
+    //! Retrieve the host monotonic time. Disk operations are timed
+    //! against the host clock, which is not affected by virtual or
+    //! simulated time.
+    //! @return time in seconds.
+    static inline double
+    getHostTime(void)
+    {
+      return Clock::getHostNsec() / c_nsec_per_sec_fp;
+    }
+
+    //! Asynchronous writer of log data. Data is appended to a front
+    //! block by the logging task while a dedicated thread writes
+    //! the back block to the output stream, so that compression and
+    //! disk synchronization do not delay message consumption. The
+    //! front block is capped: once full, writes either wait for the
+    //! writer thread or are dropped, depending on the backlog policy.
+    class Writer: public Concurrency::Thread
+    {
+    public:
+      //! Write statistics.
+      struct Statistics
+      {
+        //! Bytes waiting to be written.
+        unsigned pending;
+        //! Largest number of bytes waiting to be written.
+        unsigned pending_max;
+        //! Number of block writes.
+        unsigned writes;
+        //! Average time spent writing a block (s).
+        double latency_avg;
+        //! Largest time spent writing a block (s).
+        double latency_max;
+        //! Number of failed block writes.
+        unsigned errors;
+        //! Number of writes dropped because the backlog was full.
+        unsigned drops;
+        //! Time spent waiting for the backlog to drain (s).
+        double blocked;
+      };
+
+      //! Constructor.
+      //! @param[in] block_size size of blocks handed to the writer thread.
+      //! @param[in] backlog_limit largest number of bytes that may
+      //! wait for the writer thread.
+      //! @param[in] drop true to drop data when the backlog is full,
+      //! false to wait for the writer thread.
+      Writer(unsigned block_size, unsigned backlog_limit, bool drop):
+        m_block_size(block_size),
+        m_backlog_limit(backlog_limit),
+        m_drop(drop),
+        m_os(NULL),
+        m_flush(false),
+        m_close(false),
+        m_writing(0),
+        m_pending_max(0),
+        m_writes(0),
+        m_latency_sum(0),
+        m_latency_max(0),
+        m_errors(0),
+        m_drops(0),
+        m_blocked(0)
+      {
+        m_front.reserve(m_block_size);
+        m_back.reserve(m_block_size);
+      }
+
+      ~Writer(void)
+      {
+        delete m_os;
+        deleteOrphans();
+      }
+
+      //! Start writing to a new output stream. Any previous stream is
+      //! closed first.
+      //! @param[in] os output stream, owned by the writer.
+      //! @param[in] path path of the file behind the output stream.
+      void
+      open(std::ostream* os, const std::string& path)
+      {
+        close();
+
+        m_cond.lock();
+        m_os = os;
+        m_path = path;
+        m_cond.unlock();
+      }
+
+      //! Write all pending data and close the output stream. If the
+      //! writer thread does not finish in time, pending data is
+      //! discarded and the stream is closed by the writer thread
+      //! once it is done with it.
+      //! @param[in] timeout largest amount of time to wait (s).
+      //! @return true if all data was written, false otherwise.
+      bool
+      close(double timeout = c_close_timeout)
+      {
+        bool closed = true;
+        m_cond.lock();
+
+        if (m_os != NULL)
+        {
+          double deadline = getHostTime() + timeout;
+          m_close = true;
+          m_cond.broadcast();
+
+          while (m_os != NULL && getHostTime() < deadline)
+            m_cond.wait(c_wait_period);
+
+          if (m_os != NULL)
+          {
+            m_orphans.push_back(m_os);
+            m_os = NULL;
+            m_close = false;
+            m_front.clear();
+            closed = false;
+          }
+        }
+
+        m_cond.unlock();
+        return closed;
+      }
+
+      //! Test if there is an output stream.
+      //! @return true if there is an output stream, false otherwise.
+      bool
+      isOpen(void)
+      {
+        m_cond.lock();
+        bool open = (m_os != NULL);
+        m_cond.unlock();
+        return open;
+      }
+
+      //! Append data to the output stream. If the backlog is full
+      //! the data is either dropped or the caller waits for the
+      //! writer thread to make room.
+      //! @param[in] data data buffer.
+      //! @param[in] size size of the data buffer.
+      void
+      write(const char* data, unsigned size)
+      {
+        m_cond.lock();
+
+        if (!m_front.empty() && m_front.size() + size > m_backlog_limit)
+        {
+          if (m_drop)
+          {
+            ++m_drops;
+            m_cond.unlock();
+            return;
+          }
+
+          double start = getHostTime();
+          m_cond.broadcast();
+
+          while (!isStopping() && !m_front.empty() && m_front.size() + size > m_backlog_limit)
+            m_cond.wait(c_wait_period);
+
+          m_blocked += getHostTime() - start;
+        }
+
+        m_front.insert(m_front.end(), data, data + size);
+
+        unsigned pending = m_front.size() + m_writing;
+        if (pending > m_pending_max)
+          m_pending_max = pending;
+
+        if (m_front.size() >= m_block_size)
+          m_cond.broadcast();
+
+        m_cond.unlock();
+      }
+
+      //! Request all pending data to be written and synchronized to
+      //! disk. Returns immediately.
+      void
+      flush(void)
+      {
+        m_cond.lock();
+        m_flush = true;
+        m_cond.broadcast();
+        m_cond.unlock();
+      }
+
+      //! Retrieve and reset write statistics.
+      //! @param[out] stats write statistics.
+      void
+      getStatistics(Statistics& stats)
+      {
+        m_cond.lock();
+        stats.pending = m_front.size() + m_writing;
+        stats.pending_max = m_pending_max;
+        stats.writes = m_writes;
+        stats.latency_avg = (m_writes > 0) ? m_latency_sum / m_writes : 0;
+        stats.latency_max = m_latency_max;
+        stats.errors = m_errors;
+        stats.drops = m_drops;
+        stats.blocked = m_blocked;
+
+        m_pending_max = stats.pending;
+        m_writes = 0;
+        m_latency_sum = 0;
+        m_latency_max = 0;
+        m_errors = 0;
+        m_drops = 0;
+        m_blocked = 0;
+        m_cond.unlock();
+      }
+
+    private:
+      //! Size of blocks handed to the writer thread.
+      unsigned m_block_size;
+      //! Largest number of bytes waiting in the front block.
+      unsigned m_backlog_limit;
+      //! True to drop data when the backlog is full.
+      bool m_drop;
+      //! Block being filled.
+      std::vector<char> m_front;
+      //! Block being written.
+      std::vector<char> m_back;
+      //! Output stream.
+      std::ostream* m_os;
+      //! Path of the file behind the output stream.
+      std::string m_path;
+      //! True if a flush was requested.
+      bool m_flush;
+      //! True if closing the output stream was requested.
+      bool m_close;
+      //! Number of bytes being written.
+      unsigned m_writing;
+      //! Largest number of bytes waiting to be written.
+      unsigned m_pending_max;
+      //! Number of block writes.
+      unsigned m_writes;
+      //! Sum of time spent writing blocks.
+      double m_latency_sum;
+      //! Largest time spent writing a block.
+      double m_latency_max;
+      //! Number of failed block writes.
+      unsigned m_errors;
+      //! Number of dropped writes.
+      unsigned m_drops;
+      //! Time spent waiting for the backlog to drain.
+      double m_blocked;
+      //! Streams abandoned by close() while being written.
+      std::vector<std::ostream*> m_orphans;
+      //! Condition protecting all of the above.
+      Concurrency::Condition m_cond;
+
+      //! Delete streams abandoned by close().
+      void
+      deleteOrphans(void)
+      {
+        for (unsigned i = 0; i < m_orphans.size(); ++i)
+          delete m_orphans[i];
+        m_orphans.clear();
+      }
+
+      //! Synchronize the output file to disk.
+      void
+      sync(void)
+      {
+#if defined(DUNE_SYS_HAS_FSYNC)
+        int fd = ::open(m_path.c_str(), O_RDONLY);
+        if (fd < 0)
+          return;
+
+        ::fsync(fd);
+        ::close(fd);
+#endif
+      }
+
+      void
+      run(void)
+      {
+        while (true)
+        {
+          m_cond.lock();
+
+          while (!isStopping() && !m_flush && !m_close && m_front.size() < m_block_size)
+            m_cond.wait(c_wait_period);
+
+          bool stop = isStopping();
+          bool close = m_close || stop;
+          bool flush = m_flush || close;
+          m_flush = false;
+
+          m_front.swap(m_back);
+          m_writing = m_back.size();
+          std::ostream* os = m_os;
+
+          // Wake up writers waiting for room in the front block.
+          m_cond.broadcast();
+          m_cond.unlock();
+
+          if (os != NULL && (!m_back.empty() || flush))
+          {
+            double start = getHostTime();
+            bool failed = false;
+
+            try
+            {
+              if (!m_back.empty())
+                os->write(&m_back[0], m_back.size());
+
+              if (flush)
+              {
+                os->flush();
+                sync();
+              }
+
+              failed = os->fail();
+            }
+            catch (std::exception&)
+            {
+              failed = true;
+            }
+
+            double latency = getHostTime() - start;
+
+            m_cond.lock();
+            if (failed)
+              ++m_errors;
+            ++m_writes;
+            m_latency_sum += latency;
+            if (latency > m_latency_max)
+              m_latency_max = latency;
+            m_cond.unlock();
+          }
+
+          m_back.clear();
+
+          m_cond.lock();
+          m_writing = 0;
+
+          // The stream may have been abandoned by close() while it
+          // was being written, in which case it is an orphan.
+          if (close && os != NULL && os == m_os)
+          {
+            delete m_os;
+            m_os = NULL;
+            m_close = false;
+            m_cond.broadcast();
+          }
+
+          deleteOrphans();
+
+          m_cond.unlock();
+
+          if (stop)
+            break;
+        }
+      }
+    };
+  }
+}
+
+#endif
@@ -28,6 +28,7 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <map>
@@ -47,9 +48,15 @@ namespace Transports
       std::string startup_file;
       std::vector<std::string> msgs;
       std::vector<std::string> ents;
+      double speed;
+      double offset;
     };
 
     static const int c_stats_period = 10;
+    //! Minimum replay speed factor.
+    static const double c_min_speed = 0.1;
+    //! Maximum time to wait without checking for control requests (s).
+    static const double c_wait_slice = 0.1;
 
     struct Task: public DUNE::Tasks::Task
     {
@@ -70,8 +77,36 @@ namespace Transports
       double m_ts_delta;
       double m_start_time;
 
+      // Replay file name
+      std::string m_file;
       // Replay file handle
       std::istream* m_is;
+      // Packet reader over the replay file
+      IMC::PacketReader* m_reader;
+      // Next message to dispatch (owned by m_reader)
+      IMC::Message* m_msg;
+      // Log time of the next message to dispatch
+      double m_msg_time;
+      // Log time of the first message
+      double m_log_start;
+      // Log time of the last message read
+      double m_last_ts;
+      // Speed factor (0 means as fast as possible)
+      double m_speed;
+      // True if replay is paused
+      bool m_paused;
+      // True if messages are being skipped until m_seek_target
+      bool m_seeking;
+      // Log time to seek to
+      double m_seek_target;
+      // True if the log timeline is anchored to the monotonic clock
+      bool m_anchored;
+      // Log time of the anchor
+      double m_log_anchor;
+      // Monotonic time of the anchor
+      double m_wall_anchor;
+      // True if the virtual clock is being driven by this task
+      bool m_virtual;
       // last state from replay file
       IMC::EstimatedState m_estate;
 
@@ -96,7 +131,14 @@ namespace Transports
 
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
-        m_is(0)
+        m_is(0),
+        m_reader(0),
+        m_msg(0),
+        m_speed(1.0),
+        m_paused(false),
+        m_seeking(false),
+        m_anchored(false),
+        m_virtual(false)
       {
         param("Load At Start", m_args.startup_file)
         .defaultValue("")
@@ -110,6 +152,21 @@ namespace Transports
         .defaultValue("")
         .description("Entities for which state should be reported");
 
+        param("Speed", m_args.speed)
+        .defaultValue("1.0")
+        .minimumValue("0.0")
+        .maximumValue("100.0")
+        .description("Replay speed factor, from 0.1 to 100 times real time. "
+                     "Use 0 to replay as fast as possible, in which case the "
+                     "clock of the whole process follows the replayed messages");
+
+        param("Start Offset", m_args.offset)
+        .defaultValue("0.0")
+        .minimumValue("0.0")
+        .units(Units::Second)
+        .description("Time from the start of the log at which replay starts. "
+                     "Changing it during replay seeks to the new position");
+
         bind<IMC::ReplayControl>(this);
       }
 
@@ -122,6 +179,23 @@ namespace Transports
         if (m_replay.find("EstimatedState") == m_replay.end())
           bind<IMC::EstimatedState>(this);
 
+        if (m_args.speed <= 0)
+          m_speed = 0;
+        else
+          m_speed = std::max(m_args.speed, c_min_speed);
+
+        // Speed and position can be changed without restarting.
+        if (isActive() && !paramChanged(m_args.msgs) && !paramChanged(m_args.ents))
+        {
+          if (paramChanged(m_args.speed))
+            m_anchored = false;
+
+          if (paramChanged(m_args.offset))
+            seek(m_args.offset);
+
+          return;
+        }
+
         reset();
       }
 
@@ -178,6 +252,21 @@ namespace Transports
           case IMC::ReplayControl::ROP_STOP:
             stopReplay();
             break;
+          case IMC::ReplayControl::ROP_PAUSE:
+            if (isActive() && !m_paused)
+            {
+              m_paused = true;
+              war(DTR("paused replay"));
+            }
+            break;
+          case IMC::ReplayControl::ROP_RESUME:
+            if (isActive() && m_paused)
+            {
+              m_paused = false;
+              m_anchored = false;
+              war(DTR("resumed replay"));
+            }
+            break;
           default:
             err(DTR("operation not supported"));
         }
@@ -207,25 +296,14 @@ namespace Transports
           return;
         }
 
-        try
-        {
-          Compression::Methods method = Compression::Factory::detect(file.c_str());
-          if (method == Compression::METHOD_UNKNOWN)
-            m_is = new std::ifstream(file.c_str(), std::ios::binary);
-          else
-            m_is = new Compression::FileInput(file.c_str(), method);
-        }
-        catch (std::exception& e)
-        {
-          err("%s '%s': %s", DTR("could not open"), file.c_str(), e.what());
+        if (!openFile(file))
           return;
-        }
 
         IMC::Message* m = 0;
 
         try
         {
-          m = IMC::Packet::deserialize(*m_is);
+          m = m_reader->next();
         }
         catch (std::exception& e)
         {
@@ -244,7 +322,6 @@ namespace Transports
         if (m->getId() != DUNE_IMC_LOGGINGCONTROL)
         {
           err(DTR("invalid LSF file for replay"));
-          delete m;
           reset();
           return;
         }
@@ -261,14 +338,126 @@ namespace Transports
         lc->op = IMC::LoggingControl::COP_REQUEST_START;
         dispatch(lc); // change log (if Logging task happens to be active)
 
+        m_log_start = m_ts_delta;
+        m_last_ts = m_log_start;
         m_ts_delta = lc->getTimeStamp() - m_ts_delta;
         m_start_time = lc->getTimeStamp();
         m_next_stats = m_start_time + c_stats_period;
-        delete m;
 
         requestActivation();
 
         war("%s '%s'", DTR("started replay of"), file.c_str());
+
+        if (m_args.offset > 0)
+          seek(m_args.offset);
+      }
+
+      //! Open a replay file and create its packet reader.
+      //! @param[in] file replay file.
+      //! @return true on success, false otherwise.
+      bool
+      openFile(const std::string& file)
+      {
+        try
+        {
+          Compression::Methods method = Compression::Factory::detect(file.c_str());
+          if (IMC::ChunkedLogReader::isChunked(file.c_str()))
+            m_is = new IMC::ChunkedLogInput(file.c_str());
+          else if (method == Compression::METHOD_UNKNOWN)
+            m_is = new std::ifstream(file.c_str(), std::ios::binary);
+          else
+            m_is = new Compression::FileInput(file.c_str(), method);
+        }
+        catch (std::exception& e)
+        {
+          err("%s '%s': %s", DTR("could not open"), file.c_str(), e.what());
+          return false;
+        }
+
+        m_file = file;
+        m_reader = new IMC::PacketReader(*m_is);
+
+        // Skip messages that will not be replayed.
+        m_reader->accept(DUNE_IMC_LOGGINGCONTROL);
+        m_reader->accept(DUNE_IMC_ESTIMATEDSTATE);
+        m_reader->accept(DUNE_IMC_ENTITYINFO);
+        m_reader->accept(DUNE_IMC_ENTITYSTATE);
+
+        for (ReplayMsg::iterator itr = m_replay.begin(); itr != m_replay.end(); ++itr)
+        {
+          try
+          {
+            m_reader->accept(IMC::Factory::getIdFromAbbrev(itr->first));
+          }
+          catch (...)
+          {
+            war("%s '%s'", DTR("unknown message"), itr->first.c_str());
+          }
+        }
+
+        return true;
+      }
+
+      //! Close the replay file.
+      void
+      closeFile(void)
+      {
+        m_msg = 0;
+
+        if (m_reader)
+        {
+          delete m_reader;
+          m_reader = 0;
+        }
+
+        if (m_is)
+        {
+          delete m_is;
+          m_is = 0;
+        }
+      }
+
+      //! Move the replay position. Messages before the new position
+      //! still update the replay state (entity ids and vehicle state)
+      //! but are not dispatched. Chunked logs jump to the chunk
+      //! holding the new position, other logs are read again from the
+      //! start when seeking backwards.
+      //! @param[in] offset time from the start of the log (s).
+      void
+      seek(double offset)
+      {
+        double target = m_log_start + offset;
+        IMC::ChunkedLogInput* cli = dynamic_cast<IMC::ChunkedLogInput*>(m_is);
+
+        m_msg = 0;
+        m_anchored = false;
+
+        if (cli)
+        {
+          IMC::ChunkedLogReader& reader = cli->getReader();
+          if (target <= m_last_ts || reader.findChunk(target) > reader.findChunk(m_last_ts))
+          {
+            cli->seek(target);
+            m_reader->reset();
+          }
+        }
+        else if (target <= m_last_ts)
+        {
+          std::string file = m_file;
+          closeFile();
+
+          if (!openFile(file))
+          {
+            stopReplay();
+            return;
+          }
+        }
+
+        m_seeking = true;
+        m_seek_target = target;
+        m_last_ts = std::min(m_last_ts, target);
+
+        inf("%s %0.3f s", DTR("seeking to"), offset);
       }
 
       void
@@ -316,11 +505,18 @@ namespace Transports
       {
         requestDeactivation();
 
-        if (m_is)
+        closeFile();
+
+        m_paused = false;
+        m_seeking = false;
+        m_anchored = false;
+
+        if (m_virtual)
         {
-          delete m_is;
-          m_is = 0;
+          Clock::clearVirtual();
+          m_virtual = false;
         }
+
         m_eid2eid.clear();
         m_name2eid.clear();
         m_eid2name.clear();
@@ -328,6 +524,126 @@ namespace Transports
         m_tgstats = Stats();
       }
 
+      //! Read the next message to dispatch, updating the replay
+      //! state with the messages read on the way.
+      //! @return message or NULL at the end of the log.
+      IMC::Message*
+      readNext(void)
+      {
+        IMC::Message* m = 0;
+
+        while (true)
+        {
+          try
+          {
+            m = m_reader->next();
+          }
+          catch (std::exception& e)
+          {
+            err("%s: %s", DTR("deserialization error"), e.what());
+            return 0;
+          }
+
+          if (m == 0)
+            return 0;
+
+          // LBLConfig is replayed with the time of the previous message.
+          if (m->getId() != DUNE_IMC_LBLCONFIG)
+            m_last_ts = m->getTimeStamp();
+
+          if (m->getId() == DUNE_IMC_ESTIMATEDSTATE)
+          {
+            m_estate = *static_cast<IMC::EstimatedState*>(m);
+          }
+          else if (m->getId() == DUNE_IMC_ENTITYINFO)
+          {
+            // Update entity id map
+            IMC::EntityInfo* ei = static_cast<IMC::EntityInfo*>(m);
+            Name2Eid::iterator itr = m_name2eid.find(ei->label);
+
+            if (itr != m_name2eid.end())
+            {
+              m_eid2eid[ei->id] = itr->second;
+
+              trace("entity %s %d --> %d", ei->label.c_str(), (int)ei->id, (int)itr->second);
+            }
+          }
+
+          m->setSourceEntity(mapEntity(m->getSourceEntity()));
+          m->setDestinationEntity(mapEntity(m->getDestinationEntity()));
+
+          if (!(m->getId() == DUNE_IMC_ENTITYSTATE && m->getSourceEntity() != DUNE_IMC_CONST_UNK_EID) && m_replay.find(m->getName()) == m_replay.end())
+            continue;
+
+          if (m_seeking)
+          {
+            if (m_last_ts < m_seek_target)
+              continue;
+
+            m_seeking = false;
+          }
+
+          m_msg_time = m_last_ts;
+          return m;
+        }
+      }
+
+      //! Anchor the log timeline at a given log time. Messages are
+      //! stamped so that the next one is dispatched with the current
+      //! time, which is the virtual time when replaying as fast as
+      //! possible.
+      //! @param[in] t log time.
+      void
+      anchor(double t)
+      {
+        if (m_speed > 0 && m_virtual)
+        {
+          Clock::clearVirtual();
+          m_virtual = false;
+        }
+
+        m_ts_delta = Clock::getSinceEpoch() - t;
+        m_log_anchor = t;
+        m_wall_anchor = Clock::get();
+        m_virtual = (m_speed <= 0);
+        m_anchored = true;
+      }
+
+      //! Wait until a message with a given log time is due.
+      //! @param[in] t log time.
+      //! @param[out] delay time elapsed since the message was due (s).
+      //! @return true if the message is due, false if the wait was
+      //! interrupted by a control request.
+      bool
+      pace(double t, double& delay)
+      {
+        if (!m_anchored)
+          anchor(t);
+
+        delay = 0;
+
+        if (m_speed <= 0)
+          return true;
+
+        double due = m_wall_anchor + (t - m_log_anchor) / m_speed;
+        double now = Clock::get();
+
+        // Delay::wait does not behave satisfactorily for shorter
+        // waits in some systems.
+        while (due - now >= 1e-03)
+        {
+          waitForMessages(std::min(due - now, c_wait_slice));
+
+          if (m_msg == 0 || m_paused || !m_anchored || stopping())
+            return false;
+
+          now = Clock::get();
+        }
+
+        delay = std::max(now - due, 0.0);
+        return true;
+      }
+
       void
       onMain(void)
       {
@@ -336,7 +652,7 @@ namespace Transports
 
         while (!stopping())
         {
-          if (!isActive())
+          if (!isActive() || m_paused)
           {
             waitForMessages(1.0);
             continue;
@@ -344,89 +660,47 @@ namespace Transports
 
           consumeMessages(); // for possible ReplayControl requests
 
-          if (!isActive())
+          if (!isActive() || m_paused)
             continue;
 
-          IMC::Message* m = 0;
-
-          while (!stopping() && (m = DUNE::IMC::Packet::deserialize(*m_is)) != 0 && !m_is->eof())
+          if (m_msg == 0)
           {
-            consumeMessages();
+            m_msg = readNext();
 
-            if (m->getId() == DUNE_IMC_ESTIMATEDSTATE)
+            if (m_msg == 0)
             {
-              m_estate = *static_cast<IMC::EstimatedState*>(m);
+              stopReplay();
+              continue;
             }
-            else if (m->getId() == DUNE_IMC_ENTITYINFO)
-            {
-              // Update entity id map
-              IMC::EntityInfo* ei = static_cast<IMC::EntityInfo*>(m);
-              Name2Eid::iterator itr = m_name2eid.find(ei->label);
+          }
 
-              if (itr != m_name2eid.end())
-              {
-                m_eid2eid[ei->id] = itr->second;
+          double delay = 0;
+          if (!pace(m_msg_time, delay))
+            continue;
 
-                trace("entity %s %d --> %d", ei->label.c_str(), (int)ei->id, (int)itr->second);
-              }
-            }
+          double new_ts = m_msg_time + m_ts_delta;
+          m_msg->setTimeStamp(new_ts);
 
-            m->setSourceEntity(mapEntity(m->getSourceEntity()));
-            m->setDestinationEntity(mapEntity(m->getDestinationEntity()));
+          if (m_virtual)
+            Clock::setVirtual(new_ts);
 
-            if ((m->getId() == DUNE_IMC_ENTITYSTATE && m->getSourceEntity() != DUNE_IMC_CONST_UNK_EID) || m_replay.find(m->getName()) != m_replay.end())
-            {
-              double original_ts;
-
-              if (m->getId() == DUNE_IMC_LBLCONFIG)
-                original_ts = m_start_time - m_ts_delta;
-              else
-                original_ts = m->getTimeStamp();
-
-              double new_ts = original_ts + m_ts_delta;
-              m->setTimeStamp(new_ts);
-
-              // Wait till the time is right
-              double now = Clock::getSinceEpoch();
-              double delta = new_ts - now;
-
-              double delay;
-
-              if (delta >= 1e-03)
-              {
-                // Delay::wait does not behave satisfactorily otherwise
-                // in some systems
-                Delay::wait(delta);
-                delay = Clock::getSinceEpoch() - new_ts;
-              }
-              else
-              {
-                delay = 0;
-                delta = 0;
-              }
-
-              // Counter for delay before bus delivery
-              updateStats(m_tstats[m->getName()], delay);
-              updateStats(m_tgstats, delay);
-
-              // Dispatch message
-              dispatch(m, DF_KEEP_TIME);
-
-              if (now >= m_next_stats)
-              {
-                displayStats();
-                m_next_stats += c_stats_period;
-              }
-
-              spew("%s %0.4f %s", m->getName(), (new_ts - m_start_time),
-                   m_eid2name[m->getSourceEntity()].c_str());
-            }
+          // Counter for delay before bus delivery
+          updateStats(m_tstats[m_msg->getName()], delay);
+          updateStats(m_tgstats, delay);
+
+          // Dispatch message
+          dispatch(m_msg, DF_KEEP_TIME);
+
+          if (Clock::getSinceEpoch() >= m_next_stats)
+          {
+            displayStats();
+            m_next_stats += c_stats_period;
           }
 
-          stopReplay();
+          spew("%s %0.4f %s", m_msg->getName(), (new_ts - m_start_time),
+               m_eid2name[m_msg->getSourceEntity()].c_str());
 
-          // Clean up
-          delete m;
+          m_msg = 0;
         }
       }
 
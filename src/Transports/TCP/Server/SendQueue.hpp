@@ -0,0 +1,272 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Eduardo Marques                                                  *
+//***************************************************************************
+
+#ifndef TRANSPORTS_TCP_SERVER_SEND_QUEUE_HPP_INCLUDED_
+#define TRANSPORTS_TCP_SERVER_SEND_QUEUE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <list>
+#include <map>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Transports
+{
+  namespace TCP
+  {
+    namespace Server
+    {
+      using DUNE_NAMESPACES;
+
+      //! Bounded queue of serialized packets waiting to be sent to a
+      //! client. Packets are written without blocking, so a client
+      //! that does not keep up only grows its own queue. When the
+      //! queue is full the overflow policy decides what to give up.
+      class SendQueue
+      {
+      public:
+        //! Overflow policy.
+        enum Policy
+        {
+          //! Drop the oldest queued packet.
+          POLICY_DROP_OLDEST,
+          //! Replace a queued packet of the same message, source and
+          //! source entity, otherwise drop the oldest packet.
+          POLICY_COALESCE,
+          //! Give up on the client.
+          POLICY_DISCONNECT
+        };
+
+        //! Constructor.
+        //! @param[in] capacity maximum number of queued packets.
+        //! @param[in] policy overflow policy.
+        SendQueue(size_t capacity, Policy policy):
+          m_capacity(std::max(capacity, (size_t)2)),
+          m_policy(policy),
+          m_offset(0),
+          m_depth_max(0),
+          m_drops(0),
+          m_coalesced(0)
+        { }
+
+        //! Queue a serialized packet.
+        //! @param[in] p packet.
+        //! @param[in] n packet size.
+        //! @return false if the queue is full and the policy is to
+        //! disconnect the client, true otherwise.
+        bool
+        push(const uint8_t* p, unsigned n)
+        {
+          uint64_t key = 0;
+
+          if (m_policy == POLICY_COALESCE)
+          {
+            key = getKey(p, n);
+
+            Index::iterator itr = m_index.find(key);
+            if (itr != m_index.end())
+            {
+              itr->second->data.assign(p, p + n);
+              ++m_coalesced;
+              return true;
+            }
+          }
+
+          if (m_packets.size() >= m_capacity)
+          {
+            if (m_policy == POLICY_DISCONNECT)
+              return false;
+
+            dropOldest();
+          }
+
+          m_packets.push_back(Packet());
+          m_packets.back().data.assign(p, p + n);
+          m_packets.back().key = key;
+
+          if (m_policy == POLICY_COALESCE)
+            m_index[key] = --m_packets.end();
+
+          m_depth_max = std::max(m_depth_max, m_packets.size());
+          return true;
+        }
+
+        //! Write queued packets until the socket would block.
+        //! @param[in] sock client socket.
+        //! @return true if the queue was emptied, false otherwise.
+        bool
+        flush(TCPSocket& sock)
+        {
+          while (!m_packets.empty())
+          {
+            Packet& pkt = m_packets.front();
+
+            // The first packet can no longer be replaced once it is
+            // partially sent.
+            if (m_offset == 0)
+              unindex(m_packets.begin());
+
+            size_t rv = sock.write(&pkt.data[m_offset], pkt.data.size() - m_offset);
+            if (rv == 0)
+              return false;
+
+            m_offset += rv;
+            if (m_offset < pkt.data.size())
+              return false;
+
+            m_packets.pop_front();
+            m_offset = 0;
+          }
+
+          return true;
+        }
+
+        //! Test if there are packets waiting to be sent.
+        //! @return true if the queue is empty, false otherwise.
+        bool
+        empty(void) const
+        {
+          return m_packets.empty();
+        }
+
+        //! Get the number of queued packets.
+        //! @return number of queued packets.
+        size_t
+        getDepth(void) const
+        {
+          return m_packets.size();
+        }
+
+        //! Get the largest number of queued packets so far.
+        //! @return high-water mark.
+        size_t
+        getMaximumDepth(void) const
+        {
+          return m_depth_max;
+        }
+
+        //! Get the number of packets dropped so far.
+        //! @return number of dropped packets.
+        unsigned
+        getDropCount(void) const
+        {
+          return m_drops;
+        }
+
+        //! Get the number of packets replaced by newer ones so far.
+        //! @return number of coalesced packets.
+        unsigned
+        getCoalesceCount(void) const
+        {
+          return m_coalesced;
+        }
+
+      private:
+        //! Queued packet.
+        struct Packet
+        {
+          //! Serialized packet.
+          std::vector<uint8_t> data;
+          //! Coalescing key.
+          uint64_t key;
+        };
+
+        typedef std::list<Packet> PacketList;
+        typedef std::map<uint64_t, PacketList::iterator> Index;
+
+        //! Maximum number of queued packets.
+        size_t m_capacity;
+        //! Overflow policy.
+        Policy m_policy;
+        //! Queued packets.
+        PacketList m_packets;
+        //! Packets that can be coalesced, by key.
+        Index m_index;
+        //! Bytes of the first packet already sent.
+        size_t m_offset;
+        //! Largest number of queued packets.
+        size_t m_depth_max;
+        //! Number of dropped packets.
+        unsigned m_drops;
+        //! Number of coalesced packets.
+        unsigned m_coalesced;
+
+        //! Compute the coalescing key of a packet from its message
+        //! identifier, source and source entity.
+        //! @param[in] p packet.
+        //! @param[in] n packet size.
+        //! @return coalescing key.
+        static uint64_t
+        getKey(const uint8_t* p, unsigned n)
+        {
+          IMC::Header hdr;
+          IMC::Packet::deserializeHeader(hdr, p, n);
+          return ((uint64_t)hdr.mgid << 24) | ((uint64_t)hdr.src << 8) | hdr.src_ent;
+        }
+
+        //! Forget the coalescing key of a packet.
+        //! @param[in] itr packet.
+        void
+        unindex(PacketList::iterator itr)
+        {
+          if (m_policy != POLICY_COALESCE)
+            return;
+
+          Index::iterator i = m_index.find(itr->key);
+          if (i != m_index.end() && i->second == itr)
+            m_index.erase(i);
+        }
+
+        //! Drop the oldest packet that was not partially sent.
+        void
+        dropOldest(void)
+        {
+          PacketList::iterator itr = m_packets.begin();
+          if (m_offset > 0)
+            ++itr;
+
+          unindex(itr);
+          m_packets.erase(itr);
+          ++m_drops;
+        }
+
+        // Non-copyable.
+        SendQueue(const SendQueue&);
+
+        // Non-assignable.
+        SendQueue&
+        operator=(const SendQueue&);
+      };
+    }
+  }
+}
+
+#endif
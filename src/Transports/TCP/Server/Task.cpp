@@ -30,6 +30,9 @@
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// Local headers.
+#include "SendQueue.hpp"
+
 namespace Transports
 {
   namespace TCP
@@ -45,6 +48,12 @@ namespace Transports
         uint16_t port;
         //! True to announce service.
         bool announce;
+        //! Maximum number of packets queued per client.
+        unsigned queue_size;
+        //! Slow client policy.
+        std::string queue_policy;
+        //! Period of queue statistics reports.
+        double stats_period;
       };
 
       struct Task: public Tasks::SimpleTransport
@@ -65,15 +74,22 @@ namespace Transports
           Address address; // Client address.
           uint16_t port; // Client port.
           IMC::Parser parser; // Parser handle
+          SendQueue* queue; // Outgoing packets.
+          bool writing; // True if waiting for write readiness.
         };
 
         // Client list.
         typedef std::list<Client> ClientList;
         ClientList m_clients;
+        // Slow client policy.
+        SendQueue::Policy m_policy;
+        // Queue statistics timer.
+        Time::Counter<double> m_stats_timer;
 
         Task(const std::string& name, Tasks::Context& ctx):
           Tasks::SimpleTransport(name, ctx),
-          m_sock(0)
+          m_sock(0),
+          m_policy(SendQueue::POLICY_DROP_OLDEST)
         {
           param("Port", m_args.port)
           .defaultValue("7001")
@@ -82,6 +98,37 @@ namespace Transports
           param("Announce Service", m_args.announce)
           .defaultValue("true")
           .description("Set to true to announce the service");
+
+          param("Send Queue Size", m_args.queue_size)
+          .defaultValue("1024")
+          .minimumValue("2")
+          .description("Maximum number of packets waiting to be sent to each client");
+
+          param("Slow Client Policy", m_args.queue_policy)
+          .defaultValue("Drop Oldest")
+          .values("Drop Oldest, Coalesce, Disconnect")
+          .description("Action taken when the send queue of a client is full."
+                       " Coalesce replaces queued packets of the same message,"
+                       " source and source entity");
+
+          param("Statistics Period", m_args.stats_period)
+          .defaultValue("10.0")
+          .minimumValue("0.0")
+          .units(Units::Second)
+          .description("Period of per-client send queue reports, zero to disable");
+        }
+
+        void
+        onUpdateParameters(void)
+        {
+          if (m_args.queue_policy == "Coalesce")
+            m_policy = SendQueue::POLICY_COALESCE;
+          else if (m_args.queue_policy == "Disconnect")
+            m_policy = SendQueue::POLICY_DISCONNECT;
+          else
+            m_policy = SendQueue::POLICY_DROP_OLDEST;
+
+          m_stats_timer.setTop(m_args.stats_period);
         }
 
         ~Task(void)
@@ -173,6 +220,7 @@ namespace Transports
 
           m_poll.remove(*c.socket);
           delete c.socket;
+          delete c.queue;
         }
 
         void
@@ -182,6 +230,7 @@ namespace Transports
           {
             m_poll.remove(*itr->socket);
             delete itr->socket;
+            delete itr->queue;
           }
 
           m_clients.clear();
@@ -203,7 +252,10 @@ namespace Transports
           {
             try
             {
-              itr->socket->write((char*)p, n);
+              if (!itr->queue->push(p, n))
+                throw std::runtime_error(DTR("send queue is full"));
+
+              flushClient(*itr);
             }
             catch (std::runtime_error& e)
             {
@@ -215,9 +267,46 @@ namespace Transports
           }
         }
 
+        //! Send queued packets without blocking and wait for write
+        //! readiness only while some are left.
+        //! @param[in] c client.
+        void
+        flushClient(Client& c)
+        {
+          bool writing = !c.queue->flush(*c.socket);
+          if (writing == c.writing)
+            return;
+
+          m_poll.modify(*c.socket, writing ? (Poll::EV_READ | Poll::EV_WRITE) : Poll::EV_READ);
+          c.writing = writing;
+        }
+
+        void
+        reportQueues(void)
+        {
+          for (ClientList::iterator itr = m_clients.begin(); itr != m_clients.end(); ++itr)
+          {
+            IMC::Event ev;
+            ev.topic = "TCP Client Queue";
+            ev.data = String::str("address=%s;port=%u;depth=%u;max_depth=%u;dropped=%u;coalesced=%u",
+                                  itr->address.c_str(), itr->port,
+                                  (unsigned)itr->queue->getDepth(),
+                                  (unsigned)itr->queue->getMaximumDepth(),
+                                  itr->queue->getDropCount(),
+                                  itr->queue->getCoalesceCount());
+            dispatch(ev);
+          }
+        }
+
         void
         onDataReception(uint8_t* buf, unsigned int cap, double timeout)
         {
+          if (m_args.stats_period > 0 && m_stats_timer.overflow())
+          {
+            reportQueues();
+            m_stats_timer.reset();
+          }
+
           // Poll for connections and client data
           if (!m_poll.poll(timeout))
             return;
@@ -235,13 +324,15 @@ namespace Transports
         {
           Client c;
           c.socket = 0;
+          c.queue = 0;
+          c.writing = false;
           try
           {
             c.socket = m_sock->accept(&c.address, &c.port);
             c.socket->setKeepAlive(true);
             c.socket->setNoDelay(true);
-            c.socket->setReceiveTimeout(5);
-            c.socket->setSendTimeout(5);
+            c.socket->setNonBlocking(true);
+            c.queue = new SendQueue(m_args.queue_size, m_policy);
             m_poll.add(*c.socket);
             m_clients.push_back(c);
             updateEntityState(m_clients.size());
@@ -253,6 +344,7 @@ namespace Transports
           {
             if (c.socket)
               delete c.socket;
+            delete c.queue;
             err(DTR("error accepting new client connection: %s"), e.what());
           }
         }
@@ -265,17 +357,21 @@ namespace Transports
 
           while (itr != m_clients.end())
           {
-            if (!m_poll.wasTriggered(*itr->socket))
+            if (!m_poll.wasTriggered(*itr->socket, Poll::EV_READ | Poll::EV_WRITE))
             {
               ++itr;
               continue;
             }
 
-            int n;
+            int n = 0;
 
             try
             {
-              n = itr->socket->read((char*)buf, cap);
+              if (m_poll.wasTriggered(*itr->socket, Poll::EV_WRITE))
+                flushClient(*itr);
+
+              if (m_poll.wasTriggered(*itr->socket, Poll::EV_READ))
+                n = itr->socket->read((char*)buf, cap);
             }
             catch (std::runtime_error& e)
             {
@@ -0,0 +1,149 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef TRANSPORTS_UDP_DATAGRAM_BATCH_HPP_INCLUDED_
+#define TRANSPORTS_UDP_DATAGRAM_BATCH_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Transports
+{
+  namespace UDP
+  {
+    using DUNE_NAMESPACES;
+
+    //! Outgoing datagrams collected during one wake-up cycle of the
+    //! task and sent together with as few system calls as possible.
+    //! Packets are serialized once into the batch buffer and every
+    //! destination refers to the same bytes.
+    class DatagramBatch
+    {
+    public:
+      //! Constructor.
+      //! @param[in] sock socket used to send datagrams.
+      //! @param[in] capacity buffer capacity in bytes.
+      //! @param[in] max_dgrams maximum number of pending datagrams.
+      DatagramBatch(UDPSocket& sock, size_t capacity, size_t max_dgrams):
+        m_sock(sock),
+        m_bfr(capacity),
+        m_used(0),
+        m_max_dgrams(max_dgrams)
+      {
+        m_dgrams.reserve(max_dgrams);
+      }
+
+      //! Get space for the next packet, sending the pending
+      //! datagrams first if there is not enough of it.
+      //! @param[in] size maximum packet size.
+      //! @return pointer to the free space.
+      uint8_t*
+      reserve(size_t size)
+      {
+        if (m_bfr.size() - m_used < size)
+          flush();
+
+        return &m_bfr[m_used];
+      }
+
+      //! Mark space obtained with reserve() as used.
+      //! @param[in] size packet size.
+      void
+      commit(size_t size)
+      {
+        m_used += size;
+      }
+
+      //! Queue a datagram. Data is copied unless it was placed in
+      //! the batch buffer with reserve() and commit().
+      //! @param[in] data datagram data.
+      //! @param[in] size datagram size.
+      //! @param[in] addr destination address.
+      //! @param[in] port destination port.
+      void
+      write(const uint8_t* data, size_t size, const Address& addr, uint16_t port)
+      {
+        if (m_dgrams.size() >= m_max_dgrams)
+          send();
+
+        UDPSocket::Datagram dgram;
+        dgram.data = const_cast<uint8_t*>(data);
+        dgram.size = size;
+        dgram.addr = addr;
+        dgram.port = port;
+
+        if (data < &m_bfr[0] || data >= &m_bfr[0] + m_bfr.size())
+        {
+          dgram.data = reserve(size);
+          std::memcpy(dgram.data, data, size);
+          commit(size);
+        }
+
+        m_dgrams.push_back(dgram);
+      }
+
+      //! Send pending datagrams and release the batch buffer.
+      void
+      flush(void)
+      {
+        send();
+        m_used = 0;
+      }
+
+    private:
+      //! Socket.
+      UDPSocket& m_sock;
+      //! Packet buffer.
+      std::vector<uint8_t> m_bfr;
+      //! Bytes used in the packet buffer.
+      size_t m_used;
+      //! Maximum number of pending datagrams.
+      size_t m_max_dgrams;
+      //! Pending datagrams.
+      std::vector<UDPSocket::Datagram> m_dgrams;
+
+      //! Send pending datagrams, keeping the contents of the batch
+      //! buffer.
+      void
+      send(void)
+      {
+        if (m_dgrams.empty())
+          return;
+
+        m_sock.write(&m_dgrams[0], m_dgrams.size());
+        m_dgrams.clear();
+      }
+    };
+  }
+}
+
+#endif
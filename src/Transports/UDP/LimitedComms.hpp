@@ -54,7 +54,8 @@ namespace Transports
         m_comm_range(comm_range),
         m_local_id(local_id),
         m_active(false),
-        m_underwater_comms(false)
+        m_underwater_comms(false),
+        m_generation(0)
       {
         m_last_calc.setTop(SECONDS_BETWEEN_CALCULATIONS);
         std::memset(m_position, 0, sizeof(m_position));
@@ -88,10 +89,8 @@ namespace Transports
         ScopedRWLock l(m_positions_lock, true);
         std::map<unsigned, NodePosition>::iterator itr = m_node_positions.find(id);
         bool within_range = isReachable(lat, lon, alt);
-        if (itr == m_node_positions.end())
-        {
-          m_node_positions[id] = NodePosition();
-        }
+        if (itr == m_node_positions.end() || itr->second.visible != within_range)
+          ++m_generation;
 
         m_node_positions[id].lat = lat;
         m_node_positions[id].lon = lon;
@@ -172,6 +171,16 @@ namespace Transports
         return m_comm_range;
       }
 
+      //! Get a counter that changes whenever the visibility of a
+      //! node changes.
+      //! @return visibility generation.
+      unsigned
+      getGeneration(void)
+      {
+        ScopedRWLock l(m_positions_lock);
+        return m_generation;
+      }
+
     private:
       struct NodePosition
       {
@@ -201,6 +210,8 @@ namespace Transports
       std::vector<unsigned> m_allowed_messages;
       // Lock to serialize access to m_allowed_messages.
       RWLock m_allowed_msgs_lock;
+      // Visibility generation.
+      unsigned m_generation;
 
       void
       recomputeVisibleNodes(void)
@@ -219,6 +230,9 @@ namespace Transports
             pos.visible = false;
 
           //std::cerr << itr->first << " is visible: " << pos.visible << "\n";
+          if (pos.visible != itr->second.visible)
+            ++m_generation;
+
           m_node_positions[itr->first] = pos;
         }
         m_last_calc.reset();
@@ -51,10 +51,13 @@ namespace Transports
     {
     public:
       Listener(Tasks::Task& task, UDPSocket& sock, LimitedComms* lcomms,
-               float contact_timeout, bool trace = false):
+               float contact_timeout, bool trace = false, bool batch = false,
+               bool only_addressed = false):
         m_task(task),
         m_sock(sock),
         m_trace(trace),
+        m_batch(batch),
+        m_only_addressed(only_addressed),
         m_contacts(contact_timeout),
         m_lcomms(lcomms)
       {  }
@@ -80,6 +83,8 @@ namespace Transports
     private:
       // Buffer capacity.
       static const int c_bfr_size = 65535;
+      // Maximum number of datagrams received at once.
+      static const unsigned c_batch_size = 16;
       // Poll timeout in milliseconds.
       static const int c_poll_tout = 1000;
       // Parent task.
@@ -88,6 +93,10 @@ namespace Transports
       UDPSocket& m_sock;
       // True to print incoming messages.
       bool m_trace;
+      // True to receive several datagrams per system call.
+      bool m_batch;
+      // True to discard messages addressed to other systems.
+      bool m_only_addressed;
       // Table of contacts.
       ContactTable m_contacts;
       // Lock to serialize access to m_contacts.
@@ -98,8 +107,9 @@ namespace Transports
       void
       run(void)
       {
-        Address addr;
-        uint8_t* bfr = new uint8_t[c_bfr_size];
+        unsigned count = m_batch ? c_batch_size : 1;
+        uint8_t* bfr = new uint8_t[c_bfr_size * count];
+        std::vector<UDPSocket::Datagram> dgrams(count);
         double poll_tout = c_poll_tout / 1000.0;
 
         while (!isStopping())
@@ -109,41 +119,75 @@ namespace Transports
             if (!Poll::poll(m_sock, poll_tout))
               continue;
 
-            uint16_t rv = m_sock.read(bfr, c_bfr_size, &addr);
-            IMC::Message* msg = IMC::Packet::deserialize(bfr, rv);
+            if (!m_batch)
+            {
+              uint16_t rv = m_sock.read(bfr, c_bfr_size, &dgrams[0].addr);
+              handleDatagram(bfr, rv, dgrams[0].addr);
+              continue;
+            }
 
-            if (m_lcomms->isActive())
+            for (unsigned i = 0; i < count; ++i)
             {
-              if (msg->getId() == DUNE_IMC_ANNOUNCE)
-              {
-                m_lcomms->setAnnounce(static_cast<IMC::Announce*>(msg));
-              }
-
-              if (!m_lcomms->isNodeWithinRange(msg->getSource(), msg->getId()))
-              {
-                delete msg;
-                continue;
-              }
+              dgrams[i].data = bfr + i * c_bfr_size;
+              dgrams[i].size = c_bfr_size;
             }
 
-            m_contacts_lock.lockWrite();
-            m_contacts.update(msg->getSource(), addr);
-            m_contacts_lock.unlock();
+            size_t n = m_sock.read(&dgrams[0], count);
+            for (size_t i = 0; i < n; ++i)
+              handleDatagram(dgrams[i].data, dgrams[i].size, dgrams[i].addr);
+          }
+          catch (std::exception & e)
+          {
+            m_task.debug("error while receiving data: %s", e.what());
+          }
+        }
 
-            m_task.dispatch(msg, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+        delete [] bfr;
+      }
 
-            if (m_trace)
-              msg->toText(std::cerr);
+      void
+      handleDatagram(const uint8_t* bfr, size_t size, const Address& addr)
+      {
+        try
+        {
+          IMC::Message* msg = IMC::Packet::deserialize(bfr, size);
 
+          if (m_only_addressed && msg->getDestination() != IMC::AddressResolver::invalid()
+              && msg->getDestination() != m_task.getSystemId())
+          {
             delete msg;
+            return;
           }
-          catch (std::exception & e)
+
+          if (m_lcomms->isActive())
           {
-            m_task.debug("error while unpacking message: %s",e.what());
+            if (msg->getId() == DUNE_IMC_ANNOUNCE)
+            {
+              m_lcomms->setAnnounce(static_cast<IMC::Announce*>(msg));
+            }
+
+            if (!m_lcomms->isNodeWithinRange(msg->getSource(), msg->getId()))
+            {
+              delete msg;
+              return;
+            }
           }
-        }
 
-        delete [] bfr;
+          m_contacts_lock.lockWrite();
+          m_contacts.update(msg->getSource(), addr);
+          m_contacts_lock.unlock();
+
+          m_task.dispatch(msg, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+
+          if (m_trace)
+            msg->toText(std::cerr);
+
+          delete msg;
+        }
+        catch (std::exception & e)
+        {
+          m_task.debug("error while unpacking message: %s",e.what());
+        }
       }
     };
   }
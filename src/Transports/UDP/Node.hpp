@@ -137,19 +137,44 @@ namespace Transports
         return true;
       }
 
+      //! Check if the node has an active address.
+      //! @return true if the node is active, false otherwise.
+      bool
+      isActive(void) const
+      {
+        return m_active != m_addrs.end();
+      }
+
+      //! Get the active address of the node.
+      //! @return active address.
+      const Address&
+      getActiveAddress(void) const
+      {
+        return m_active->first;
+      }
+
+      //! Get the active port of the node.
+      //! @return active port.
+      unsigned
+      getActivePort(void) const
+      {
+        return m_active->second;
+      }
+
       //! Send data to node.
-      //! @param[in] sock UDP destination socket.
+      //! @param[in] out UDP socket or datagram batch.
       //! @param[in] data data to be transmitted.
       //! @param[in] data_len length of data to be transmitted.
+      template <typename Output>
       void
-      send(UDPSocket& sock, const uint8_t* data, unsigned data_len)
+      send(Output& out, const uint8_t* data, unsigned data_len)
       {
         if (m_active == m_addrs.end())
           return;
 
         try
         {
-          sock.write(data, data_len, m_active->first, m_active->second);
+          out.write(data, data_len, m_active->first, m_active->second);
         }
         catch (...)
         { }
@@ -33,6 +33,7 @@
 // ISO C++ 98 headers.
 #include <string>
 #include <map>
+#include <vector>
 #include <cstdio>
 
 // DUNE headers.
@@ -40,6 +41,7 @@
 
 // Local headers.
 #include "Node.hpp"
+#include "NodeAddress.hpp"
 #include "LimitedComms.hpp"
 
 namespace Transports
@@ -53,13 +55,15 @@ namespace Transports
     public:
       NodeTable(void):
         m_active_count(0),
-        m_lcomms(NULL)
+        m_lcomms(NULL),
+        m_generation(0)
       { }
 
       void
       addNode(unsigned id, const std::string& name, const std::string& services)
       {
-        m_table.insert(std::pair<unsigned, Node>(id, Node(name, services)));
+        if (m_table.insert(std::pair<unsigned, Node>(id, Node(name, services))).second)
+          ++m_generation;
       }
 
       bool
@@ -73,6 +77,7 @@ namespace Transports
           return false;
 
         ++m_active_count;
+        ++m_generation;
         return true;
       }
 
@@ -87,6 +92,7 @@ namespace Transports
           return false;
 
         --m_active_count;
+        ++m_generation;
         return true;
       }
 
@@ -96,25 +102,26 @@ namespace Transports
         return m_active_count;
       }
 
+      //! Send data to all active nodes.
+      //! @param[in] out UDP socket or datagram batch.
+      //! @param[in] data data to be transmitted.
+      //! @param[in] data_len length of data to be transmitted.
+      //! @param[in] msgid identifier of the transmitted message.
+      template <typename Output>
       void
-      send(UDPSocket& sock, const uint8_t* data, unsigned data_len, unsigned msgid)
+      send(Output& out, const uint8_t* data, unsigned data_len, unsigned msgid)
       {
-        if (m_lcomms != NULL)
+        const std::vector<NodeAddress>& dsts = getDestinations(msgid);
+
+        for (unsigned i = 0; i < dsts.size(); ++i)
         {
-          if (m_lcomms->isActive())
+          try
           {
-            for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
-            {
-              if (m_lcomms->isNodeWithinRange(itr->first, msgid))
-                itr->second.send(sock, data, data_len);
-            }
-
-            return;
+            out.write(data, data_len, dsts[i].getAddress(), dsts[i].getPort());
           }
+          catch (...)
+          { }
         }
-
-        for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
-          itr->second.send(sock, data, data_len);
       }
 
       void
@@ -124,6 +131,21 @@ namespace Transports
       }
 
     private:
+      //! Destinations of a message.
+      struct Destinations
+      {
+        //! Node table generation.
+        unsigned generation;
+        //! Limited communications generation.
+        unsigned lcomms_generation;
+        //! Addresses of the destination nodes.
+        std::vector<NodeAddress> addrs;
+      };
+
+      //! Key of the destinations of any message when communications
+      //! are not limited.
+      static const unsigned c_any_message = 0x10000;
+
       typedef std::map<unsigned, Node> Table;
       // Number of active nodes.
       unsigned m_active_count;
@@ -131,6 +153,54 @@ namespace Transports
       Table m_table;
       // Limited Comms object
       LimitedComms* m_lcomms;
+      // Node table generation, changed when nodes are added,
+      // activated or deactivated.
+      unsigned m_generation;
+      // Destinations by message identifier.
+      std::map<unsigned, Destinations> m_dsts;
+
+      //! Get the addresses of the active nodes that should receive a
+      //! message. With limited communications the range checks are
+      //! done once per message identifier and repeated only when the
+      //! table or the visibility of a node changes.
+      //! @param[in] msgid message identifier.
+      //! @return destination addresses.
+      const std::vector<NodeAddress>&
+      getDestinations(unsigned msgid)
+      {
+        bool limited = (m_lcomms != NULL && m_lcomms->isActive());
+        unsigned lcomms_generation = limited ? m_lcomms->getGeneration() : 0;
+
+        std::map<unsigned, Destinations>::iterator itr = m_dsts.find(limited ? msgid : c_any_message);
+        if (itr == m_dsts.end())
+        {
+          Destinations dsts;
+          dsts.generation = m_generation + 1;
+          itr = m_dsts.insert(std::make_pair(limited ? msgid : c_any_message, dsts)).first;
+        }
+
+        Destinations& dsts = itr->second;
+        if (dsts.generation == m_generation && dsts.lcomms_generation == lcomms_generation)
+          return dsts.addrs;
+
+        dsts.generation = m_generation;
+        dsts.lcomms_generation = lcomms_generation;
+        dsts.addrs.clear();
+
+        for (Table::iterator node = m_table.begin(); node != m_table.end(); ++node)
+        {
+          if (!node->second.isActive())
+            continue;
+
+          if (limited && !m_lcomms->isNodeWithinRange(node->first, msgid))
+            continue;
+
+          dsts.addrs.push_back(NodeAddress(node->second.getActiveAddress(),
+                                           node->second.getActivePort()));
+        }
+
+        return dsts.addrs;
+      }
     };
   }
 }
@@ -38,6 +38,7 @@
 #include <DUNE/DUNE.hpp>
 
 // Local headers.
+#include "DatagramBatch.hpp"
 #include "NodeAddress.hpp"
 #include "NodeTable.hpp"
 #include "Listener.hpp"
@@ -82,12 +83,26 @@ namespace Transports
       bool dynamic_nodes;
       // Only transmit messages from local system
       bool only_local;
+      // Only receive messages addressed to local system or broadcast.
+      bool only_addressed;
+      // Send and receive several datagrams per system call.
+      bool batch;
+      // Delivery mode of messages to dynamic nodes.
+      std::string delivery;
+      // Multicast address.
+      Address addr_mcast;
+      // Multicast port.
+      unsigned port_mcast;
     };
 
     // Internal buffer size.
     static const int c_bfr_size = 65535;
     // Port bind retries.
     static const int c_port_retries = 5;
+    // Outgoing batch buffer size.
+    static const int c_batch_bfr_size = 256 * 1024;
+    // Maximum number of datagrams in an outgoing batch.
+    static const int c_batch_dgrams = 256;
 
     struct Task: public DUNE::Tasks::Task
     {
@@ -113,12 +128,18 @@ namespace Transports
       LimitedComms* m_lcomms;
       //! Message Filter
       MessageFilter m_filter;
+      //! Outgoing datagram batch.
+      DatagramBatch* m_batch;
+      //! True to send messages for dynamic nodes to a multicast group.
+      bool m_multicast;
 
       Task(const std::string& name, Tasks::Context& ctx):
         DUNE::Tasks::Task(name, ctx),
         m_bfr(NULL),
         m_listener(NULL),
-        m_lcomms(NULL)
+        m_lcomms(NULL),
+        m_batch(NULL),
+        m_multicast(false)
       {
         param("Local Port", m_args.port)
         .defaultValue("6002")
@@ -178,6 +199,33 @@ namespace Transports
         .defaultValue("false")
         .description("Only transmit messsages from local system.");
 
+        param("Addressed Messages Only", m_args.only_addressed)
+        .defaultValue("false")
+        .description("Discard incoming messages addressed to other systems."
+                     " Required when a fleet simulator shares this network");
+
+        param("Batch Datagrams", m_args.batch)
+        .defaultValue("false")
+        .description("Send the datagrams of each wake-up cycle together and"
+                     " receive queued datagrams together, with as few"
+                     " system calls as possible");
+
+        param("Delivery Mode", m_args.delivery)
+        .defaultValue("Unicast")
+        .values("Unicast, Multicast")
+        .description("Send messages for dynamic nodes to each node or once to"
+                     " a multicast group. Nodes receive the group only if they"
+                     " also use multicast delivery and listen on the multicast"
+                     " port. Unicast is used while communications are limited");
+
+        param("Multicast Address", m_args.addr_mcast)
+        .defaultValue("224.0.75.69")
+        .description("Multicast group used by multicast delivery");
+
+        param("Multicast Port", m_args.port_mcast)
+        .defaultValue("6002")
+        .description("Destination port used by multicast delivery");
+
         // Allocate space for internal buffer.
         m_bfr = new uint8_t[c_bfr_size];
 
@@ -254,6 +302,19 @@ namespace Transports
 
         inf(DTR("listening on %s:%u"), Address(Address::Any).c_str(), m_args.port);
 
+        m_multicast = (m_args.delivery == "Multicast");
+        if (m_multicast)
+        {
+          m_sock.setMulticastTTL(1);
+          m_sock.setMulticastLoop(false);
+
+          std::vector<Interface> itfs = Interface::get();
+          for (unsigned i = 0; i < itfs.size(); ++i)
+            m_sock.joinMulticastGroup(m_args.addr_mcast, itfs[i].address());
+
+          inf(DTR("delivering to multicast group %s:%u"), m_args.addr_mcast.c_str(), m_args.port_mcast);
+        }
+
         if (m_args.announce_service)
         {
           // Initialize and dispatch AnnounceService.
@@ -282,8 +343,12 @@ namespace Transports
         m_node_table.setLimitedComms(m_lcomms);
 
         // Start listener thread.
+        if (m_args.batch)
+          m_batch = new DatagramBatch(m_sock, c_batch_bfr_size, c_batch_dgrams);
+
         m_listener = new Listener(*this, m_sock, m_lcomms,
-                                  m_args.contact_timeout, m_args.trace_in);
+                                  m_args.contact_timeout, m_args.trace_in,
+                                  m_args.batch, m_args.only_addressed);
         m_listener->start();
 
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
@@ -300,6 +365,7 @@ namespace Transports
         }
 
         Memory::clear(m_lcomms);
+        Memory::clear(m_batch);
       }
 
       void
@@ -323,24 +389,57 @@ namespace Transports
         if (m_args.trace_out)
           msg->toText(std::cerr);
 
-        uint16_t rv = IMC::Packet::serialize(msg, m_bfr, c_bfr_size);
+        if (m_batch != NULL)
+        {
+          uint8_t* bfr = m_batch->reserve(c_bfr_size);
+          uint16_t rv = IMC::Packet::serialize(msg, bfr, c_bfr_size);
+          m_batch->commit(rv);
+          send(*m_batch, bfr, rv, msg->getId());
+        }
+        else
+        {
+          uint16_t rv = IMC::Packet::serialize(msg, m_bfr, c_bfr_size);
+          send(m_sock, m_bfr, rv, msg->getId());
+        }
+      }
 
+      //! Send a serialized message to static and dynamic nodes.
+      //! @param[in] out UDP socket or datagram batch.
+      //! @param[in] data serialized message.
+      //! @param[in] data_len size of the serialized message.
+      //! @param[in] msgid message identifier.
+      template <typename Output>
+      void
+      send(Output& out, const uint8_t* data, uint16_t data_len, unsigned msgid)
+      {
         // Send to static nodes.
         std::set<NodeAddress>::iterator itr = m_static_dsts.begin();
         for (; itr != m_static_dsts.end(); ++itr)
         {
           try
           {
-            m_sock.write(m_bfr, rv, itr->getAddress(), itr->getPort());
+            out.write(data, data_len, itr->getAddress(), itr->getPort());
           }
           catch (...)
           { }
         }
 
-        if (m_args.dynamic_nodes)
+        if (!m_args.dynamic_nodes)
+          return;
+
+        // Send to dynamic nodes.
+        if (m_multicast && !m_lcomms->isActive())
+        {
+          try
+          {
+            out.write(data, data_len, m_args.addr_mcast, m_args.port_mcast);
+          }
+          catch (...)
+          { }
+        }
+        else
         {
-          // Send to dynamic nodes.
-          m_node_table.send(m_sock, m_bfr, rv, msg->getId());
+          m_node_table.send(out, data, data_len, msgid);
         }
       }
 
@@ -395,6 +494,9 @@ namespace Transports
         {
           waitForMessages(1.0);
 
+          if (m_batch != NULL)
+            m_batch->flush();
+
           // Check if it's time to update the contact list.
           if (m_contacts_refresh_counter.overflow())
           {
@@ -70,6 +70,24 @@ namespace Vision
         return  (128.0 * count)/(0.299 * ar + 0.587 * ag + 0.114 * ab);
       }
 
+      //! Calculate the gain update
+      //! @param[in] data luma plane.
+      //! @param[in] count number of pixels in data.
+      float
+      exposureCorrectionLuma(const uint8_t* data, unsigned count)
+      {
+        // Accumulate pixel values
+        unsigned long sum = 0;
+        for (unsigned i = 0; i < count; i++)
+          sum += data[i];
+
+        if (sum == 0)
+          sum = 1;
+
+        // Calculate the exposure time multiplier
+        return (128.0 * count) / sum;
+      }
+
     private:
     };
   }
@@ -0,0 +1,224 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Renato Caldas                                                    *
+//***************************************************************************
+
+
+#ifndef VISION_DFK51BG02H_STAGES_HPP_INCLUDED_
+#define VISION_DFK51BG02H_STAGES_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "WhiteBalance.hpp"
+#include "AutoExposure.hpp"
+
+// Import namespaces.
+using DUNE_NAMESPACES;
+
+namespace Vision
+{
+  namespace DFK51BG02H
+  {
+    //! Pipeline frame.
+    typedef FramePipeline::Frame PipelineFrame;
+
+    //! White balance, Bayer decoding to YUV420 and exposure
+    //! measurement.
+    class DecoderStage: public FramePipeline::Stage
+    {
+    public:
+      //! Constructor.
+      //! @param[in] white white-balance filter.
+      //! @param[in] debayer Bayer decoder.
+      //! @param[in] width frame width.
+      //! @param[in] height frame height.
+      //! @param[in] ae true to measure exposure corrections.
+      DecoderStage(WhiteBalance& white, BayerDecoder& debayer,
+                   unsigned width, unsigned height, bool ae):
+        m_white(white),
+        m_debayer(debayer),
+        m_width(width),
+        m_height(height),
+        m_ae(ae),
+        m_correction(1.0f),
+        m_pending(false)
+      { }
+
+      bool
+      process(PipelineFrame& frame, unsigned worker)
+      {
+        (void)worker;
+
+        frame.image.resize(m_width * m_height * 3 / 2);
+        m_white.filter(&frame.raw[0]);
+        m_debayer.decodeToYUV420(&frame.raw[0], &frame.image[0], m_width, m_height);
+
+        if (m_ae)
+        {
+          float correction = m_exposure.exposureCorrectionLuma(&frame.image[0], m_width * m_height);
+          ScopedMutex l(m_lock);
+          m_correction = correction;
+          m_pending = true;
+        }
+
+        return true;
+      }
+
+      //! Retrieve the exposure correction measured on the latest
+      //! frame. Corrections of older frames are superseded, since
+      //! they were measured with the same or an older exposure time.
+      //! @param[out] correction exposure time multiplier.
+      //! @return true if a correction is available, false otherwise.
+      bool
+      takeCorrection(float& correction)
+      {
+        ScopedMutex l(m_lock);
+        if (!m_pending)
+          return false;
+
+        correction = m_correction;
+        m_pending = false;
+        return true;
+      }
+
+    private:
+      //! White-balance filter.
+      WhiteBalance& m_white;
+      //! Bayer decoder.
+      BayerDecoder& m_debayer;
+      //! Frame width.
+      unsigned m_width;
+      //! Frame height.
+      unsigned m_height;
+      //! True to measure exposure corrections.
+      bool m_ae;
+      //! Exposure measurement.
+      AutoExposure m_exposure;
+      //! Latest exposure correction.
+      float m_correction;
+      //! True if a correction is available.
+      bool m_pending;
+      //! Lock for exposure correction.
+      Mutex m_lock;
+    };
+
+    //! JPEG encoding, one compressor per worker.
+    class EncoderStage: public FramePipeline::Stage
+    {
+    public:
+      //! Constructor.
+      //! @param[in] width frame width.
+      //! @param[in] height frame height.
+      //! @param[in] quality JPEG quality.
+      //! @param[in] workers number of workers.
+      EncoderStage(unsigned width, unsigned height, unsigned quality, unsigned workers):
+        m_quality(quality)
+      {
+        for (unsigned i = 0; i < workers; ++i)
+        {
+          JPEGCompressor* jpeg = new JPEGCompressor;
+          jpeg->setInputDimensions(width, height);
+          jpeg->setInputColorSpace(JPEGCompressor::CS_YUV420);
+          jpeg->setOutputColorSpace(JPEGCompressor::CS_YUV);
+          m_jpegs.push_back(jpeg);
+        }
+      }
+
+      ~EncoderStage(void)
+      {
+        for (unsigned i = 0; i < m_jpegs.size(); ++i)
+          delete m_jpegs[i];
+      }
+
+      bool
+      process(PipelineFrame& frame, unsigned worker)
+      {
+        JPEGCompressor* jpeg = m_jpegs[worker];
+        jpeg->compress(&frame.image[0], m_quality);
+        frame.encoded.assign(jpeg->imageData(), jpeg->imageData() + jpeg->imageSize());
+        return true;
+      }
+
+    private:
+      //! JPEG quality.
+      unsigned m_quality;
+      //! Compressors.
+      std::vector<JPEGCompressor*> m_jpegs;
+    };
+
+    //! Storage of JPEG and, optionally, raw PGM files.
+    class StorageStage: public FramePipeline::Stage
+    {
+    public:
+      //! Constructor.
+      //! @param[in] width frame width.
+      //! @param[in] height frame height.
+      //! @param[in] store_raw true to store raw frames.
+      StorageStage(unsigned width, unsigned height, bool store_raw):
+        m_store_raw(store_raw)
+      {
+        m_pgm_header = String::str("P5 %u %u 255\n", width, height);
+      }
+
+      bool
+      process(PipelineFrame& frame, unsigned worker)
+      {
+        (void)worker;
+
+        std::string file = frame.label + ".jpg";
+        std::ofstream jpg(file.c_str(), std::ios::binary);
+        jpg.write((char*)&frame.encoded[0], frame.encoded.size());
+
+        if (m_store_raw)
+        {
+          file = frame.label + ".pgm";
+          std::ofstream pgm(file.c_str(), std::ios::binary);
+          pgm.write(m_pgm_header.c_str(), m_pgm_header.size());
+          pgm.write((char*)&frame.raw[0], frame.raw.size());
+        }
+
+        return true;
+      }
+
+    private:
+      //! True to store raw frames.
+      bool m_store_raw;
+      //! PGM header.
+      std::string m_pgm_header;
+    };
+  }
+}
+
+#endif
@@ -38,6 +38,7 @@
 #include "GVSP.hpp"
 #include "WhiteBalance.hpp"
 #include "AutoExposure.hpp"
+#include "Stages.hpp"
 
 using DUNE_NAMESPACES;
 
@@ -102,6 +103,11 @@ namespace Vision
   //! <em>NAME</em> is the amount of seconds elapsed since the Unix
   //! Epoch (1st January, 1970) with four decimal places.
   //!
+  //! Captured frames are copied into a FramePipeline and the
+  //! stream buffer is immediately returned to %GVSP. Decoding,
+  //! JPEG encoding and storage run in separate pipeline stages, the
+  //! encoding stage with a configurable number of workers.
+  //!
   //! @author Ricardo Martins
   namespace DFK51BG02H
   {
@@ -118,6 +124,10 @@ namespace Vision
       unsigned fps;
       //! JPEG quality.
       unsigned jpeg_quality;
+      //! Number of JPEG encoding workers.
+      unsigned jpeg_workers;
+      //! Number of pipeline frames.
+      unsigned pipeline_size;
       //! Number of frame buffers.
       unsigned buffer_count;
       //! Exposure time (or maximum value if auto).
@@ -161,26 +171,26 @@ namespace Vision
       GVCP* m_gvcp;
       //! %GVSP.
       GVSP* m_gvsp;
-      //! RGB24 buffer.
-      uint8_t* m_rgb24_bfr;
       //! Keep-alive counter.
       Counter<double> m_kalive;
       //! %Destination log folder.
       Path m_log_dir;
       //! Array of frames.
       std::queue<Frame*> m_frames;
-      //! PGM header.
-      std::string m_pgm_header;
-      //! Compressor.
-      JPEGCompressor m_jpeg;
+      //! Processing pipeline.
+      FramePipeline* m_pipeline;
+      //! Decoding stage.
+      DecoderStage* m_decoder;
+      //! Sequence number of the next frame.
+      unsigned m_sequence;
+      //! Pipeline statistics report timer.
+      Counter<double> m_stats;
       //! Bayer decoder.
       BayerDecoder m_debayer;
       // White-balance filter.
       WhiteBalance m_white;
       // Exposure time.
       double m_exposure;
-      //! Automatic exposure control.
-      AutoExposure m_ae;
 
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
@@ -188,6 +198,10 @@ namespace Vision
         m_gvsp(NULL),
         m_kalive(0.5),
         m_log_dir(ctx.dir_log),
+        m_pipeline(NULL),
+        m_decoder(NULL),
+        m_sequence(0),
+        m_stats(10.0),
         m_debayer(BayerDecoder::TILE_GBRG),
         m_white(c_width, c_height)
       {
@@ -271,6 +285,17 @@ namespace Vision
         .maximumValue("100")
         .description("JPEG image quality");
 
+        param("JPEG Workers", m_args.jpeg_workers)
+        .defaultValue("2")
+        .minimumValue("1")
+        .maximumValue("8")
+        .description("Number of threads encoding JPEG images");
+
+        param("Pipeline Frames", m_args.pipeline_size)
+        .defaultValue("4")
+        .minimumValue("2")
+        .description("Number of frames being decoded, encoded or stored");
+
         param("Store Raw", m_args.store_raw)
         .defaultValue("false")
         .description("Store raw image data in PGM format");
@@ -281,20 +306,9 @@ namespace Vision
         param("White Balance - R Factor", m_args.r_factor)
         .defaultValue("1.0");
 
-        m_rgb24_bfr = new uint8_t[c_width * c_height * 3];
-
-        // Initialize PGM header.
-        m_pgm_header = String::str("P5 %u %u 255\n", c_width, c_height);
-
         bind<IMC::LoggingControl>(this);
       }
 
-      //! Destructor.
-      ~Task(void)
-      {
-        delete [] m_rgb24_bfr;
-      }
-
       //! Update internal parameters.
       void
       onUpdateParameters(void)
@@ -311,10 +325,15 @@ namespace Vision
       void
       onResourceAcquisition(void)
       {
-        // Initialize JPEG compressor.
-        m_jpeg.setInputDimensions(c_width, c_height);
-        m_jpeg.setInputColorSpace(JPEGCompressor::CS_RGB);
-        m_jpeg.setOutputColorSpace(JPEGCompressor::CS_YUV);
+        // Initialize processing pipeline.
+        m_pipeline = new FramePipeline(m_args.pipeline_size, m_args.pipeline_size);
+        m_decoder = new DecoderStage(m_white, m_debayer, c_width, c_height, m_args.ae);
+        m_pipeline->addStage("Decoder", m_decoder);
+        m_pipeline->addStage("Encoder", new EncoderStage(c_width, c_height, m_args.jpeg_quality,
+                                                         m_args.jpeg_workers),
+                             m_args.jpeg_workers);
+        m_pipeline->addStage("Storage", new StorageStage(c_width, c_height, m_args.store_raw));
+        m_pipeline->start();
 
         m_gvcp = new GVCP(m_args.raddr);
         m_gvsp = new GVSP(this, m_args.port);
@@ -341,6 +360,9 @@ namespace Vision
           m_gvsp = NULL;
         }
 
+        Memory::clear(m_pipeline);
+        m_decoder = NULL;
+
         while (!m_frames.empty())
         {
           Frame* frame = m_frames.front();
@@ -438,6 +460,67 @@ namespace Vision
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_IDLE);
       }
 
+      //! Copy a captured frame to the processing pipeline.
+      //! @param[in] frame captured frame.
+      void
+      submit(Frame* frame)
+      {
+        // Dropped frames are counted by the pipeline.
+        PipelineFrame* pframe = m_pipeline->acquire();
+        if (pframe == NULL)
+          return;
+
+        uint8_t* data = frame->getData();
+        pframe->timestamp = frame->getTimeStamp();
+        pframe->sequence = m_sequence++;
+        pframe->label = (m_log_dir / String::str("%0.4f", pframe->timestamp)).str();
+        pframe->raw.assign(data, data + c_width * c_height);
+        m_pipeline->submit(pframe);
+      }
+
+      //! Apply exposure corrections measured by the decoding stage.
+      void
+      updateExposure(void)
+      {
+        float correction = 1.0f;
+        if (!m_args.ae || !m_decoder->takeCorrection(correction))
+          return;
+
+        // Smooth out the exposure (make it slower varying), halve the deltaEV
+        correction = std::sqrt(correction);
+        m_exposure = Math::trimValue(m_exposure * correction, 0.0001, m_args.exposure_time);
+
+        if (m_exposure >= m_args.ae_min)
+          m_gvcp->setExposureTime(m_exposure);
+        else
+          m_gvcp->setExposureTime(m_args.ae_min);
+      }
+
+      //! Periodically report pipeline statistics.
+      void
+      reportStatistics(void)
+      {
+        if (!m_stats.overflow())
+          return;
+
+        m_stats.reset();
+
+        std::vector<FramePipeline::Statistics> stats;
+        m_pipeline->getStatistics(stats);
+        for (unsigned i = 0; i < stats.size(); ++i)
+        {
+          debug("%s: %lu frames, %lu drops, %u queued, latency %0.3f / %0.3f s, processing %0.3f s",
+                stats[i].name.c_str(), stats[i].frames, stats[i].drops, stats[i].queued,
+                stats[i].latency_mean, stats[i].latency_max, stats[i].processing_mean);
+        }
+
+        if (!stats.empty() && stats[0].drops > 0)
+          war(DTR("pipeline is full, dropped %lu frames in the last %0.0f s"),
+              stats[0].drops, m_stats.getTop());
+
+        m_pipeline->resetStatistics();
+      }
+
       void
       onMain(void)
       {
@@ -460,6 +543,8 @@ namespace Vision
           }
 
           consumeMessages();
+          updateExposure();
+          reportStatistics();
 
           frame = m_gvsp->dequeueDirty();
           if (frame == NULL)
@@ -473,39 +558,7 @@ namespace Vision
             war(DTR("lost at least %d packets"), c_pkts_per_frame - pkt_count);
 
           if (isActive())
-          {
-            m_white.filter(frame->getData());
-            double timestamp = frame->getTimeStamp();
-            Path file = m_log_dir / String::str("%0.4f.jpg", timestamp);
-
-            {
-              m_debayer.decodeToRGB24(frame->getData(), m_rgb24_bfr, c_width, c_height);
-              m_jpeg.compress(m_rgb24_bfr, m_args.jpeg_quality);
-              std::ofstream jpg(file.c_str(), std::ios::binary);
-              jpg.write((char*)m_jpeg.imageData(), m_jpeg.imageSize());
-            }
-
-            if (m_args.store_raw)
-            {
-              file = m_log_dir / String::str("%0.4f.pgm", timestamp);
-              std::ofstream pgm(file.c_str(), std::ios::binary);
-              pgm.write(m_pgm_header.c_str(), m_pgm_header.size());
-              pgm.write((char*)frame->getData(), c_width * c_height);
-            }
-
-            if (m_args.ae)
-            {
-              float correction = m_ae.exposureCorrection(m_rgb24_bfr, c_width * c_height);
-              // Smooth out the exposure (make it slower varying), halve the deltaEV
-              correction = std::sqrt(correction);
-              m_exposure = Math::trimValue(m_exposure * correction, 0.0001, m_args.exposure_time);
-
-              if (m_exposure >= m_args.ae_min)
-                m_gvcp->setExposureTime(m_exposure);
-              else
-                m_gvcp->setExposureTime(m_args.ae_min);
-            }
-          }
+            submit(frame);
 
           m_gvsp->enqueueClean(frame);
         }